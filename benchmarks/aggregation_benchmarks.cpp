@@ -0,0 +1,104 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_aggregation.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t ROWS = 1 << 22;
+constexpr std::size_t BYTES = ROWS * (sizeof(uint32_t) + sizeof(decimal4d_t));
+
+struct trades
+{
+    std::vector<uint32_t> instruments;
+    std::vector<decimal4d_t> notionals;
+};
+
+trades generate_trades(uint32_t instrumentCount)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint32_t> instruments(0, instrumentCount - 1);
+    std::uniform_int_distribution<int64_t> notionals(1, 100000000000);
+    trades res;
+    res.instruments.reserve(ROWS);
+    res.notionals.reserve(ROWS);
+    for (std::size_t i = 0; i < ROWS; ++i) {
+        res.instruments.push_back(instruments(generator));
+        res.notionals.emplace_back(decimal4d_t::nominator_t{notionals(generator)});
+    }
+    return res;
+}
+
+void benchmark_grouping(const std::string& name, uint32_t instrumentCount)
+{
+    const trades data = generate_trades(instrumentCount);
+    run_benchmark("std::unordered_map with operator+=, " + name, 5, ROWS, BYTES, [&data] {
+        std::unordered_map<uint32_t, decimal4d_t> sums;
+        for (std::size_t i = 0; i < ROWS; ++i) {
+            sums[data.instruments[i]] += data.notionals[i];
+        }
+        do_not_optimize(sums.size());
+    });
+    for (std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+        strict::aggregation_options options;
+        options.threads = threads;
+        run_benchmark("strict::hash_aggregator, " + name + (threads == 1 ? "" : ", all threads"), 5, ROWS, BYTES, [&data, &options] {
+            strict::hash_aggregator<uint32_t, decimal4d_t> aggregator(options);
+            aggregator.add(data.instruments, data.notionals);
+            do_not_optimize(aggregator.group_count());
+        });
+    }
+}
+
+}  // namespace
+
+void benchmark_group_by_sum()
+{
+    benchmark_grouping("1000 groups", 1000);
+    benchmark_grouping("100k groups", 100000);
+    benchmark_grouping("4M groups", 4000000);
+}
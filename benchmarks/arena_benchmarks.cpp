@@ -0,0 +1,163 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_arena.hpp"
+#include "benchmark.hpp"
+
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 18;
+// Values of a single processed message
+constexpr std::size_t MESSAGE_SIZE = 32;
+
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        // mostly long values which do not fit in the small string buffer
+        std::uniform_int_distribution<int64_t> distribution(-100000000000000, 100000000000000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+// Messages of MESSAGE_SIZE values delimited with '|'
+const std::vector<std::string>& messages()
+{
+    static const std::vector<std::string> res = [] {
+        std::vector<std::string> texts;
+        for (std::size_t first = 0; first < COLUMN_SIZE; first += MESSAGE_SIZE) {
+            std::string text;
+            for (std::size_t i = first; i < first + MESSAGE_SIZE; ++i) {
+                text += column()[i].to_string();
+                text += i + 1 < first + MESSAGE_SIZE ? "|" : "";
+            }
+            texts.push_back(std::move(text));
+        }
+        return texts;
+    }();
+    return res;
+}
+
+}  // namespace
+
+void benchmark_formatting_with_to_string()
+{
+    std::vector<std::string> texts;
+    texts.reserve(MESSAGE_SIZE);
+    run_benchmark("to_string per message", 20, COLUMN_SIZE, 0, [&texts] {
+        for (std::size_t first = 0; first < COLUMN_SIZE; first += MESSAGE_SIZE) {
+            for (std::size_t i = first; i < first + MESSAGE_SIZE; ++i) {
+                texts.push_back(column()[i].to_string());
+            }
+            do_not_optimize(texts.data());
+            texts.clear();
+        }
+    });
+}
+
+void benchmark_formatting_to_arena()
+{
+    std::pmr::monotonic_buffer_resource arena(16 << 10);
+    std::pmr::vector<std::string_view> texts(std::pmr::new_delete_resource());
+    texts.reserve(MESSAGE_SIZE);
+    run_benchmark("format_to_arena per message", 20, COLUMN_SIZE, 0, [&arena, &texts] {
+        for (std::size_t first = 0; first < COLUMN_SIZE; first += MESSAGE_SIZE) {
+            for (std::size_t i = first; i < first + MESSAGE_SIZE; ++i) {
+                texts.push_back(strict::format_to_arena(column()[i], arena));
+            }
+            do_not_optimize(texts.data());
+            texts.clear();
+            arena.release();
+        }
+    });
+}
+
+// Fields are copied to strings, parsing itself is the same as with the arena
+void benchmark_parsing_message_with_strings()
+{
+    std::vector<decimal4d_t> values;
+    values.reserve(MESSAGE_SIZE);
+    run_benchmark("split to strings + from_chars", 20, COLUMN_SIZE, 0, [&values] {
+        for (const std::string& message : messages()) {
+            std::size_t first = 0;
+            for (;;) {
+                const std::size_t end = message.find('|', first);
+                const std::string field = message.substr(first, end - first);
+                decimal4d_t value;
+                strict::from_chars(field.data(), field.data() + field.size(), value);
+                values.push_back(value);
+                if (end == std::string::npos) {
+                    break;
+                }
+                first = end + 1;
+            }
+            do_not_optimize(values.data());
+            values.clear();
+        }
+    });
+}
+
+void benchmark_parsing_message_in_arena()
+{
+    std::pmr::monotonic_buffer_resource arena(16 << 10);
+    run_benchmark("copy_to_arena + parse_delimited", 20, COLUMN_SIZE, 0, [&arena] {
+        for (const std::string& message : messages()) {
+            const std::string_view text = strict::copy_to_arena(message, arena);
+            std::pmr::vector<decimal4d_t> values(&arena);
+            values.reserve(MESSAGE_SIZE);
+            strict::parse_delimited(text, '|', values);
+            do_not_optimize(values.data());
+            arena.release();
+        }
+    });
+}
@@ -0,0 +1,235 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Prevents the compiler from optimizing away computation of `value`
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Hardware counters of the calling thread, read with perf_event_open on Linux. Counters which cannot be opened
+// (other systems, perf_event_paranoid settings, virtual machines without a PMU) are reported as unavailable and
+// benchmarks fall back to timings only. Only user space events are counted.
+class HardwareCounters
+{
+public:
+    enum Counter { CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1D_MISSES, COUNTER_COUNT };
+
+    struct Values
+    {
+        uint64_t value[COUNTER_COUNT]{};
+        bool available[COUNTER_COUNT]{};
+    };
+
+    static HardwareCounters& instance()
+    {
+        static HardwareCounters counters;
+        return counters;
+    }
+
+    bool available(Counter counter) const { return mFds[counter] >= 0; }
+
+    void start()
+    {
+#if defined(__linux__)
+        if (mFds[CYCLES] >= 0) {
+            ioctl(mFds[CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(mFds[CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    Values stop()
+    {
+        Values values;
+#if defined(__linux__)
+        if (mFds[CYCLES] < 0) {
+            return values;
+        }
+        ioctl(mFds[CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        for (int counter = 0; counter < COUNTER_COUNT; ++counter) {
+            // value, time enabled, time running
+            uint64_t data[3]{};
+            if (mFds[counter] < 0 || read(mFds[counter], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+                continue;
+            }
+            // scales counts up if the kernel multiplexed the group with other events
+            values.value[counter] = static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]);
+            values.available[counter] = true;
+        }
+#endif
+        return values;
+    }
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+private:
+    HardwareCounters()
+    {
+#if defined(__linux__)
+        const uint32_t types[COUNTER_COUNT] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+        const uint64_t configs[COUNTER_COUNT] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+        for (int counter = 0; counter < COUNTER_COUNT; ++counter) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = types[counter];
+            attr.config = configs[counter];
+            attr.disabled = counter == CYCLES ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            // cycles lead the group, so that all counters run over the same interval
+            const int groupFd = counter == CYCLES ? -1 : mFds[CYCLES];
+            if (counter != CYCLES && groupFd < 0) {
+                break;
+            }
+            mFds[counter] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+        }
+#endif
+    }
+
+    ~HardwareCounters()
+    {
+#if defined(__linux__)
+        for (int fd : mFds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    int mFds[COUNTER_COUNT] = {-1, -1, -1, -1};
+};
+
+struct BenchmarkResult
+{
+    double nsPerOp{};
+    double megabytesPerSecond{};
+    // Per operation hardware counts, valid if countersAvailable
+    bool countersAvailable{};
+    double instructionsPerCycle{};
+    double cyclesPerOp{};
+    double instructionsPerOp{};
+    double branchMissesPerOp{};
+    double l1dMissesPerOp{};
+};
+
+// Runs `fn` `iterations` times after a single warm-up run. Every call of `fn` is expected to execute
+// `opsPerIteration` operations and to produce or consume `bytesPerIteration` bytes (0 if not applicable).
+// Where hardware counters are available, IPC and cycles, instructions, branch misses and L1 data cache misses
+// per operation are reported next to the timing.
+template<typename Fn>
+BenchmarkResult run_benchmark(const std::string& name, std::size_t iterations,
+                              std::size_t opsPerIteration, std::size_t bytesPerIteration, Fn&& fn)
+{
+    HardwareCounters& counters = HardwareCounters::instance();
+    fn();
+    counters.start();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const HardwareCounters::Values counts = counters.stop();
+    const double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+    BenchmarkResult result;
+    result.nsPerOp = elapsedNs / static_cast<double>(iterations * opsPerIteration);
+    if (bytesPerIteration != 0) {
+        result.megabytesPerSecond = static_cast<double>(iterations * bytesPerIteration) / 1e6 / (elapsedNs / 1e9);
+    }
+    const double ops = static_cast<double>(iterations * opsPerIteration);
+    result.countersAvailable = counts.available[HardwareCounters::CYCLES] && counts.available[HardwareCounters::INSTRUCTIONS];
+    if (result.countersAvailable) {
+        const double cycles = static_cast<double>(counts.value[HardwareCounters::CYCLES]);
+        result.instructionsPerCycle = cycles != 0 ? counts.value[HardwareCounters::INSTRUCTIONS] / cycles : 0;
+        result.cyclesPerOp = cycles / ops;
+        result.instructionsPerOp = counts.value[HardwareCounters::INSTRUCTIONS] / ops;
+        result.branchMissesPerOp = counts.value[HardwareCounters::BRANCH_MISSES] / ops;
+        result.l1dMissesPerOp = counts.value[HardwareCounters::L1D_MISSES] / ops;
+    }
+
+    std::cout << "[ BENCHMARK  ]\t" << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << result.nsPerOp << " ns/op";
+    if (bytesPerIteration != 0) {
+        std::cout << std::setw(12) << result.megabytesPerSecond << " MB/s";
+    }
+    if (result.countersAvailable) {
+        if (bytesPerIteration == 0) {
+            std::cout << std::setw(17) << "";
+        }
+        std::cout << std::setw(8) << result.instructionsPerCycle << " IPC" << std::setw(10) << result.cyclesPerOp << " cyc/op"
+                  << std::setw(10) << result.instructionsPerOp << " ins/op";
+        if (counts.available[HardwareCounters::BRANCH_MISSES]) {
+            std::cout << std::setprecision(3) << std::setw(9) << result.branchMissesPerOp << " br-miss/op";
+        }
+        if (counts.available[HardwareCounters::L1D_MISSES]) {
+            std::cout << std::setprecision(3) << std::setw(9) << result.l1dMissesPerOp << " L1d-miss/op";
+        }
+    }
+    std::cout << std::endl;
+    return result;
+}
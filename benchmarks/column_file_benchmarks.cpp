@@ -0,0 +1,137 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_column_file.hpp"
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+// Random walk of prices, so that blocks cover narrow ranges like in a time series
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-500, 500);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        int64_t price = 1000000;
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            price += distribution(generator);
+            res.emplace_back(decimal4d_t::nominator_t{price});
+        }
+        return res;
+    }();
+    return values;
+}
+
+std::string column_path(const char* name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void benchmark_selecting_range(const std::string& name, bool withStatistics)
+{
+    const std::string path = column_path(withStatistics ? "strict_decimal_bench_stats.sdcf" : "strict_decimal_bench_plain.sdcf");
+    strict::write_column_file<decimal4d_t>(path.c_str(), column(), strict::COLUMN_FILE_DEFAULT_BLOCK_SIZE, withStatistics);
+    strict::mapped_column<decimal4d_t> mapped;
+    mapped.open(path.c_str());
+    // about 1% of the column
+    const decimal4d_t low = column()[COLUMN_SIZE / 2];
+    const decimal4d_t high{decimal4d_t::nominator_t{low.nominator() + 2000}};
+    std::vector<uint64_t> bitmask(strict::bitmask_words(COLUMN_SIZE));
+    run_benchmark(name, 100, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&] {
+        do_not_optimize(mapped.select_range(low, high, bitmask));
+        do_not_optimize(bitmask.data());
+    });
+    mapped.close();
+    std::remove(path.c_str());
+}
+
+}  // namespace
+
+void benchmark_opening_mapped_column_file()
+{
+    const std::string path = column_path("strict_decimal_bench_open.sdcf");
+    strict::write_column_file<decimal4d_t>(path.c_str(), column());
+    run_benchmark("open mapped column file", 100, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&path] {
+        strict::mapped_column<decimal4d_t> mapped;
+        mapped.open(path.c_str());
+        do_not_optimize(mapped.values().data());
+    });
+    std::remove(path.c_str());
+}
+
+void benchmark_reading_serialized_column_file()
+{
+    const std::string path = column_path("strict_decimal_bench_fixed.bin");
+    std::vector<unsigned char> buffer(strict::max_serialized_size<decimal4d_t>(COLUMN_SIZE, strict::binary_format::fixed));
+    const std::size_t bytes = strict::serialize<decimal4d_t>(column(), buffer, strict::binary_format::fixed).bytes;
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(buffer.data(), 1, bytes, file);
+    std::fclose(file);
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    run_benchmark("read + deserialize fixed file", 20, COLUMN_SIZE, bytes, [&] {
+        std::FILE* in = std::fopen(path.c_str(), "rb");
+        const std::size_t read = std::fread(buffer.data(), 1, bytes, in);
+        std::fclose(in);
+        do_not_optimize(strict::deserialize<decimal4d_t>(strict::span<const unsigned char>(buffer.data(), read), decoded).count);
+        do_not_optimize(decoded.data());
+    });
+    std::remove(path.c_str());
+}
+
+void benchmark_selecting_range_with_block_statistics()
+{
+    benchmark_selecting_range("select_range with block statistics", true);
+}
+
+void benchmark_selecting_range_without_block_statistics()
+{
+    benchmark_selecting_range("select_range without block statistics", false);
+}
@@ -0,0 +1,104 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_compare.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+const std::vector<decimal4d_t>& prices()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(500000, 1500000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_cross_precision_compare()
+{
+    const decimal8d_t limit("100.00005");
+    run_benchmark("decimal_cast and operator<", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&limit] {
+        std::size_t count = 0;
+        for (const auto& price : prices()) {
+            count += strict::decimal_cast<int64_t, 4>(limit) > price;
+        }
+        do_not_optimize(count);
+    });
+    run_benchmark("strict::compare", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&limit] {
+        std::size_t count = 0;
+        for (const auto& price : prices()) {
+            count += strict::compare(price, limit) < 0;
+        }
+        do_not_optimize(count);
+    });
+}
+
+void benchmark_compare_column()
+{
+    const decimal4d_t limit("100");
+    std::vector<uint64_t> bitmask(strict::bitmask_words(COLUMN_SIZE));
+    run_benchmark("bitmask with operator<", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&limit, &bitmask] {
+        std::fill(bitmask.begin(), bitmask.end(), 0);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            bitmask[i / 64] |= static_cast<uint64_t>(prices()[i] < limit) << (i % 64);
+        }
+        do_not_optimize(bitmask.data());
+    });
+    run_benchmark("strict::compare_column", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&limit, &bitmask] {
+        strict::compare_column<decimal4d_t>(prices(), strict::compare_op::less, limit, bitmask);
+        do_not_optimize(bitmask.data());
+    });
+}
@@ -0,0 +1,161 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_compounding.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+namespace
+{
+
+constexpr std::size_t CURVES = 256;
+constexpr std::size_t PERIODS = 360;
+
+// Monthly rates of curves, up to 1%
+std::vector<decimal8d_t> generate_rates()
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> distribution(0, 1000000);
+    std::vector<decimal8d_t> res;
+    for (std::size_t i = 0; i < CURVES; ++i) {
+        res.emplace_back(decimal8d_t::nominator_t{distribution(generator)});
+    }
+    return res;
+}
+
+std::vector<decimal2d_t> generate_cashflows()
+{
+    std::mt19937_64 generator(7);
+    std::uniform_int_distribution<int64_t> distribution(-10000000, 10000000);
+    std::vector<decimal2d_t> res;
+    for (std::size_t i = 0; i < PERIODS; ++i) {
+        res.emplace_back(decimal2d_t::nominator_t{distribution(generator)});
+    }
+    return res;
+}
+
+}  // namespace
+
+void benchmark_compound()
+{
+    const auto rates = generate_rates();
+    const decimal8d_t one("1");
+    run_benchmark("(1 + r)^360 with operator*=", 100, CURVES, 0, [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            const decimal8d_t growth = one + rate;
+            decimal8d_t factor = one;
+            for (std::size_t period = 0; period < PERIODS; ++period) {
+                factor *= growth;
+            }
+            sum += factor.nominator();
+        }
+        do_not_optimize(sum);
+    });
+    run_benchmark("(1 + r)^360 with strict::compound", 100, CURVES, 0, [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            sum += strict::compound(rate, PERIODS).nominator();
+        }
+        do_not_optimize(sum);
+    });
+    run_benchmark("(1 + r)^-360 with strict::compound", 100, CURVES, 0, [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            sum += strict::compound(rate, -static_cast<int64_t>(PERIODS)).nominator();
+        }
+        do_not_optimize(sum);
+    });
+}
+
+void benchmark_npv()
+{
+    const auto rates = generate_rates();
+    const auto cashflows = generate_cashflows();
+    const decimal8d_t one("1");
+    run_benchmark("NPV of 360 cash flows with operator*=", 20, CURVES, CURVES * PERIODS * sizeof(decimal2d_t), [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            const decimal8d_t discount = one / (one + rate);
+            decimal8d_t factor = one;
+            decimal2d_t pv("0");
+            for (const auto& cashflow : cashflows) {
+                pv += cashflow * factor;
+                factor *= discount;
+            }
+            sum += pv.nominator();
+        }
+        do_not_optimize(sum);
+    });
+    run_benchmark("NPV of 360 cash flows through double", 20, CURVES, CURVES * PERIODS * sizeof(decimal2d_t), [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            const double discount = 1.0 / (1.0 + rate.to_double());
+            double factor = 1.0;
+            double pv = 0.0;
+            for (const auto& cashflow : cashflows) {
+                pv += cashflow.to_double() * factor;
+                factor *= discount;
+            }
+            sum += decimal2d_t(pv).nominator();
+        }
+        do_not_optimize(sum);
+    });
+    std::vector<decimal8d_t> factors(PERIODS);
+    run_benchmark("NPV of 360 cash flows with discount_factors", 20, CURVES, CURVES * PERIODS * sizeof(decimal2d_t), [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            strict::discount_factors(rate, strict::span<decimal8d_t>(factors.data(), factors.size()));
+            sum += strict::present_value<decimal2d_t, decimal8d_t>(cashflows, factors).nominator();
+        }
+        do_not_optimize(sum);
+    });
+    run_benchmark("NPV of 360 cash flows with strict::npv", 20, CURVES, CURVES * PERIODS * sizeof(decimal2d_t), [&] {
+        int64_t sum = 0;
+        for (const auto& rate : rates) {
+            sum += strict::npv<decimal2d_t>(rate, cashflows).nominator();
+        }
+        do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,112 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_compression.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 22;
+
+// random walk of tick prices
+const std::vector<decimal4d_t>& prices()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int> ticks(-3, 3);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        int64_t nominator = 1000000;
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            nominator += ticks(generator) * 5;
+            res.emplace_back(decimal4d_t::nominator_t{nominator});
+        }
+        return res;
+    }();
+    return values;
+}
+
+void benchmark_decoding(const std::string& name, strict::compression_codec codec)
+{
+    const auto column = strict::compressed_column<decimal4d_t>::compress(prices(), codec);
+    std::cout << "[ BENCHMARK  ]\t" << name << ": " << std::setprecision(3)
+              << static_cast<double>(column.compressed_bytes()) / COLUMN_SIZE << " bytes per value" << std::endl;
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    run_benchmark(name + " decompress", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&column, &decoded] {
+        column.decompress(decoded);
+        do_not_optimize(decoded.data());
+    });
+}
+
+}  // namespace
+
+void benchmark_frame_of_reference_decoding()
+{
+    benchmark_decoding("frame of reference", strict::compression_codec::frame_of_reference);
+}
+
+void benchmark_delta_decoding()
+{
+    benchmark_decoding("delta", strict::compression_codec::delta);
+}
+
+void benchmark_xor_delta_decoding()
+{
+    benchmark_decoding("xor delta", strict::compression_codec::xor_delta);
+}
+
+void benchmark_compressed_sum()
+{
+    const auto column = strict::compressed_column<decimal4d_t>::compress(prices(), strict::compression_codec::frame_of_reference);
+    run_benchmark("sum of compressed column", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&column] {
+        do_not_optimize(column.sum());
+    });
+    run_benchmark("sum of uncompressed column", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [] {
+        decimal4d_t sum{};
+        for (const auto& value : prices()) {
+            sum += value;
+        }
+        do_not_optimize(sum);
+    });
+}
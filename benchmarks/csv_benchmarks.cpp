@@ -0,0 +1,107 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_csv.hpp"
+#include "benchmark.hpp"
+
+#include <fstream>
+#include <random>
+#include <string>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t ROWS = 1 << 20;
+
+// Creates (once) a CSV file with an id column and two decimal columns, returns its path and size
+const std::pair<std::string, std::size_t>& csv_file()
+{
+    static const std::pair<std::string, std::size_t> file = [] {
+        const std::string path = "strict_decimal_benchmark.csv";
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+        std::ofstream out(path, std::ios::binary);
+        out << "id,price,qty\n";
+        char buffer[64];
+        for (std::size_t i = 0; i < ROWS; ++i) {
+            char* end = buffer;
+            end = decimal4d_t{decimal4d_t::nominator_t{distribution(generator)}}.to_chars(end);
+            *end++ = ',';
+            end = decimal4d_t{decimal4d_t::nominator_t{distribution(generator)}}.to_chars(end);
+            out << i << ',';
+            out.write(buffer, end - buffer);
+            out << '\n';
+        }
+        return std::make_pair(path, static_cast<std::size_t>(out.tellp()));
+    }();
+    return file;
+}
+
+}  // namespace
+
+void benchmark_reading_csv_with_string_constructor()
+{
+    const auto& file = csv_file();
+    run_benchmark("csv getline + string constructor", 3, ROWS, file.second, [&file] {
+        std::ifstream in(file.first, std::ios::binary);
+        std::vector<decimal4d_t> price, qty;
+        std::string line;
+        std::getline(in, line);
+        while (std::getline(in, line)) {
+            const auto first = line.find(',');
+            const auto second = line.find(',', first + 1);
+            price.emplace_back(line.substr(first + 1, second - first - 1));
+            qty.emplace_back(line.substr(second + 1));
+        }
+        do_not_optimize(price.data());
+        do_not_optimize(qty.data());
+    });
+}
+
+void benchmark_reading_csv_file()
+{
+    const auto& file = csv_file();
+    run_benchmark("read_csv_file", 3, ROWS, file.second, [&file] {
+        strict::csv_column_parser<decimal4d_t> parser({1, 2});
+        strict::read_csv_file(file.first, parser);
+        do_not_optimize(parser.columns().data());
+    });
+    std::remove(file.first.c_str());
+}
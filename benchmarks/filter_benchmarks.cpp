@@ -0,0 +1,103 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_filter.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using quantity_t = strict::decimal_t<int64_t, 0>;
+
+namespace
+{
+
+constexpr std::size_t ROWS = 1 << 22;
+
+struct orders
+{
+    std::vector<decimal4d_t> prices;
+    std::vector<quantity_t> quantities;
+};
+
+const orders& generated_orders()
+{
+    static const orders values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> prices(500000, 1500000);
+        std::uniform_int_distribution<int64_t> quantities(1, 1000);
+        orders res;
+        res.prices.reserve(ROWS);
+        res.quantities.reserve(ROWS);
+        for (std::size_t i = 0; i < ROWS; ++i) {
+            res.prices.emplace_back(decimal4d_t::nominator_t{prices(generator)});
+            res.quantities.emplace_back(quantity_t::nominator_t{quantities(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_risk_screen_filter()
+{
+    const orders& data = generated_orders();
+    const decimal4d_t limit("120");
+    const quantity_t maxQuantity(500);
+    constexpr std::size_t BYTES = ROWS * (sizeof(decimal4d_t) + sizeof(quantity_t));
+    std::vector<uint32_t> selection;
+    selection.reserve(ROWS);
+    run_benchmark("element by element operator<", 10, ROWS, BYTES, [&] {
+        selection.clear();
+        for (std::size_t i = 0; i < ROWS; ++i) {
+            if (data.prices[i] > limit && data.quantities[i] <= maxQuantity) {
+                selection.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        do_not_optimize(selection.data());
+    });
+    run_benchmark("strict::column_filter", 10, ROWS, BYTES, [&] {
+        strict::column_filter filter(ROWS);
+        filter.where<decimal4d_t>(data.prices, strict::compare_op::greater, limit)
+              .where<quantity_t>(data.quantities, strict::compare_op::less_equal, maxQuantity);
+        const auto res = filter.selection();
+        do_not_optimize(res.data());
+    });
+}
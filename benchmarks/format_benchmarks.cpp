@@ -0,0 +1,141 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_format.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+std::size_t formatted_size()
+{
+    static const std::size_t size = [] {
+        std::vector<char> buffer(strict::max_formatted_column_size<decimal4d_t>(COLUMN_SIZE));
+        return static_cast<std::size_t>(strict::format_column<decimal4d_t>(column(), buffer.data(), ',') - buffer.data());
+    }();
+    return size;
+}
+
+}  // namespace
+
+void benchmark_to_string()
+{
+    run_benchmark("to_string", 5, COLUMN_SIZE, formatted_size(), [] {
+        for (const auto& value : column()) {
+            const std::string str = value.to_string();
+            do_not_optimize(str.data());
+        }
+    });
+}
+
+void benchmark_stringstream_formatting()
+{
+    // Reference: formatting via std::stringstream as done by to_string() before introducing to_chars()
+    run_benchmark("stringstream", 5, COLUMN_SIZE, formatted_size(), [] {
+        for (const auto& value : column()) {
+            std::stringstream ss;
+            ss << value.integer_part() << '.' << std::setfill('0') << std::setw(decimal4d_t::PRECISION) << value.fraction_part();
+            const std::string str = ss.str();
+            do_not_optimize(str.data());
+        }
+    });
+}
+
+void benchmark_formatting_column()
+{
+    std::vector<char> buffer(strict::max_formatted_column_size<decimal4d_t>(COLUMN_SIZE));
+    run_benchmark("format_column", 20, COLUMN_SIZE, formatted_size(), [&buffer] {
+        const char* end = strict::format_column<decimal4d_t>(column(), buffer.data(), ',');
+        do_not_optimize(end);
+    });
+}
+
+void benchmark_formatting_with_default_spec()
+{
+    std::vector<char> buffer(strict::max_formatted_column_size<decimal4d_t>(COLUMN_SIZE));
+    const strict::decimal_format_spec spec;
+    run_benchmark("format_to default spec", 20, COLUMN_SIZE, formatted_size(), [&buffer, &spec] {
+        char* out = buffer.data();
+        for (const auto& value : column()) {
+            out = strict::format_to(out, value, spec);
+            *out++ = ',';
+        }
+        do_not_optimize(out);
+    });
+}
+
+void benchmark_formatting_with_grouping_spec()
+{
+    std::vector<char> buffer(COLUMN_SIZE * 24);
+    strict::decimal_format_spec spec;
+    const std::string text = ">16,.2";
+    auto it = text.begin();
+    strict::parse_format_spec(it, text.end(), spec);
+    run_benchmark("format_to width, grouping and precision", 20, COLUMN_SIZE, 0, [&buffer, &spec] {
+        char* out = buffer.data();
+        for (const auto& value : column()) {
+            out = strict::format_to(out, value, spec);
+            *out++ = ',';
+        }
+        do_not_optimize(out);
+    });
+}
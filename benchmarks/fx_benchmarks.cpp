@@ -0,0 +1,103 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_fx.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+namespace
+{
+
+constexpr std::size_t COUNT = 1 << 20;
+constexpr uint32_t EUR = strict::currency_code("EUR");
+constexpr uint32_t USD = strict::currency_code("USD");
+
+}  // namespace
+
+void benchmark_fx_convert()
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+    std::vector<decimal2d_t> amounts;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        amounts.emplace_back(decimal2d_t::nominator_t{distribution(generator)});
+    }
+    std::vector<decimal2d_t> results(COUNT);
+    const decimal8d_t rate("1.08765432");
+
+    run_benchmark("FX conversion with operator*", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = amounts[i] * rate;
+        }
+        do_not_optimize(results.data());
+    });
+
+    strict::fx_table<decimal2d_t, decimal8d_t> table;
+    table.set(EUR, USD, rate);
+    run_benchmark("FX conversion with fx_table, one by one", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = table.convert(amounts[i], EUR, USD);
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("FX conversion with fx_table, column", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        table.convert(amounts, EUR, USD, results);
+        do_not_optimize(results.data());
+    });
+    run_benchmark("FX inverse conversion with fx_table, column", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        table.convert(amounts, USD, EUR, results);
+        do_not_optimize(results.data());
+    });
+
+    strict::fx_converter<decimal2d_t, decimal8d_t> converter(table);
+    run_benchmark("FX conversion with fx_converter, one by one", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = converter.convert(amounts[i], EUR, USD);
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("FX conversion with fx_converter, column", 10, COUNT, COUNT * sizeof(decimal2d_t), [&] {
+        converter.convert(amounts, EUR, USD, results);
+        do_not_optimize(results.data());
+    });
+}
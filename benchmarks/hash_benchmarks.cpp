@@ -0,0 +1,96 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_hash.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+// prices of 20000 distinct ticks of 0.0005
+const std::vector<decimal4d_t>& prices()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> ticks(0, 20000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{1000000 + ticks(generator) * 5});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_hash_column()
+{
+    std::vector<uint64_t> hashes(COLUMN_SIZE);
+    run_benchmark("strict::hash_column", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&hashes] {
+        strict::hash_column<decimal4d_t>(prices(), hashes);
+        do_not_optimize(hashes.data());
+    });
+}
+
+void benchmark_price_keyed_aggregation()
+{
+    run_benchmark("std::unordered_map aggregation", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [] {
+        std::unordered_map<decimal4d_t, int64_t> counts;
+        for (const auto& price : prices()) {
+            ++counts[price];
+        }
+        do_not_optimize(counts.size());
+    });
+    run_benchmark("strict::flat_hash_map aggregation", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [] {
+        strict::flat_hash_map<decimal4d_t, int64_t> counts;
+        for (const auto& price : prices()) {
+            ++counts[price];
+        }
+        do_not_optimize(counts.size());
+    });
+}
@@ -0,0 +1,114 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_ieee754.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+template<typename BitsT>
+void benchmark_ieee754_round_trip(const std::string& name, strict::ieee754_encoding encoding)
+{
+    std::vector<BitsT> bits(COLUMN_SIZE);
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    run_benchmark(name, 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(BitsT), [&bits, &decoded, encoding] {
+        if constexpr (sizeof(BitsT) == sizeof(uint64_t)) {
+            strict::to_ieee754_decimal64<decimal4d_t>(column(), encoding, bits);
+            strict::from_ieee754_decimal64<decimal4d_t>(bits, encoding, decoded);
+        } else {
+            strict::to_ieee754_decimal128<decimal4d_t>(column(), encoding, bits);
+            strict::from_ieee754_decimal128<decimal4d_t>(bits, encoding, decoded);
+        }
+        do_not_optimize(decoded.data());
+    });
+}
+
+}  // namespace
+
+void benchmark_double_round_trip()
+{
+    std::vector<double> doubles(COLUMN_SIZE);
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    run_benchmark("to_double + floating constructor", 20, COLUMN_SIZE, COLUMN_SIZE * sizeof(double), [&doubles, &decoded] {
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            doubles[i] = column()[i].to_double();
+        }
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            decoded[i] = decimal4d_t{doubles[i]};
+        }
+        do_not_optimize(decoded.data());
+    });
+}
+
+void benchmark_decimal64_bid_round_trip()
+{
+    benchmark_ieee754_round_trip<uint64_t>("decimal64 BID round trip", strict::ieee754_encoding::bid);
+}
+
+void benchmark_decimal64_dpd_round_trip()
+{
+    benchmark_ieee754_round_trip<uint64_t>("decimal64 DPD round trip", strict::ieee754_encoding::dpd);
+}
+
+void benchmark_decimal128_bid_round_trip()
+{
+    benchmark_ieee754_round_trip<strict::ieee754_decimal128>("decimal128 BID round trip", strict::ieee754_encoding::bid);
+}
@@ -0,0 +1,156 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_json.hpp"
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+const std::string& json_text()
+{
+    static const std::string text = [] {
+        std::string res(strict::max_json_array_size<decimal4d_t>(COLUMN_SIZE), '\0');
+        res.resize(static_cast<std::size_t>(strict::to_json_array<decimal4d_t>(column(), &res[0]) - res.data()));
+        return res;
+    }();
+    return text;
+}
+
+// Same values in scientific notation with a single integer digit, e.g. -1.2345678e3
+const std::string& json_text_with_exponents()
+{
+    static const std::string text = [] {
+        std::string res = "[";
+        char buffer[64];
+        for (const auto& value : column()) {
+            const int length = std::snprintf(buffer, sizeof(buffer), "%.7e,", value.to_double());
+            res.append(buffer, static_cast<std::size_t>(length));
+        }
+        res.back() = ']';
+        return res;
+    }();
+    return text;
+}
+
+void benchmark_reading(const std::string& name, const std::string& text)
+{
+    std::vector<decimal4d_t> values(COLUMN_SIZE);
+    run_benchmark(name, 20, COLUMN_SIZE, text.size(), [&text, &values] {
+        const auto res = strict::from_json_array<decimal4d_t>(text.data(), text.data() + text.size(), values);
+        do_not_optimize(res.count);
+        do_not_optimize(values.data());
+    });
+}
+
+}  // namespace
+
+void benchmark_reading_json_array()
+{
+    benchmark_reading("from_json_array", json_text());
+}
+
+void benchmark_reading_json_array_with_exponents()
+{
+    benchmark_reading("from_json_array with exponents", json_text_with_exponents());
+}
+
+void benchmark_reading_json_array_through_double()
+{
+    // Reference: strtod and the floating point constructor, which may lose digits
+    std::vector<decimal4d_t> values(COLUMN_SIZE);
+    const std::string& text = json_text();
+    run_benchmark("strtod + double constructor", 20, COLUMN_SIZE, text.size(), [&text, &values] {
+        const char* it = text.c_str() + 1;
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            char* end = nullptr;
+            values[i] = decimal4d_t{std::strtod(it, &end)};
+            it = end + 1;
+        }
+        do_not_optimize(values.data());
+    });
+}
+
+void benchmark_writing_json_array()
+{
+    std::vector<char> buffer(strict::max_json_array_size<decimal4d_t>(COLUMN_SIZE));
+    run_benchmark("to_json_array", 20, COLUMN_SIZE, json_text().size(), [&buffer] {
+        const char* end = strict::to_json_array<decimal4d_t>(column(), buffer.data());
+        do_not_optimize(end);
+    });
+}
+
+void benchmark_writing_json_array_through_double()
+{
+    // Reference: snprintf of to_double() with the same number of fraction digits
+    std::vector<char> buffer(strict::max_json_array_size<decimal4d_t>(COLUMN_SIZE) + 64);
+    run_benchmark("snprintf of to_double", 5, COLUMN_SIZE, json_text().size(), [&buffer] {
+        char* out = buffer.data();
+        *out++ = '[';
+        for (const auto& value : column()) {
+            out += std::snprintf(out, 64, "%.4f,", value.to_double());
+        }
+        out[-1] = ']';
+        do_not_optimize(out);
+    });
+}
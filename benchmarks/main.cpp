@@ -0,0 +1,231 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "benchmark.hpp"
+#include "format_benchmarks.hpp"
+#include "csv_benchmarks.hpp"
+#include "serialization_benchmarks.hpp"
+#include "compression_benchmarks.hpp"
+#include "sort_benchmarks.hpp"
+#include "price_ladder_benchmarks.hpp"
+#include "hash_benchmarks.hpp"
+#include "compare_benchmarks.hpp"
+#include "filter_benchmarks.hpp"
+#include "aggregation_benchmarks.hpp"
+#include "window_benchmarks.hpp"
+#include "statistics_benchmarks.hpp"
+#include "math_benchmarks.hpp"
+#include "compounding_benchmarks.hpp"
+#include "fx_benchmarks.hpp"
+#include "operator_benchmarks.hpp"
+#include "parts_benchmarks.hpp"
+#include "column_file_benchmarks.hpp"
+#include "arena_benchmarks.hpp"
+#include "json_benchmarks.hpp"
+#include "ieee754_benchmarks.hpp"
+
+void RunFormatBenchmarks()
+{
+    benchmark_to_string();
+    benchmark_stringstream_formatting();
+    benchmark_formatting_column();
+    benchmark_formatting_with_default_spec();
+    benchmark_formatting_with_grouping_spec();
+}
+
+void RunCsvBenchmarks()
+{
+    benchmark_reading_csv_with_string_constructor();
+    benchmark_reading_csv_file();
+}
+
+void RunSerializationBenchmarks()
+{
+    benchmark_text_round_trip();
+    benchmark_fixed_serialization_round_trip();
+    benchmark_compact_serialization_round_trip();
+}
+
+void RunIeee754Benchmarks()
+{
+    benchmark_double_round_trip();
+    benchmark_decimal64_bid_round_trip();
+    benchmark_decimal64_dpd_round_trip();
+    benchmark_decimal128_bid_round_trip();
+}
+
+void RunCompressionBenchmarks()
+{
+    benchmark_frame_of_reference_decoding();
+    benchmark_delta_decoding();
+    benchmark_xor_delta_decoding();
+    benchmark_compressed_sum();
+}
+
+void RunSortBenchmarks()
+{
+    benchmark_radix_sort();
+    benchmark_argsort();
+    benchmark_lower_bound();
+}
+
+void RunPriceLadderBenchmarks()
+{
+    benchmark_price_ladder_updates();
+    benchmark_price_ladder_best_price();
+}
+
+void RunHashBenchmarks()
+{
+    benchmark_hash_column();
+    benchmark_price_keyed_aggregation();
+}
+
+void RunCompareBenchmarks()
+{
+    benchmark_cross_precision_compare();
+    benchmark_compare_column();
+}
+
+void RunFilterBenchmarks()
+{
+    benchmark_risk_screen_filter();
+}
+
+void RunAggregationBenchmarks()
+{
+    benchmark_group_by_sum();
+}
+
+void RunWindowBenchmarks()
+{
+    benchmark_prefix_sum();
+    benchmark_rolling_mean();
+    benchmark_vwap();
+}
+
+void RunStatisticsBenchmarks()
+{
+    benchmark_quantiles();
+    benchmark_histogram();
+    benchmark_quantile_sketch();
+}
+
+void RunMathBenchmarks()
+{
+    benchmark_sqrt();
+    benchmark_exp_log();
+    benchmark_pow();
+}
+
+void RunCompoundingBenchmarks()
+{
+    benchmark_compound();
+    benchmark_npv();
+}
+
+void RunFxBenchmarks()
+{
+    benchmark_fx_convert();
+}
+
+void RunOperatorBenchmarks()
+{
+    benchmark_additive_operators();
+    benchmark_multiplicative_operators();
+    benchmark_decimal_cast();
+}
+
+void RunPartsBenchmarks()
+{
+    benchmark_construction_from_parts();
+}
+
+void RunColumnFileBenchmarks()
+{
+    benchmark_opening_mapped_column_file();
+    benchmark_reading_serialized_column_file();
+    benchmark_selecting_range_with_block_statistics();
+    benchmark_selecting_range_without_block_statistics();
+}
+
+void RunArenaBenchmarks()
+{
+    benchmark_formatting_with_to_string();
+    benchmark_formatting_to_arena();
+    benchmark_parsing_message_with_strings();
+    benchmark_parsing_message_in_arena();
+}
+
+void RunJsonBenchmarks()
+{
+    benchmark_reading_json_array();
+    benchmark_reading_json_array_with_exponents();
+    benchmark_reading_json_array_through_double();
+    benchmark_writing_json_array();
+    benchmark_writing_json_array_through_double();
+}
+
+int main()
+{
+    if (!HardwareCounters::instance().available(HardwareCounters::CYCLES)) {
+        std::cout << "Hardware counters are unavailable, only timings are reported" << std::endl;
+    }
+    RunFormatBenchmarks();
+    RunCsvBenchmarks();
+    RunSerializationBenchmarks();
+    RunIeee754Benchmarks();
+    RunCompressionBenchmarks();
+    RunSortBenchmarks();
+    RunPriceLadderBenchmarks();
+    RunHashBenchmarks();
+    RunCompareBenchmarks();
+    RunFilterBenchmarks();
+    RunAggregationBenchmarks();
+    RunWindowBenchmarks();
+    RunStatisticsBenchmarks();
+    RunMathBenchmarks();
+    RunCompoundingBenchmarks();
+    RunFxBenchmarks();
+    RunOperatorBenchmarks();
+    RunPartsBenchmarks();
+    RunColumnFileBenchmarks();
+    RunArenaBenchmarks();
+    RunJsonBenchmarks();
+    return 0;
+}
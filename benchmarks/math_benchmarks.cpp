@@ -0,0 +1,105 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_math.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+namespace
+{
+
+constexpr std::size_t COUNT = 1 << 16;
+
+std::vector<decimal8d_t> generate(int64_t low, int64_t high)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> distribution(low, high);
+    std::vector<decimal8d_t> res;
+    res.reserve(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        res.emplace_back(decimal8d_t::nominator_t{distribution(generator)});
+    }
+    return res;
+}
+
+template<typename Fn>
+void benchmark_function(const std::string& name, const std::vector<decimal8d_t>& arguments, Fn fn)
+{
+    run_benchmark(name, 20, COUNT, COUNT * sizeof(decimal8d_t), [&arguments, &fn] {
+        int64_t sum = 0;
+        for (const auto& argument : arguments) {
+            sum += fn(argument).nominator();
+        }
+        do_not_optimize(sum);
+    });
+}
+
+}  // namespace
+
+void benchmark_sqrt()
+{
+    const auto arguments = generate(1, 100000000000000);
+    benchmark_function("sqrt through double", arguments, [](const decimal8d_t& value) { return decimal8d_t(std::sqrt(value.to_double())); });
+    benchmark_function("strict::sqrt", arguments, [](const decimal8d_t& value) { return strict::sqrt(value); });
+}
+
+void benchmark_exp_log()
+{
+    const auto exponents = generate(-2000000000, 2000000000);
+    benchmark_function("exp through double", exponents, [](const decimal8d_t& value) { return decimal8d_t(std::exp(value.to_double())); });
+    benchmark_function("strict::exp", exponents, [](const decimal8d_t& value) { return strict::exp(value); });
+    const auto arguments = generate(1, 100000000000000);
+    benchmark_function("log through double", arguments, [](const decimal8d_t& value) { return decimal8d_t(std::log(value.to_double())); });
+    benchmark_function("strict::log", arguments, [](const decimal8d_t& value) { return strict::log(value); });
+}
+
+void benchmark_pow()
+{
+    const auto rates = generate(100000000, 110000000);
+    benchmark_function("pow(x, 30) through double", rates, [](const decimal8d_t& value) { return decimal8d_t(std::pow(value.to_double(), 30)); });
+    benchmark_function("strict::pow(x, 30)", rates, [](const decimal8d_t& value) { return strict::pow(value, 30); });
+    const decimal8d_t exponent("0.25");
+    benchmark_function("pow(x, 0.25) through double", rates,
+                       [&exponent](const decimal8d_t& value) { return decimal8d_t(std::pow(value.to_double(), exponent.to_double())); });
+    benchmark_function("strict::pow(x, 0.25)", rates, [&exponent](const decimal8d_t& value) { return strict::pow(value, exponent); });
+}
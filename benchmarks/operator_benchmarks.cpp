@@ -0,0 +1,150 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+namespace
+{
+
+// Fits in L1 and L2 caches, so that the operators and not memory dominate the counts
+constexpr std::size_t COUNT = 1 << 12;
+constexpr std::size_t ITERATIONS = 1000;
+
+template<typename DecimalT>
+std::vector<DecimalT> random_column(int64_t min, int64_t max, bool nonZero = false)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> distribution(min, max);
+    std::vector<DecimalT> values;
+    values.reserve(COUNT);
+    while (values.size() < COUNT) {
+        const int64_t nominator = distribution(generator);
+        if (!nonZero || nominator != 0) {
+            values.emplace_back(typename DecimalT::nominator_t{nominator});
+        }
+    }
+    return values;
+}
+
+}  // namespace
+
+void benchmark_additive_operators()
+{
+    const std::vector<decimal4d_t> lhs = random_column<decimal4d_t>(-100000000, 100000000);
+    const std::vector<decimal4d_t> rhs = random_column<decimal4d_t>(-100000000, 100000000);
+    std::vector<decimal4d_t> results(COUNT);
+
+    run_benchmark("operator+", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = lhs[i] + rhs[i];
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("operator+= accumulation", ITERATIONS, COUNT, 0, [&] {
+        decimal4d_t sum;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            sum += lhs[i];
+        }
+        do_not_optimize(sum);
+    });
+}
+
+void benchmark_multiplicative_operators()
+{
+    const std::vector<decimal4d_t> lhs = random_column<decimal4d_t>(-100000000, 100000000);
+    const std::vector<decimal4d_t> rhs = random_column<decimal4d_t>(-1000000, 1000000, true);
+    const std::vector<decimal8d_t> rates = random_column<decimal8d_t>(50000000, 200000000);
+    std::vector<decimal4d_t> results(COUNT);
+
+    run_benchmark("operator*= same precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = lhs[i];
+            results[i] *= rhs[i];
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("operator*= mixed precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = lhs[i];
+            results[i] *= rates[i];
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("operator/= same precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = lhs[i];
+            results[i] /= rhs[i];
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("operator/= mixed precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            results[i] = lhs[i];
+            results[i] /= rates[i];
+        }
+        do_not_optimize(results.data());
+    });
+}
+
+void benchmark_decimal_cast()
+{
+    const std::vector<decimal4d_t> values = random_column<decimal4d_t>(-100000000, 100000000);
+    std::vector<decimal2d_t> narrowed(COUNT);
+    std::vector<decimal8d_t> widened(COUNT);
+
+    run_benchmark("decimal_cast to lower precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            narrowed[i] = strict::decimal_cast<decimal2d_t>(values[i]);
+        }
+        do_not_optimize(narrowed.data());
+    });
+    run_benchmark("decimal_cast to higher precision", ITERATIONS, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            widened[i] = strict::decimal_cast<decimal8d_t>(values[i]);
+        }
+        do_not_optimize(widened.data());
+    });
+}
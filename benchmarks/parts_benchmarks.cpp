@@ -0,0 +1,105 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_parts.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COUNT = 1 << 16;
+
+// Digit count of the former constructor, through a floating point logarithm
+decimal4d_t from_parts_with_log10(int64_t integerPart, int64_t fractionPart)
+{
+    int fractionLength = static_cast<int>(std::log10(fractionPart)) + 1;
+    if (fractionLength > decimal4d_t::PRECISION) {
+        const int lastSignificantDigit = static_cast<int>(fractionPart / strict::Power10<int64_t>(fractionLength - decimal4d_t::PRECISION - 1) % 10);
+        fractionPart = fractionPart / strict::Power10<int64_t>(fractionLength - decimal4d_t::PRECISION) + (lastSignificantDigit >= 5 ? 1 : 0);
+    }
+    return decimal4d_t(decimal4d_t::nominator_t{integerPart * decimal4d_t::DENOMINATOR + (integerPart >= 0 ? fractionPart : -fractionPart)});
+}
+
+void run_parts_benchmarks(const char* data, const std::vector<int64_t>& integers, const std::vector<int64_t>& fractions)
+{
+    std::vector<decimal4d_t> values(COUNT);
+    const std::string suffix = std::string(", ") + data;
+    run_benchmark("parts with std::log10" + suffix, 100, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            values[i] = from_parts_with_log10(integers[i], fractions[i]);
+        }
+        do_not_optimize(values.data());
+    });
+    run_benchmark("parts constructor" + suffix, 100, COUNT, 0, [&] {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            values[i] = decimal4d_t(integers[i], fractions[i]);
+        }
+        do_not_optimize(values.data());
+    });
+    run_benchmark("from_parts column" + suffix, 100, COUNT, 0, [&] {
+        strict::from_parts<decimal4d_t>(integers, fractions, values);
+        do_not_optimize(values.data());
+    });
+}
+
+}  // namespace
+
+void benchmark_construction_from_parts()
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> integerDistribution(-1000000, 1000000);
+    std::uniform_int_distribution<int64_t> fractionDistribution(1, 9999);
+    std::uniform_int_distribution<int> lengthDistribution(1, 12);
+    std::vector<int64_t> integers(COUNT), fractions(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        integers[i] = integerDistribution(generator);
+        fractions[i] = fractionDistribution(generator);
+    }
+    run_parts_benchmarks("up to 4 fraction digits", integers, fractions);
+
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        fractions[i] = std::uniform_int_distribution<int64_t>(1, strict::Power10<int64_t>(lengthDistribution(generator)) - 1)(generator);
+    }
+    run_parts_benchmarks("up to 12 fraction digits", integers, fractions);
+}
@@ -0,0 +1,135 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_price_ladder.hpp"
+#include "benchmark.hpp"
+
+#include <map>
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t UPDATES = 1 << 20;
+
+struct level_update
+{
+    decimal4d_t price;
+    int64_t quantity;  // 0 removes the level
+};
+
+// updates of levels around a mid price moving in a random walk
+const std::vector<level_update>& updates()
+{
+    static const std::vector<level_update> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int> moves(-1, 1);
+        std::uniform_int_distribution<int> offsets(0, 50);
+        std::uniform_int_distribution<int64_t> quantities(0, 3);
+        std::vector<level_update> res;
+        res.reserve(UPDATES);
+        int64_t mid = 1000000;
+        for (std::size_t i = 0; i < UPDATES; ++i) {
+            mid += moves(generator) * 5;
+            res.push_back({decimal4d_t{decimal4d_t::nominator_t{mid - offsets(generator) * 5}}, quantities(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_price_ladder_updates()
+{
+    run_benchmark("std::map level updates", 10, UPDATES, 0, [] {
+        std::map<decimal4d_t, int64_t> levels;
+        for (const auto& update : updates()) {
+            if (update.quantity == 0) {
+                levels.erase(update.price);
+            } else {
+                levels[update.price] = update.quantity;
+            }
+        }
+        do_not_optimize(levels.size());
+    });
+    run_benchmark("strict::price_ladder level updates", 10, UPDATES, 0, [] {
+        strict::price_ladder<decimal4d_t, int64_t> levels(decimal4d_t("0.0005"));
+        for (const auto& update : updates()) {
+            if (update.quantity == 0) {
+                levels.erase(update.price);
+            } else {
+                *levels.insert(update.price) = update.quantity;
+            }
+        }
+        do_not_optimize(levels.size());
+    });
+}
+
+void benchmark_price_ladder_best_price()
+{
+    run_benchmark("std::map updates with best bid", 10, UPDATES, 0, [] {
+        std::map<decimal4d_t, int64_t> levels;
+        int64_t sum = 0;
+        for (const auto& update : updates()) {
+            if (update.quantity == 0) {
+                levels.erase(update.price);
+            } else {
+                levels[update.price] = update.quantity;
+            }
+            sum += levels.empty() ? 0 : levels.rbegin()->first.nominator();
+        }
+        do_not_optimize(sum);
+    });
+    run_benchmark("strict::price_ladder updates with best bid", 10, UPDATES, 0, [] {
+        strict::price_ladder<decimal4d_t, int64_t> levels(decimal4d_t("0.0005"));
+        int64_t sum = 0;
+        for (const auto& update : updates()) {
+            if (update.quantity == 0) {
+                levels.erase(update.price);
+            } else {
+                *levels.insert(update.price) = update.quantity;
+            }
+            sum += levels.empty() ? 0 : levels.highest().nominator();
+        }
+        do_not_optimize(sum);
+    });
+}
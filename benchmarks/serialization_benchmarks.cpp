@@ -0,0 +1,106 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_serialization.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+const std::vector<decimal4d_t>& column()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(-100000000, 100000000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+void benchmark_binary_round_trip(const std::string& name, strict::binary_format format)
+{
+    std::vector<unsigned char> buffer(strict::max_serialized_size<decimal4d_t>(COLUMN_SIZE, format));
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    const std::size_t bytes = strict::serialize<decimal4d_t>(column(), buffer, format).bytes;
+    run_benchmark(name, 20, COLUMN_SIZE, bytes, [&buffer, &decoded, format] {
+        const auto written = strict::serialize<decimal4d_t>(column(), buffer, format);
+        const auto read = strict::deserialize<decimal4d_t>(strict::span<const unsigned char>(buffer.data(), written.bytes), decoded);
+        do_not_optimize(read.count);
+        do_not_optimize(decoded.data());
+    });
+}
+
+}  // namespace
+
+void benchmark_text_round_trip()
+{
+    std::size_t bytes = 0;
+    for (const auto& value : column()) {
+        bytes += value.to_string().size();
+    }
+    std::vector<decimal4d_t> decoded(COLUMN_SIZE);
+    run_benchmark("to_string + string constructor", 3, COLUMN_SIZE, bytes, [&decoded] {
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            decoded[i] = decimal4d_t{column()[i].to_string()};
+        }
+        do_not_optimize(decoded.data());
+    });
+}
+
+void benchmark_fixed_serialization_round_trip()
+{
+    benchmark_binary_round_trip("serialize + deserialize fixed", strict::binary_format::fixed);
+}
+
+void benchmark_compact_serialization_round_trip()
+{
+    benchmark_binary_round_trip("serialize + deserialize compact", strict::binary_format::compact);
+}
@@ -0,0 +1,117 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_sort.hpp"
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 20;
+
+// prices between 50.0000 and 150.0000
+const std::vector<decimal4d_t>& prices()
+{
+    static const std::vector<decimal4d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> distribution(500000, 1500000);
+        std::vector<decimal4d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal4d_t::nominator_t{distribution(generator)});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_radix_sort()
+{
+    std::vector<decimal4d_t> values;
+    run_benchmark("std::sort", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&values] {
+        values = prices();
+        std::sort(values.begin(), values.end());
+        do_not_optimize(values.data());
+    });
+    run_benchmark("strict::radix_sort", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&values] {
+        values = prices();
+        strict::radix_sort<decimal4d_t>(values);
+        do_not_optimize(values.data());
+    });
+}
+
+void benchmark_argsort()
+{
+    std::vector<std::size_t> indices(COLUMN_SIZE);
+    run_benchmark("std::stable_sort of indices", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&indices] {
+        std::iota(indices.begin(), indices.end(), std::size_t{0});
+        std::stable_sort(indices.begin(), indices.end(), [](std::size_t lhs, std::size_t rhs) { return prices()[lhs] < prices()[rhs]; });
+        do_not_optimize(indices.data());
+    });
+    run_benchmark("strict::argsort", 10, COLUMN_SIZE, COLUMN_SIZE * sizeof(decimal4d_t), [&indices] {
+        strict::argsort<decimal4d_t>(prices(), indices);
+        do_not_optimize(indices.data());
+    });
+}
+
+void benchmark_lower_bound()
+{
+    std::vector<decimal4d_t> sorted = prices();
+    strict::radix_sort<decimal4d_t>(sorted);
+    const std::vector<decimal4d_t> keys(prices().begin(), prices().begin() + 100000);
+    std::vector<std::size_t> indices(keys.size());
+    run_benchmark("std::lower_bound", 20, keys.size(), 0, [&sorted, &keys, &indices] {
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            indices[i] = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), keys[i]) - sorted.begin());
+        }
+        do_not_optimize(indices.data());
+    });
+    run_benchmark("strict::lower_bound", 20, keys.size(), 0, [&sorted, &keys, &indices] {
+        strict::lower_bound<decimal4d_t>(sorted, keys, indices);
+        do_not_optimize(indices.data());
+    });
+}
@@ -0,0 +1,126 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_statistics.hpp"
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+
+namespace
+{
+
+constexpr std::size_t COLUMN_SIZE = 1 << 22;
+constexpr std::size_t BYTES = COLUMN_SIZE * sizeof(decimal2d_t);
+const std::vector<double> PERCENTILES{0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+
+const std::vector<decimal2d_t>& pnl()
+{
+    static const std::vector<decimal2d_t> values = [] {
+        std::mt19937_64 generator(42);
+        std::normal_distribution<double> distribution(0, 100000000);
+        std::vector<decimal2d_t> res;
+        res.reserve(COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; ++i) {
+            res.emplace_back(decimal2d_t::nominator_t{static_cast<int64_t>(distribution(generator))});
+        }
+        return res;
+    }();
+    return values;
+}
+
+}  // namespace
+
+void benchmark_quantiles()
+{
+    std::vector<decimal2d_t> results(PERCENTILES.size());
+    run_benchmark("7 percentiles with doubles and std::nth_element", 5, COLUMN_SIZE, BYTES, [&results] {
+        std::vector<double> values;
+        values.reserve(COLUMN_SIZE);
+        for (const auto& value : pnl()) {
+            values.push_back(static_cast<double>(value.nominator()) / 100);
+        }
+        for (std::size_t idx = 0; idx < PERCENTILES.size(); ++idx) {
+            const auto nth = values.begin() + static_cast<std::ptrdiff_t>(std::ceil(PERCENTILES[idx] * COLUMN_SIZE) - 1);
+            std::nth_element(values.begin(), nth, values.end());
+            results[idx] = decimal2d_t(decimal2d_t::nominator_t{static_cast<int64_t>(std::llround(*nth * 100))});
+        }
+        do_not_optimize(results.data());
+    });
+    run_benchmark("7 percentiles with strict::quantiles", 5, COLUMN_SIZE, BYTES, [&results] {
+        strict::quantiles<decimal2d_t>(pnl(), PERCENTILES, results);
+        do_not_optimize(results.data());
+    });
+}
+
+void benchmark_histogram()
+{
+    const decimal2d_t low("-5000000");
+    const decimal2d_t width("1000.01");
+    std::vector<uint64_t> counts(10000);
+    run_benchmark("histogram with integer division", 10, COLUMN_SIZE, BYTES, [&low, &width, &counts] {
+        std::fill(counts.begin(), counts.end(), 0);
+        for (const auto& value : pnl()) {
+            const int64_t offset = value.nominator() - low.nominator();
+            const int64_t bucket = offset / width.nominator();
+            if (offset >= 0 && bucket < static_cast<int64_t>(counts.size())) {
+                ++counts[static_cast<std::size_t>(bucket)];
+            }
+        }
+        do_not_optimize(counts.data());
+    });
+    run_benchmark("strict::histogram", 10, COLUMN_SIZE, BYTES, [&low, &width, &counts] {
+        std::fill(counts.begin(), counts.end(), 0);
+        do_not_optimize(strict::histogram<decimal2d_t>(pnl(), low, width, counts).above);
+    });
+}
+
+void benchmark_quantile_sketch()
+{
+    run_benchmark("strict::quantile_sketch::add", 5, COLUMN_SIZE, BYTES, [] {
+        strict::quantile_sketch<decimal2d_t> sketch;
+        for (const auto& value : pnl()) {
+            sketch.add(value);
+        }
+        do_not_optimize(sketch.quantile(0.99));
+    });
+}
@@ -0,0 +1,133 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_window.hpp"
+#include "benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using quantity_t = strict::decimal_t<int64_t, 2>;
+
+namespace
+{
+
+constexpr std::size_t SERIES_SIZE = 1 << 20;
+constexpr std::size_t WINDOW = 100;
+
+template<typename DecimalT>
+std::vector<DecimalT> generate(int64_t low, int64_t high)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> distribution(low, high);
+    std::vector<DecimalT> res;
+    res.reserve(SERIES_SIZE);
+    for (std::size_t i = 0; i < SERIES_SIZE; ++i) {
+        res.emplace_back(typename DecimalT::nominator_t{distribution(generator)});
+    }
+    return res;
+}
+
+const std::vector<decimal4d_t>& prices()
+{
+    static const std::vector<decimal4d_t> values = generate<decimal4d_t>(500000, 1500000);
+    return values;
+}
+
+const std::vector<quantity_t>& quantities()
+{
+    static const std::vector<quantity_t> values = generate<quantity_t>(1, 1000000);
+    return values;
+}
+
+}  // namespace
+
+void benchmark_prefix_sum()
+{
+    std::vector<decimal4d_t> sums(SERIES_SIZE);
+    run_benchmark("prefix sum with operator+=", 20, SERIES_SIZE, SERIES_SIZE * sizeof(decimal4d_t), [&sums] {
+        decimal4d_t sum;
+        for (std::size_t i = 0; i < SERIES_SIZE; ++i) {
+            sum += prices()[i];
+            sums[i] = sum;
+        }
+        do_not_optimize(sums.data());
+    });
+    run_benchmark("strict::prefix_sum", 20, SERIES_SIZE, SERIES_SIZE * sizeof(decimal4d_t), [&sums] {
+        strict::prefix_sum<decimal4d_t>(prices(), sums);
+        do_not_optimize(sums.data());
+    });
+}
+
+void benchmark_rolling_mean()
+{
+    std::vector<decimal4d_t> means(SERIES_SIZE);
+    run_benchmark("rolling mean recomputing windows", 5, SERIES_SIZE, SERIES_SIZE * sizeof(decimal4d_t), [&means] {
+        for (std::size_t i = 0; i < SERIES_SIZE; ++i) {
+            const std::size_t first = i + 1 >= WINDOW ? i + 1 - WINDOW : 0;
+            decimal4d_t sum;
+            for (std::size_t j = first; j <= i; ++j) {
+                sum += prices()[j];
+            }
+            means[i] = sum / strict::decimal_t<int64_t, 0>(static_cast<int64_t>(i + 1 - first));
+        }
+        do_not_optimize(means.data());
+    });
+    run_benchmark("strict::rolling_mean", 20, SERIES_SIZE, SERIES_SIZE * sizeof(decimal4d_t), [&means] {
+        strict::rolling_mean<decimal4d_t>(prices(), WINDOW, means);
+        do_not_optimize(means.data());
+    });
+}
+
+void benchmark_vwap()
+{
+    const std::size_t bytes = SERIES_SIZE * (sizeof(decimal4d_t) + sizeof(quantity_t));
+    run_benchmark("vwap with operator* and operator/", 20, SERIES_SIZE, bytes, [] {
+        decimal4d_t notional;
+        quantity_t quantity;
+        for (std::size_t i = 0; i < SERIES_SIZE; ++i) {
+            notional += prices()[i] * quantities()[i];
+            quantity += quantities()[i];
+        }
+        do_not_optimize(notional / quantity);
+    });
+    run_benchmark("strict::vwap", 20, SERIES_SIZE, bytes, [] {
+        do_not_optimize(strict::vwap<decimal4d_t, quantity_t>(prices(), quantities()));
+    });
+}
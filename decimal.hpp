@@ -38,13 +38,24 @@
  */
 #pragma once
 
+#include "decimal_instrumentation.hpp"
+
 #include <algorithm>
+#include <charconv>
 #include <cmath>
+#if defined(__cpp_impl_three_way_comparison) && __has_include(<compare>)
+#include <compare>
+#endif
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <system_error>
 #include <iostream>
 
 namespace strict
@@ -94,6 +105,160 @@ struct select_operating_type
 template<typename LhsT, typename RhsT>
 using select_operating_type_t = typename select_operating_type<LhsT, RhsT>::type;
 
+namespace detail
+{
+
+// Two ASCII digits for every value in range [0, 100), used to emit digits in pairs
+inline constexpr char DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline constexpr uint64_t POWERS_OF_10_U64[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+// Number of decimal digits of `value`, 1 for 0. Values of up to 64 bits take a count of leading zeros and one table
+// lookup: a value of `bits` significant bits has floor(bits * log10(2)) or one more digits, where
+// 1233 / 4096 approximates log10(2) closely enough for all 64 bit values.
+template<typename UnsignedT>
+constexpr int count_digits(UnsignedT value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(UnsignedT) <= sizeof(uint64_t)) {
+        const uint64_t wide = static_cast<uint64_t>(value) | 1;
+        const int digits = ((64 - __builtin_clzll(wide)) * 1233) >> 12;
+        return digits + (wide >= POWERS_OF_10_U64[digits] ? 1 : 0);
+    }
+#endif
+    int digits = 1;
+    for (;;) {
+        if (value < 10) return digits;
+        if (value < 100) return digits + 1;
+        if (value < 1000) return digits + 2;
+        if (value < 10000) return digits + 3;
+        value /= 10000;
+        digits += 4;
+    }
+}
+
+// Writes exactly `count` digits of `value` (zero padded) backwards, ending at `last`.
+// Returns pointer to the first written character.
+template<typename UnsignedT>
+inline char* write_digits_backward(char* last, UnsignedT value, int count) noexcept {
+    for (; count >= 2; count -= 2) {
+        last -= 2;
+        std::memcpy(last, DIGIT_PAIRS + static_cast<int>(value % 100) * 2, 2);
+        value /= 100;
+    }
+    if (count) {
+        *--last = static_cast<char>('0' + static_cast<int>(value % 10));
+    }
+    return last;
+}
+
+// Finalizer of MurmurHash3: every bit of the nominator affects every bit of the hash, so nominators on a tick grid
+// (multiples of 5, 10, ...) are spread evenly over buckets
+constexpr uint64_t hash_nominator(uint64_t value) noexcept {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+// True during constant evaluation, lets constexpr functions skip runtime only work such as instrumentation
+constexpr bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+// std::abs is not constexpr before C++23
+template<typename T>
+constexpr T abs(T value) noexcept {
+    if constexpr (std::is_unsigned<T>::value) {
+        return value;
+    } else {
+        return value < 0 ? -value : value;
+    }
+}
+
+// std::round converted to an integer, rounds half away from zero; std::round is not constexpr before C++23
+template<typename IntegerT, typename FloatingT>
+constexpr IntegerT round_to_integer(FloatingT value) noexcept {
+    const IntegerT truncated = static_cast<IntegerT>(value);
+    const FloatingT fraction = value - static_cast<FloatingT>(truncated);
+    return truncated + (fraction >= FloatingT(0.5) ? 1 : fraction <= FloatingT(-0.5) ? -1 : 0);
+}
+
+// True if the result of the operation does not fit in T, used by instrumentation. `res` receives the result
+// wrapped around modulo 2^N, so that it is available without executing signed overflow.
+template<typename T>
+constexpr bool add_overflows(T lhs, T rhs, T& res) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(lhs, rhs, &res);
+#else
+    using UnsignedT = std::make_unsigned_t<T>;
+    res = static_cast<T>(static_cast<UnsignedT>(lhs) + static_cast<UnsignedT>(rhs));
+    return rhs > 0 ? lhs > std::numeric_limits<T>::max() - rhs : lhs < std::numeric_limits<T>::min() - rhs;
+#endif
+}
+
+template<typename T>
+constexpr bool subtract_overflows(T lhs, T rhs, T& res) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(lhs, rhs, &res);
+#else
+    using UnsignedT = std::make_unsigned_t<T>;
+    res = static_cast<T>(static_cast<UnsignedT>(lhs) - static_cast<UnsignedT>(rhs));
+    return rhs < 0 ? lhs > std::numeric_limits<T>::max() + rhs : lhs < std::numeric_limits<T>::min() + rhs;
+#endif
+}
+
+template<typename T>
+constexpr bool multiply_overflows(T lhs, T rhs, T& res) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(lhs, rhs, &res);
+#else
+    using UnsignedT = std::make_unsigned_t<T>;
+    res = static_cast<T>(static_cast<UnsignedT>(lhs) * static_cast<UnsignedT>(rhs));
+    return lhs != 0 && ((lhs == -1 && rhs == std::numeric_limits<T>::min()) || (rhs == -1 && lhs == std::numeric_limits<T>::min()) ||
+                        res / lhs != rhs);
+#endif
+}
+
+// Largest magnitude of a nominator of the given sign which parsing may produce; with non zero precision nominators
+// reserved for nan and infinities are excluded
+template<typename DecimalT>
+constexpr std::make_unsigned_t<typename DecimalT::underlying_type> max_parsed_magnitude(bool negative) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    constexpr bool SENTINELS = DecimalT::PRECISION != 0;
+    const UnderlyingType limit = negative ? (SENTINELS ? DecimalT::INFINITY_MINUS + 1 : std::numeric_limits<UnderlyingType>::min())
+                                          : (SENTINELS ? DecimalT::INFINITY_PLUS - 1 : std::numeric_limits<UnderlyingType>::max());
+    return negative ? static_cast<UnsignedT>(UnsignedT{0} - static_cast<UnsignedT>(limit)) : static_cast<UnsignedT>(limit);
+}
+
+}  // namespace detail
+
+// Layout contract of decimals: a decimal consists of its nominator only, is trivially copyable and has standard
+// layout, so arrays of decimals can be copied with memcpy, relocated by containers without calling constructors
+// and mapped from files
+template<typename DecimalT>
+inline constexpr bool has_nominator_layout_v =
+    std::is_trivially_copyable<DecimalT>::value && std::is_standard_layout<DecimalT>::value &&
+    sizeof(DecimalT) == sizeof(typename DecimalT::underlying_type) && alignof(DecimalT) == alignof(typename DecimalT::underlying_type);
+
 template<typename UnderlyingType = int64_t, int Precision = 2>
 struct decimal_t
 {
@@ -104,13 +269,19 @@ struct decimal_t
     static constexpr UnderlyingType NAN_VALUE = std::numeric_limits<UnderlyingType>::max();
     static constexpr UnderlyingType INFINITY_PLUS = std::numeric_limits<UnderlyingType>::max() - 1;
     static constexpr UnderlyingType INFINITY_MINUS = std::numeric_limits<UnderlyingType>::min() + 1;
+    // Buffer size sufficient for any value written by to_chars(): sign, digits, dot
+    static constexpr int MAX_STRING_LENGTH =
+        std::max(std::numeric_limits<std::make_unsigned_t<UnderlyingType>>::digits10 + 1, PRECISION + 1) + 2;
 
     struct nominator_t { UnderlyingType value{}; };
 
-    explicit decimal_t() : mNominator{} {
+    constexpr decimal_t() noexcept : mNominator{} {
     }
 
     explicit decimal_t(std::string num) {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            detail::record_string(num.size());
+        }
         UnderlyingType integerPart{}, fractionPart{};
         char dotPlaceholder;
         std::istringstream ss(num);
@@ -129,97 +300,149 @@ struct decimal_t
 
     template<typename FloatingT,
              std::enable_if_t<std::is_floating_point<FloatingT>::value, bool> = true>
-    explicit decimal_t(FloatingT num) {
-        const UnderlyingType temp = static_cast<UnderlyingType>(std::round(num * DENOMINATOR * 10));
-        const int lastDigit = std::abs(temp) % 10;
+    constexpr explicit decimal_t(FloatingT num) noexcept {
+        const UnderlyingType temp = detail::round_to_integer<UnderlyingType>(num * DENOMINATOR * 10);
+        const int lastDigit = static_cast<int>(detail::abs(temp) % 10);
         underlying_type signFactor = temp >=0 ? 1 : -1;
         mNominator.value = static_cast<UnderlyingType>(temp / 10);
         mNominator.value += lastDigit >= 5 ? signFactor : 0;
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const FloatingT scaled = num * DENOMINATOR;
+            record(&instrumentation_counters::parses, mNominator.value, scaled != static_cast<FloatingT>(static_cast<UnderlyingType>(scaled)),
+                   !(detail::abs(scaled) < static_cast<FloatingT>(std::numeric_limits<UnderlyingType>::max())));
+        }
     }
 
     template<typename IntegralT,
              std::enable_if_t<std::is_integral<IntegralT>::value, bool> = true>
-    explicit decimal_t(IntegralT num) {
+    constexpr explicit decimal_t(IntegralT num) noexcept {
         mNominator.value = static_cast<UnderlyingType>(num * DENOMINATOR);
     }
 
-    explicit decimal_t(typename decimal_t<UnderlyingType, PRECISION>::nominator_t nominator) : mNominator(nominator) {
+    constexpr explicit decimal_t(typename decimal_t<UnderlyingType, PRECISION>::nominator_t nominator) noexcept : mNominator(nominator) {
+        static_assert(has_nominator_layout_v<decimal_t>, "decimal must consist of its nominator only");
     }
 
-    explicit decimal_t(UnderlyingType integerPart, UnderlyingType fractionPart) {
-        int fractionLength = static_cast<int>(std::log10(fractionPart)) + 1;
+    constexpr explicit decimal_t(UnderlyingType integerPart, UnderlyingType fractionPart) noexcept {
+        int fractionLength = detail::count_digits(static_cast<std::make_unsigned_t<UnderlyingType>>(fractionPart));
+        bool rounded = false;
         if (fractionLength > PRECISION) {
-            int lastSignificantDigit = fractionPart / Power10<UnderlyingType>(fractionLength - PRECISION -1) % 10;
+            int lastSignificantDigit = static_cast<int>(fractionPart / Power10<UnderlyingType>(fractionLength - PRECISION -1) % 10);
+            rounded = fractionPart % Power10<UnderlyingType>(fractionLength - PRECISION) != 0;
             fractionPart = fractionPart / Power10<UnderlyingType>(fractionLength - PRECISION) + (lastSignificantDigit >= 5 ? 1 : 0);
         }
         mNominator.value = integerPart * DENOMINATOR + (integerPart >= 0 ? fractionPart : -fractionPart);
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            UnderlyingType scaled{};
+            record(&instrumentation_counters::parses, mNominator.value, rounded, detail::multiply_overflows(integerPart, DENOMINATOR, scaled));
+        }
     }
 
-    UnderlyingType nominator() const { return mNominator.value; }
-    UnderlyingType integer_part() const { return mNominator.value / DENOMINATOR; }
-    UnderlyingType fraction_part() const { return std::abs(mNominator.value) % DENOMINATOR; }
+    constexpr UnderlyingType nominator() const noexcept { return mNominator.value; }
+    constexpr UnderlyingType integer_part() const noexcept { return mNominator.value / DENOMINATOR; }
+    constexpr UnderlyingType fraction_part() const noexcept { return detail::abs(mNominator.value) % DENOMINATOR; }
 
-    constexpr bool operator<(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value < other.mNominator.value; }
-    constexpr bool operator<=(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value <= other.mNominator.value; }
-    constexpr bool operator==(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value == other.mNominator.value; }
-    constexpr bool operator!=(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value != other.mNominator.value; }
-    constexpr bool operator>=(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value >= other.mNominator.value; }
-    constexpr bool operator>(const decimal_t<underlying_type, PRECISION>& other) const { return mNominator.value > other.mNominator.value; }
+    constexpr bool operator<(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value < other.mNominator.value; }
+    constexpr bool operator<=(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value <= other.mNominator.value; }
+    constexpr bool operator==(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value == other.mNominator.value; }
+    constexpr bool operator!=(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value != other.mNominator.value; }
+    constexpr bool operator>=(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value >= other.mNominator.value; }
+    constexpr bool operator>(const decimal_t<underlying_type, PRECISION>& other) const noexcept { return mNominator.value > other.mNominator.value; }
 
-    decimal_t<underlying_type, PRECISION> operator+(const decimal_t<underlying_type, PRECISION>& rhs) const {
+    constexpr decimal_t<underlying_type, PRECISION> operator+(const decimal_t<underlying_type, PRECISION>& rhs) const noexcept {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            UnderlyingType res{};
+            const bool overflow = detail::add_overflows(mNominator.value, rhs.mNominator.value, res);
+            record(&instrumentation_counters::additions, res, false, overflow);
+            return decimal_t<UnderlyingType, PRECISION>{nominator_t{res}};
+        }
         return decimal_t<UnderlyingType, PRECISION>{nominator_t{mNominator.value + rhs.mNominator.value}};
     }
-    decimal_t<underlying_type, PRECISION> operator-(const decimal_t<underlying_type, PRECISION>& rhs) const {
+    constexpr decimal_t<underlying_type, PRECISION> operator-(const decimal_t<underlying_type, PRECISION>& rhs) const noexcept {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            UnderlyingType res{};
+            const bool overflow = detail::subtract_overflows(mNominator.value, rhs.mNominator.value, res);
+            record(&instrumentation_counters::additions, res, false, overflow);
+            return decimal_t<UnderlyingType, PRECISION>{nominator_t{res}};
+        }
         return decimal_t<UnderlyingType, PRECISION>{nominator_t{mNominator.value - rhs.mNominator.value}};
     }
-    decimal_t<underlying_type, PRECISION> operator-() const {
+    constexpr decimal_t<underlying_type, PRECISION> operator-() const noexcept {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            UnderlyingType res{};
+            const bool overflow = detail::subtract_overflows(UnderlyingType{0}, mNominator.value, res);
+            record(&instrumentation_counters::additions, res, false, overflow);
+            return decimal_t<UnderlyingType, PRECISION>{nominator_t{res}};
+        }
         return decimal_t<UnderlyingType, PRECISION>{nominator_t{-mNominator.value}};
     }
-    decimal_t<underlying_type, PRECISION> operator*(const decimal_t<underlying_type, PRECISION>& rhs) const {
+    constexpr decimal_t<underlying_type, PRECISION> operator*(const decimal_t<underlying_type, PRECISION>& rhs) const noexcept {
         using this_type = decimal_t<underlying_type, PRECISION>;
-        underlying_type res = mNominator.value * rhs.mNominator.value;
+        underlying_type res{};
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const bool overflow = detail::multiply_overflows(mNominator.value, rhs.mNominator.value, res);
+            record_multiplication(res, overflow);
+        } else {
+            res = mNominator.value * rhs.mNominator.value;
+        }
         if constexpr (PRECISION == 0) {
             return this_type{nominator_t{res}};
         } else {
-            underlying_type fractionPart = std::abs(res) % DENOMINATOR;
+            underlying_type fractionPart = detail::abs(res) % DENOMINATOR;
             underlying_type signFactor = res >= 0 ? 1 : -1;
             return this_type{nominator_t{res / DENOMINATOR + (fractionPart >= HALF_DENOMINATOR ? signFactor : 0)}};
         }
     }
     template<typename RhsUnderlyingType, int RhsPrecision>
-    decimal_t<underlying_type, PRECISION> operator*(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const {
+    constexpr decimal_t<underlying_type, PRECISION> operator*(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const noexcept {
         decimal_t<underlying_type, PRECISION> res = *this;
         res *= rhs;
         return res;
     }
     template<typename RhsUnderlyingType, int RhsPrecision>
-    decimal_t<underlying_type, PRECISION> operator/(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const {
+    constexpr decimal_t<underlying_type, PRECISION> operator/(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const noexcept {
         decimal_t<underlying_type, PRECISION> res = *this;
         res /= rhs;
         return res;
     }
-    decimal_t<underlying_type, PRECISION>& operator+=(const decimal_t<underlying_type, PRECISION>& rhs) {
+    constexpr decimal_t<underlying_type, PRECISION>& operator+=(const decimal_t<underlying_type, PRECISION>& rhs) noexcept {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const bool overflow = detail::add_overflows(mNominator.value, rhs.mNominator.value, mNominator.value);
+            record(&instrumentation_counters::additions, mNominator.value, false, overflow);
+            return *this;
+        }
         mNominator.value += rhs.mNominator.value;
         return *this;
     }
-    decimal_t<underlying_type, PRECISION>& operator-=(const decimal_t<underlying_type, PRECISION>& rhs) {
+    constexpr decimal_t<underlying_type, PRECISION>& operator-=(const decimal_t<underlying_type, PRECISION>& rhs) noexcept {
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const bool overflow = detail::subtract_overflows(mNominator.value, rhs.mNominator.value, mNominator.value);
+            record(&instrumentation_counters::additions, mNominator.value, false, overflow);
+            return *this;
+        }
         mNominator.value -= rhs.mNominator.value;
         return *this;
     }
-    decimal_t<underlying_type, PRECISION>& operator*=(const decimal_t<underlying_type, PRECISION>& rhs) {
-        underlying_type res = mNominator.value * rhs.mNominator.value;
+    constexpr decimal_t<underlying_type, PRECISION>& operator*=(const decimal_t<underlying_type, PRECISION>& rhs) noexcept {
+        underlying_type res{};
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const bool overflow = detail::multiply_overflows(mNominator.value, rhs.mNominator.value, res);
+            record_multiplication(res, overflow);
+        } else {
+            res = mNominator.value * rhs.mNominator.value;
+        }
         if constexpr (PRECISION == 0) {
-            mNominator.value = mNominator.value * rhs.mNominator.value;
+            mNominator.value = res;
         } else {
-            underlying_type fractionPart = std::abs(res) % DENOMINATOR;
+            underlying_type fractionPart = detail::abs(res) % DENOMINATOR;
             underlying_type signFactor = res >= 0 ? 1 : -1;
-            mNominator.value = mNominator.value * rhs.mNominator.value / DENOMINATOR + (fractionPart >= HALF_DENOMINATOR ? signFactor : 0);
+            mNominator.value = res / DENOMINATOR + (fractionPart >= HALF_DENOMINATOR ? signFactor : 0);
         }
         return *this;
     }
 
     template<typename RhsUnderlyingType, int RhsDecimalPrecision>
-    decimal_t<underlying_type, PRECISION>& operator*=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) {
+    constexpr decimal_t<underlying_type, PRECISION>& operator*=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) noexcept {
         using OperatingType = select_operating_type_t<underlying_type, RhsUnderlyingType>;
         const OperatingType integerPart = static_cast<OperatingType>(this->integer_part());
         OperatingType fractionPart = static_cast<OperatingType>(this->fraction_part());
@@ -232,123 +455,205 @@ struct decimal_t
         fractionPart *= Power10<OperatingType>(CommonPrecision) / DENOMINATOR;
         rhsFractionPart *= Power10<OperatingType>(CommonPrecision) / static_cast<underlying_type>(std::decay_t<decltype(rhs)>::DENOMINATOR);
 
-        OperatingType resultInteger = std::abs(integerPart * rhsIntegerPart);
+        OperatingType resultInteger = detail::abs(integerPart * rhsIntegerPart);
         underlying_type signFactor = integerPart * rhsIntegerPart >= 0 ? 1 : -1;
         // commonFraction has denominator equal to commonDenominator
-        OperatingType commonFraction = std::abs(integerPart) * rhsFractionPart + fractionPart * std::abs(rhsIntegerPart);
+        OperatingType commonFraction = detail::abs(integerPart) * rhsFractionPart + fractionPart * detail::abs(rhsIntegerPart);
         resultInteger += commonFraction / Power10<OperatingType>(CommonPrecision);
         commonFraction %= Power10<OperatingType>(CommonPrecision);
         // from now on denominator of commonFraction equals commonDenominator*commonDenominator
         commonFraction *= Power10<OperatingType>(CommonPrecision);
         commonFraction += fractionPart * rhsFractionPart;
         // from now on commonFraction is treated as if its denominator is equal Power10<underlying_type>(PRECISION + 1);
-        commonFraction /= Power10<OperatingType>(CommonPrecision + CommonPrecision - PRECISION - 1);
+        const OperatingType discardedDivisor = Power10<OperatingType>(CommonPrecision + CommonPrecision - PRECISION - 1);
+        bool rounded = commonFraction % discardedDivisor != 0;
+        commonFraction /= discardedDivisor;
+        rounded = rounded || commonFraction % 10 != 0;
         const int lastSignificantDigit = commonFraction % 10;
         commonFraction /= 10;
         commonFraction += lastSignificantDigit >= 5 ? 1 : 0;
 
         mNominator.value = static_cast<underlying_type>(resultInteger * DENOMINATOR + commonFraction);
         mNominator.value *= signFactor;
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            const bool overflow = resultInteger > static_cast<OperatingType>(std::numeric_limits<underlying_type>::max() / DENOMINATOR);
+            record(&instrumentation_counters::multiplications, mNominator.value, rounded, overflow);
+        }
         return *this;
     }
 
     template <typename RhsUnderlyingType, int RhsPrecision, std::enable_if_t<PRECISION != RhsPrecision, bool> = true>
-    decimal_t<underlying_type, PRECISION>& operator/=(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs)
+    constexpr decimal_t<underlying_type, PRECISION>& operator/=(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) noexcept
     {
         if (mNominator.value == 0 && rhs.nominator() == 0) {
             mNominator.value = NAN_VALUE;
+            if constexpr (INSTRUMENTATION_ENABLED) {
+                record(&instrumentation_counters::divisions, mNominator.value, false, false);
+            }
             return *this;
         }
         if (rhs.nominator() == 0) {
             mNominator.value = mNominator.value >= 0 ? INFINITY_PLUS : INFINITY_MINUS;
+            if constexpr (INSTRUMENTATION_ENABLED) {
+                record(&instrumentation_counters::divisions, mNominator.value, false, false);
+            }
             return *this;
         }
 
         using OperationType = select_operating_type_t<underlying_type, RhsUnderlyingType>;
         OperationType res = static_cast<OperationType>(mNominator.value);
         res *= Power10<OperationType>(RhsPrecision+1);
+        const bool inexact = res % static_cast<OperationType>(rhs.nominator()) != 0;
         res /= static_cast<OperationType>(rhs.nominator());
         OperationType signFactor = res >= 0 ? 1 : -1;
-        int lastSignificantDigit = std::abs(res) % 10;
+        int lastSignificantDigit = detail::abs(res) % 10;
         res /= 10;
         res += lastSignificantDigit >= 5 ? signFactor : 0;
         mNominator.value = static_cast<UnderlyingType>(res);
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            record(&instrumentation_counters::divisions, mNominator.value, inexact || lastSignificantDigit != 0,
+                   static_cast<OperationType>(mNominator.value) != res);
+        }
         return *this;
     }
 
     template <typename RhsUnderlyingType>
-    decimal_t<underlying_type, PRECISION>& operator/=(const decimal_t<RhsUnderlyingType, PRECISION>& rhs)
+    constexpr decimal_t<underlying_type, PRECISION>& operator/=(const decimal_t<RhsUnderlyingType, PRECISION>& rhs) noexcept
     {
         if (mNominator.value == 0 && rhs.nominator() == 0) {
             mNominator.value = NAN_VALUE;
+            if constexpr (INSTRUMENTATION_ENABLED) {
+                record(&instrumentation_counters::divisions, mNominator.value, false, false);
+            }
             return *this;
         }
         if (rhs.nominator() == 0) {
             mNominator.value = mNominator.value >= 0 ? INFINITY_PLUS : INFINITY_MINUS;
+            if constexpr (INSTRUMENTATION_ENABLED) {
+                record(&instrumentation_counters::divisions, mNominator.value, false, false);
+            }
             return *this;
         }
 
         using OperationType = select_operating_type_t<underlying_type, RhsUnderlyingType>;
-        OperationType integerPart = std::abs(integer_part()) * Power10<OperationType>(PRECISION + 1);
+        OperationType integerPart = detail::abs(integer_part()) * Power10<OperationType>(PRECISION + 1);
         OperationType fractionPart = fraction_part() * Power10<OperationType>(1);
 
         OperationType signFactor = std::clamp<OperationType>(nominator(), -1, 1) * std::clamp<OperationType>(rhs.nominator(), -1, 1);
 
-        integerPart = static_cast<OperationType>(std::llround(1.0 * integerPart / std::fabs(rhs.to_double())));
-        fractionPart = static_cast<OperationType>(std::llround(1.0 * fractionPart / std::fabs(rhs.to_double())));
+        integerPart = static_cast<OperationType>(detail::round_to_integer<long long>(1.0 * integerPart / detail::abs(rhs.to_double())));
+        fractionPart = static_cast<OperationType>(detail::round_to_integer<long long>(1.0 * fractionPart / detail::abs(rhs.to_double())));
 
         OperationType res = integerPart + fractionPart;
-        int lastSignificantDigit = std::abs(res) % 10;
+        int lastSignificantDigit = detail::abs(res) % 10;
         res /= 10;
         res *= signFactor;
         res += lastSignificantDigit >= 5 ? signFactor : 0;
         mNominator.value = static_cast<UnderlyingType>(res);
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            record(&instrumentation_counters::divisions, mNominator.value, lastSignificantDigit != 0,
+                   static_cast<OperationType>(mNominator.value) != res);
+        }
         return *this;
     }
 
+    // Formats through a stack buffer, so that no string is allocated; stream width and fill apply to the whole text
     friend std::ostream& operator<<(std::ostream& out, const decimal_t<underlying_type, PRECISION>& decimal) {
-        out << decimal.to_string();
+        char buffer[MAX_STRING_LENGTH];
+        out << std::string_view(buffer, static_cast<std::size_t>(decimal.to_chars(buffer) - buffer));
         return out;
     }
 
-    float to_float() const {
+    constexpr float to_float() const noexcept {
         switch (mNominator.value)
         {
-        case NAN_VALUE: return std::nanf("");
+        case NAN_VALUE: return std::numeric_limits<float>::quiet_NaN();
         case INFINITY_PLUS: return std::numeric_limits<float>::infinity();
         case INFINITY_MINUS: return -std::numeric_limits<float>::infinity();
         default: return static_cast<float>(mNominator.value) / DENOMINATOR;
         }
     }
-    double to_double() const {
+    constexpr double to_double() const noexcept {
         switch (mNominator.value)
         {
-        case NAN_VALUE: return std::nan("");
+        case NAN_VALUE: return std::numeric_limits<double>::quiet_NaN();
         case INFINITY_PLUS: return std::numeric_limits<double>::infinity();
         case INFINITY_MINUS: return -std::numeric_limits<double>::infinity();
         default: return static_cast<double>(mNominator.value) / DENOMINATOR;
         }
     }
 
-    std::string to_string() const {
-        if constexpr (PRECISION == 0) {
-            return std::to_string(mNominator.value);
-        } else {
+    // Writes textual representation to the buffer which has to hold at least MAX_STRING_LENGTH characters.
+    // Returns pointer past the last written character. No terminating null character is written.
+    char* to_chars(char* first) const noexcept {
+        using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            ++detail::thread_counters().formats;
+        }
+        if constexpr (PRECISION != 0) {
             switch (mNominator.value)
             {
-            case NAN_VALUE: return std::string("nan");
-            case INFINITY_PLUS: return std::string("inf");
-            case INFINITY_MINUS: return std::string("-inf");
-            default:
-                std::stringstream ss;
-                ss << integer_part() << '.' << std::setfill('0') << std::setw(PRECISION) << fraction_part();
-                return ss.str();
+            case NAN_VALUE: std::memcpy(first, "nan", 3); return first + 3;
+            case INFINITY_PLUS: std::memcpy(first, "inf", 3); return first + 3;
+            case INFINITY_MINUS: std::memcpy(first, "-inf", 4); return first + 4;
+            default: break;
+            }
+        }
+        UnsignedT magnitude = static_cast<UnsignedT>(mNominator.value);
+        if constexpr (std::is_signed<UnderlyingType>::value) {
+            if (mNominator.value < 0) {
+                *first++ = '-';
+                magnitude = static_cast<UnsignedT>(UnsignedT{0} - magnitude);
             }
         }
+        if constexpr (PRECISION == 0) {
+            const int digits = detail::count_digits(magnitude);
+            detail::write_digits_backward(first + digits, magnitude, digits);
+            return first + digits;
+        } else {
+            const UnsignedT integerPart = magnitude / static_cast<UnsignedT>(DENOMINATOR);
+            const UnsignedT fractionPart = magnitude % static_cast<UnsignedT>(DENOMINATOR);
+            const int integerDigits = detail::count_digits(integerPart);
+            char* last = first + integerDigits + 1 + PRECISION;
+            detail::write_digits_backward(last, fractionPart, PRECISION);
+            first[integerDigits] = '.';
+            detail::write_digits_backward(first + integerDigits, integerPart, integerDigits);
+            return last;
+        }
+    }
+
+    std::string to_string() const {
+        char buffer[MAX_STRING_LENGTH];
+        char* last = to_chars(buffer);
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            detail::record_string(static_cast<std::size_t>(last - buffer));
+        }
+        return std::string(buffer, last);
     }
 
 protected:
     nominator_t mNominator{};
+
+private:
+    static constexpr void record(uint64_t instrumentation_counters::*counter, UnderlyingType result, bool rounded, bool overflow) noexcept {
+        if (detail::is_constant_evaluated()) {
+            return;
+        }
+        bool special = false;
+        if constexpr (PRECISION != 0) {
+            special = result == NAN_VALUE || result == INFINITY_PLUS;
+            if constexpr (std::is_signed<UnderlyingType>::value) {
+                special = special || result == INFINITY_MINUS;
+            }
+        }
+        detail::record_operation(counter, rounded, overflow, special);
+    }
+
+    // Same precision product before scaling back by DENOMINATOR
+    static constexpr void record_multiplication(UnderlyingType product, bool overflow) noexcept {
+        const UnderlyingType quotient = PRECISION == 0 ? product : product / DENOMINATOR;
+        record(&instrumentation_counters::multiplications, quotient, product % DENOMINATOR != 0, overflow);
+    }
 };
 
 template<typename UnderlyingType, int Precision, UnderlyingType MinValue, UnderlyingType MaxValue>
@@ -366,7 +671,7 @@ struct ranged_decimal_t : public decimal_t<UnderlyingType, Precision>
     static constexpr UnderlyingType NOMINATOR_MIN_VALUE = MIN_VALUE * base_type::DENOMINATOR;
     static constexpr UnderlyingType NOMINATOR_MAX_VALUE = MAX_VALUE * base_type::DENOMINATOR;
 
-    explicit ranged_decimal_t() : base_type() {
+    constexpr ranged_decimal_t() noexcept : base_type() {
         this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
     }
 
@@ -378,7 +683,7 @@ struct ranged_decimal_t : public decimal_t<UnderlyingType, Precision>
 
     template<typename FloatingT,
              std::enable_if_t<std::is_floating_point<FloatingT>::value, bool> = true>
-    explicit ranged_decimal_t(FloatingT num) : base_type(num) {
+    constexpr explicit ranged_decimal_t(FloatingT num) noexcept : base_type(num) {
         if (this->mNominator.value != base_type::NAN_VALUE) {
             this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         }
@@ -386,86 +691,87 @@ struct ranged_decimal_t : public decimal_t<UnderlyingType, Precision>
 
     template<typename IntegralT,
              std::enable_if_t<std::is_integral<IntegralT>::value, bool> = true>
-    explicit ranged_decimal_t(IntegralT num) : base_type(num) {
+    constexpr explicit ranged_decimal_t(IntegralT num) noexcept : base_type(num) {
         if (this->mNominator.value != base_type::NAN_VALUE) {
             this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         }
     }
 
-    explicit ranged_decimal_t(typename decimal_t<UnderlyingType, Precision>::nominator_t nominator)
+    constexpr explicit ranged_decimal_t(typename decimal_t<UnderlyingType, Precision>::nominator_t nominator) noexcept
         : base_type(nominator) {
+        static_assert(has_nominator_layout_v<ranged_decimal_t>, "decimal must consist of its nominator only");
         if (this->mNominator.value != base_type::NAN_VALUE) {
             this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         }
     }
 
-    explicit ranged_decimal_t(UnderlyingType integerPart, UnderlyingType fractionPart)
+    constexpr explicit ranged_decimal_t(UnderlyingType integerPart, UnderlyingType fractionPart) noexcept
         : base_type(integerPart, fractionPart) {
         this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
     }
 
-    constexpr bool operator<(const base_type& other) const { return this->mNominator.value < other.nominator(); }
-    constexpr bool operator<=(const base_type& other) const { return this->mNominator.value <= other.nominator(); }
-    constexpr bool operator==(const base_type& other) const { return this->mNominator.value == other.nominator(); }
-    constexpr bool operator==(const this_type& other) const { return this->mNominator.value == other.nominator(); }
-    constexpr bool operator>=(const base_type& other) const { return this->mNominator.value >= other.nominator(); }
-    constexpr bool operator>(const base_type& other) const { return this->mNominator.value > other.nominator(); }
+    constexpr bool operator<(const base_type& other) const noexcept { return this->mNominator.value < other.nominator(); }
+    constexpr bool operator<=(const base_type& other) const noexcept { return this->mNominator.value <= other.nominator(); }
+    constexpr bool operator==(const base_type& other) const noexcept { return this->mNominator.value == other.nominator(); }
+    constexpr bool operator==(const this_type& other) const noexcept { return this->mNominator.value == other.nominator(); }
+    constexpr bool operator>=(const base_type& other) const noexcept { return this->mNominator.value >= other.nominator(); }
+    constexpr bool operator>(const base_type& other) const noexcept { return this->mNominator.value > other.nominator(); }
 
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator+(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator+(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const noexcept {
         const auto res = static_cast<const base_type&>(*this) + static_cast<const base_type&>(rhs);
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(typename base_type::nominator_t{res.nominator()});
     }
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator-(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator-(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const noexcept {
         const auto res = static_cast<const base_type&>(*this) - static_cast<const base_type&>(rhs);
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(typename base_type::nominator_t{res.nominator()});
     }
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator-() const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator-() const noexcept {
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(
                     typename base_type::nominator_t{-static_cast<const base_type&>(*this).nominator()});
     }
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator*(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator*(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) const noexcept {
         const auto res = static_cast<const base_type&>(*this) * static_cast<const base_type&>(rhs);
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(typename base_type::nominator_t{res.nominator()});
     }
     template<typename RhsUnderlyingType, int RhsPrecision>
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator*(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator*(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const noexcept {
         base_type res = static_cast<const base_type&>(*this);
         res *= rhs;
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(typename base_type::nominator_t{res.nominator()});
     }
     template<typename RhsUnderlyingType, int RhsPrecision>
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
-    operator/(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>
+    operator/(const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) const noexcept {
         base_type res = static_cast<const base_type&>(*this) / rhs;
         return ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>(typename base_type::nominator_t{res.nominator()});
     }
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
-    operator+=(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
+    operator+=(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) noexcept {
         static_cast<base_type&>(*this) += static_cast<const base_type&>(rhs);
         this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         return *this;
     }
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
-    operator-=(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
+    operator-=(const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& rhs) noexcept {
         static_cast<base_type&>(*this) -= static_cast<const base_type&>(rhs);
         this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         return *this;
     }
     template<typename RhsUnderlyingType, int RhsDecimalPrecision>
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
-    operator*=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
+    operator*=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) noexcept {
         static_cast<base_type&>(*this) *= rhs;
         this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
         return *this;
     }
     template<typename RhsUnderlyingType, int RhsDecimalPrecision>
-    ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
-    operator/=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) {
+    constexpr ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>&
+    operator/=(const decimal_t<RhsUnderlyingType, RhsDecimalPrecision>& rhs) noexcept {
         static_cast<base_type&>(*this) /= rhs;
         if (this->mNominator.value != base_type::NAN_VALUE) {
             this->mNominator.value = std::clamp(this->mNominator.value, NOMINATOR_MIN_VALUE, NOMINATOR_MAX_VALUE);
@@ -474,18 +780,17 @@ struct ranged_decimal_t : public decimal_t<UnderlyingType, Precision>
     }
 
     friend std::ostream& operator<<(std::ostream& out, const ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& decimal) {
-        out << decimal.to_string();
-        return out;
+        return out << static_cast<const base_type&>(decimal);
     }
 };
 
 template<typename NewUnderlyingType, int NewPrecision, typename OldUnderlyingType, int OldPrecision>
-inline typename std::enable_if<NewPrecision != OldPrecision, decimal_t<NewUnderlyingType, NewPrecision>>::type
+constexpr typename std::enable_if<NewPrecision != OldPrecision, decimal_t<NewUnderlyingType, NewPrecision>>::type
 decimal_cast(const decimal_t<OldUnderlyingType, OldPrecision>& oldDecimal) noexcept {
     NewUnderlyingType nominator = NewPrecision > OldPrecision ?
                 static_cast<NewUnderlyingType>(oldDecimal.nominator()) * Power10<NewUnderlyingType>(NewPrecision - OldPrecision + 1)
               : static_cast<NewUnderlyingType>(oldDecimal.nominator()) / Power10<NewUnderlyingType>(OldPrecision - NewPrecision - 1);
-    int lastSignificantDigit = std::abs(nominator) % 10;
+    int lastSignificantDigit = static_cast<int>(detail::abs(nominator) % 10);
     int signFactor = nominator >= 0 ? 1 : -1;
     return decimal_t<NewUnderlyingType, NewPrecision>(typename decimal_t<NewUnderlyingType, NewPrecision>::nominator_t{
             nominator / 10 + (lastSignificantDigit >= 5 ? signFactor : 0)
@@ -493,7 +798,7 @@ decimal_cast(const decimal_t<OldUnderlyingType, OldPrecision>& oldDecimal) noexc
 }
 
 template<typename NewUnderlyingType, int NewPrecision, typename OldUnderlyingType, int OldPrecision>
-inline typename std::enable_if<NewPrecision == OldPrecision, decimal_t<NewUnderlyingType, NewPrecision>>::type
+constexpr typename std::enable_if<NewPrecision == OldPrecision, decimal_t<NewUnderlyingType, NewPrecision>>::type
 decimal_cast(const decimal_t<OldUnderlyingType, OldPrecision>& oldDecimal) noexcept {
     return decimal_t<NewUnderlyingType, NewPrecision>(typename decimal_t<NewUnderlyingType, NewPrecision>::nominator_t{
             static_cast<NewUnderlyingType>(oldDecimal.nominator())
@@ -501,30 +806,237 @@ decimal_cast(const decimal_t<OldUnderlyingType, OldPrecision>& oldDecimal) noexc
 }
 
 template<typename ResDecimalType, typename OldUnderlyingType, int OldPrecision>
-inline ResDecimalType
+constexpr ResDecimalType
 decimal_cast(const decimal_t<OldUnderlyingType, OldPrecision>& oldDecimal) noexcept {
     return decimal_cast<typename ResDecimalType::underlying_type, ResDecimalType::PRECISION,
             OldUnderlyingType, OldPrecision>(oldDecimal);
 }
 
+// Parses decimal in format [+|-]digits[.digits] (or nan, inf, -inf written by to_chars) from [first, last)
+// without any allocation. Fraction digits beyond PRECISION are rounded half up.
+// On success `value` is assigned and ptr points past the last parsed character. On failure `value` is left
+// untouched and ec is set to std::errc::invalid_argument or std::errc::result_out_of_range.
+template<typename DecimalT>
+std::from_chars_result from_chars(const char* first, const char* last, DecimalT& value) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    using nominator_t = typename DecimalT::nominator_t;
+    constexpr int PRECISION = DecimalT::PRECISION;
+
+    const char* it = first;
+    bool negative = false;
+    if (it != last && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+    if constexpr (PRECISION != 0) {
+        if (last - it >= 3 && (std::memcmp(it, "inf", 3) == 0 || (!negative && std::memcmp(it, "nan", 3) == 0))) {
+            value = DecimalT{nominator_t{it[0] == 'n' ? DecimalT::NAN_VALUE
+                                                     : negative ? DecimalT::INFINITY_MINUS : DecimalT::INFINITY_PLUS}};
+            return {it + 3, std::errc{}};
+        }
+    }
+    if (negative && !std::is_signed<UnderlyingType>::value) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // nominators reserved for nan and infinities cannot be produced from digits
+    const UnsignedT maxMagnitude = detail::max_parsed_magnitude<DecimalT>(negative);
+    UnsignedT magnitude{};
+    bool overflow = false;
+    const auto append = [&](int digit) {
+        if (magnitude > static_cast<UnsignedT>((maxMagnitude - digit) / 10)) {
+            overflow = true;
+        } else {
+            magnitude = static_cast<UnsignedT>(magnitude * 10 + digit);
+        }
+    };
+
+    const char* const digitsBegin = it;
+    for (; it != last && static_cast<unsigned>(*it - '0') < 10; ++it) {
+        append(*it - '0');
+    }
+    bool anyDigit = it != digitsBegin;
+    int fractionLength = 0;
+    bool roundUp = false;
+    if (it != last && *it == '.') {
+        const char* const fractionBegin = ++it;
+        for (; it != last && static_cast<unsigned>(*it - '0') < 10; ++it) {
+            if (fractionLength < PRECISION) {
+                append(*it - '0');
+                ++fractionLength;
+            } else if (it - fractionBegin == PRECISION) {
+                roundUp = *it >= '5';
+            }
+        }
+        anyDigit = anyDigit || it != fractionBegin;
+    }
+    if (!anyDigit) {
+        return {first, std::errc::invalid_argument};
+    }
+    for (; fractionLength < PRECISION; ++fractionLength) {
+        append(0);
+    }
+    if (roundUp) {
+        overflow = overflow || magnitude == maxMagnitude;
+        magnitude = static_cast<UnsignedT>(magnitude + 1);
+    }
+    if (overflow) {
+        return {it, std::errc::result_out_of_range};
+    }
+    value = DecimalT{nominator_t{negative ? static_cast<UnderlyingType>(UnsignedT{0} - magnitude)
+                                          : static_cast<UnderlyingType>(magnitude)}};
+    return {it, std::errc{}};
+}
+
 template<typename UnderlyingType, int Precision>
-const decimal_t<UnderlyingType, Precision>&
+constexpr const decimal_t<UnderlyingType, Precision>&
 min(const decimal_t<UnderlyingType, Precision>& first, const decimal_t<UnderlyingType, Precision>& second)
 {
     return first < second ? first : second;
 }
 
 template<typename UnderlyingType, int Precision>
-const decimal_t<UnderlyingType, Precision>&
+constexpr const decimal_t<UnderlyingType, Precision>&
 max(const decimal_t<UnderlyingType, Precision>& first, const decimal_t<UnderlyingType, Precision>& second)
 {
     return first > second ? first : second;
 }
 
+namespace detail
+{
+
+// Position of a value among special values, ordered as nominators are: -inf, finite values, +inf, NaN.
+// Unsigned types have no negative infinity.
+template<typename DecimalT>
+constexpr int special_rank(typename DecimalT::underlying_type nominator) noexcept {
+    if (nominator == DecimalT::NAN_VALUE) return 2;
+    if (nominator == DecimalT::INFINITY_PLUS) return 1;
+    if (std::is_signed<typename DecimalT::underlying_type>::value && nominator == DecimalT::INFINITY_MINUS) return -1;
+    return 0;
+}
+
+// Compares lhs * 10^Shift with rhs exactly. Products which fit in 128 bits are computed directly, otherwise rhs is
+// split into quotient and remainder of division by 10^Shift.
+template<typename OperatingType, int Shift>
+constexpr int compare_scaled(OperatingType lhs, OperatingType rhs) noexcept {
+    if constexpr (sizeof(OperatingType) >= 16 && Shift <= 18) {
+        const OperatingType scaled = lhs * Power10<OperatingType>(Shift);
+        return (scaled > rhs) - (scaled < rhs);
+    } else {
+        OperatingType quotient{};
+        OperatingType remainder = rhs;
+        if constexpr (Shift <= std::numeric_limits<OperatingType>::digits10) {
+            quotient = rhs / Power10<OperatingType>(Shift);
+            remainder = rhs % Power10<OperatingType>(Shift);
+        }
+        if (lhs != quotient) {
+            return lhs < quotient ? -1 : 1;
+        }
+        return (remainder < 0) - (remainder > 0);
+    }
+}
+
+// Decimal with nominator computed in a wider type, +inf/-inf if it does not fit in finite nominators
+template<typename DecimalT, typename WideT>
+constexpr DecimalT saturate_wide(WideT value) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    const auto minFinite = static_cast<WideT>(std::is_signed<UnderlyingType>::value ? DecimalT::INFINITY_MINUS + 1 : 0);
+    const auto maxFinite = static_cast<WideT>(DecimalT::INFINITY_PLUS - 1);
+    return DecimalT{typename DecimalT::nominator_t{value > maxFinite ? DecimalT::INFINITY_PLUS
+                                                   : value < minFinite ? DecimalT::INFINITY_MINUS : static_cast<UnderlyingType>(value)}};
+}
+
+// Quotient rounded half away from zero, as in decimal division; divisor must be positive
+template<typename WideT>
+constexpr WideT divide_rounded(WideT dividend, WideT divisor) noexcept {
+    if constexpr (sizeof(WideT) > sizeof(int64_t)) {
+        // 128 bit division is a library call several times slower than the 64 bit instruction
+        constexpr auto limit = static_cast<WideT>(std::numeric_limits<int64_t>::max());
+        if (dividend <= limit && dividend >= -limit && divisor <= limit) {
+            return divide_rounded(static_cast<int64_t>(dividend), static_cast<int64_t>(divisor));
+        }
+    }
+    const WideT quotient = dividend / divisor;
+    const WideT remainder = dividend % divisor;
+    const WideT magnitude = remainder < 0 ? -remainder : remainder;
+    // compared without doubling the remainder, which could overflow for divisors above half of the range
+    if (magnitude >= divisor - magnitude) {
+        return quotient + (dividend < 0 ? -1 : 1);
+    }
+    return quotient;
+}
+
+}  // namespace detail
+
+// Exact comparison of decimals of any underlying types and precisions, no rounding takes place. Returns negative
+// value, zero or positive value if lhs is respectively less than, equal to or greater than rhs. Special values are
+// ordered as in comparisons of decimals of the same type: -inf, finite values, +inf, NaN.
+template<typename LhsUnderlyingType, int LhsPrecision, typename RhsUnderlyingType, int RhsPrecision>
+constexpr int compare(const decimal_t<LhsUnderlyingType, LhsPrecision>& lhs, const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) noexcept {
+    using LhsT = decimal_t<LhsUnderlyingType, LhsPrecision>;
+    using RhsT = decimal_t<RhsUnderlyingType, RhsPrecision>;
+    using OperatingType = select_operating_type_t<LhsUnderlyingType, RhsUnderlyingType>;
+    const int lhsRank = detail::special_rank<LhsT>(lhs.nominator());
+    const int rhsRank = detail::special_rank<RhsT>(rhs.nominator());
+    if (lhsRank != 0 || rhsRank != 0) {
+        return (lhsRank > rhsRank) - (lhsRank < rhsRank);
+    }
+    const auto lhsNominator = static_cast<OperatingType>(lhs.nominator());
+    const auto rhsNominator = static_cast<OperatingType>(rhs.nominator());
+    if constexpr (LhsT::PRECISION == RhsT::PRECISION) {
+        return (lhsNominator > rhsNominator) - (lhsNominator < rhsNominator);
+    } else if constexpr (LhsT::PRECISION < RhsT::PRECISION) {
+        return detail::compare_scaled<OperatingType, RhsT::PRECISION - LhsT::PRECISION>(lhsNominator, rhsNominator);
+    } else {
+        return -detail::compare_scaled<OperatingType, LhsT::PRECISION - RhsT::PRECISION>(rhsNominator, lhsNominator);
+    }
+}
+
+#if defined(__cpp_impl_three_way_comparison) && __has_include(<compare>)
+template<typename LhsUnderlyingType, int LhsPrecision, typename RhsUnderlyingType, int RhsPrecision>
+constexpr std::strong_ordering operator<=>(const decimal_t<LhsUnderlyingType, LhsPrecision>& lhs,
+                                           const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) noexcept {
+    return compare(lhs, rhs) <=> 0;
+}
+
+template<typename LhsUnderlyingType, int LhsPrecision, typename RhsUnderlyingType, int RhsPrecision>
+    requires (!std::is_same_v<decimal_t<LhsUnderlyingType, LhsPrecision>, decimal_t<RhsUnderlyingType, RhsPrecision>>)
+constexpr bool operator==(const decimal_t<LhsUnderlyingType, LhsPrecision>& lhs,
+                          const decimal_t<RhsUnderlyingType, RhsPrecision>& rhs) noexcept {
+    return compare(lhs, rhs) == 0;
+}
+#endif
+
 using integer_t = decimal_t<int, 0>;
 using size_t = decimal_t<size_t, 0>;
 using float32_3d_t = decimal_t<int32_t, 3>;
 using float32_2d_t = decimal_t<int32_t, 2>;
 using ratio64_t = ranged_decimal_t<int64_t, 5, 0, 1>;
 
+static_assert(has_nominator_layout_v<decimal_t<>> && has_nominator_layout_v<integer_t> && has_nominator_layout_v<size_t> &&
+              has_nominator_layout_v<float32_3d_t> && has_nominator_layout_v<float32_2d_t> && has_nominator_layout_v<ratio64_t>,
+              "decimals must consist of their nominators only");
+
 }  // namespace strict
+
+namespace std
+{
+
+template<typename UnderlyingType, int Precision>
+struct hash<strict::decimal_t<UnderlyingType, Precision>>
+{
+    std::size_t operator()(const strict::decimal_t<UnderlyingType, Precision>& value) const noexcept {
+        return static_cast<std::size_t>(strict::detail::hash_nominator(static_cast<uint64_t>(value.nominator())));
+    }
+};
+
+template<typename UnderlyingType, int Precision, UnderlyingType MinValue, UnderlyingType MaxValue>
+struct hash<strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>>
+{
+    std::size_t operator()(const strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>& value) const noexcept {
+        return static_cast<std::size_t>(strict::detail::hash_nominator(static_cast<uint64_t>(value.nominator())));
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,383 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strict
+{
+
+// Exact accumulator of sum, count, minimum and maximum of decimals. Sum is kept in the wide operating type, so it
+// does not overflow while accumulating. NaN values are skipped (as NULLs in SQL) and not counted; infinite values
+// make the sum infinite (NaN if both signs occurred).
+template<typename DecimalT>
+class decimal_aggregate
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    using wide_type = select_operating_type_t<underlying_type, underlying_type>;
+
+    void add(const DecimalT& value) noexcept {
+        add_nominator(value.nominator());
+    }
+
+    void add_nominator(underlying_type nominator) noexcept {
+        if (nominator == DecimalT::NAN_VALUE) {
+            return;
+        }
+        if (nominator == DecimalT::INFINITY_PLUS) {
+            mPlusInfinity = true;
+        } else if (std::is_signed<underlying_type>::value && nominator == DecimalT::INFINITY_MINUS) {
+            mMinusInfinity = true;
+        } else {
+            mSum += nominator;
+        }
+        mMin = std::min(mMin, nominator);
+        mMax = std::max(mMax, nominator);
+        ++mCount;
+    }
+
+    void merge(const decimal_aggregate& other) noexcept {
+        mSum += other.mSum;
+        mCount += other.mCount;
+        mMin = std::min(mMin, other.mMin);
+        mMax = std::max(mMax, other.mMax);
+        mPlusInfinity = mPlusInfinity || other.mPlusInfinity;
+        mMinusInfinity = mMinusInfinity || other.mMinusInfinity;
+    }
+
+    // Number of aggregated (not NaN) values
+    std::size_t count() const noexcept { return mCount; }
+
+    // Exact sum of finite values
+    wide_type wide_sum() const noexcept { return mSum; }
+
+    // Sum, +inf/-inf if it does not fit in the decimal type
+    DecimalT sum() const noexcept {
+        if (mPlusInfinity || mMinusInfinity) {
+            return special(mPlusInfinity && mMinusInfinity ? DecimalT::NAN_VALUE
+                                                           : mPlusInfinity ? DecimalT::INFINITY_PLUS : DecimalT::INFINITY_MINUS);
+        }
+        return detail::saturate_wide<DecimalT>(mSum);
+    }
+
+    // Mean rounded half away from zero, as in decimal division; NaN if no values were aggregated
+    DecimalT avg() const noexcept {
+        if (mCount == 0 || mPlusInfinity || mMinusInfinity) {
+            return mCount == 0 ? special(DecimalT::NAN_VALUE) : sum();
+        }
+        return detail::saturate_wide<DecimalT>(detail::divide_rounded(mSum, static_cast<wide_type>(mCount)));
+    }
+
+    // Minimum and maximum, NaN if no values were aggregated
+    DecimalT min() const noexcept { return mCount == 0 ? special(DecimalT::NAN_VALUE) : special(mMin); }
+    DecimalT max() const noexcept { return mCount == 0 ? special(DecimalT::NAN_VALUE) : special(mMax); }
+
+private:
+    static DecimalT special(underlying_type nominator) noexcept { return DecimalT{typename DecimalT::nominator_t{nominator}}; }
+
+    wide_type mSum{};
+    std::size_t mCount = 0;
+    underlying_type mMin = std::numeric_limits<underlying_type>::max();
+    underlying_type mMax = std::numeric_limits<underlying_type>::lowest();
+    bool mPlusInfinity = false;
+    bool mMinusInfinity = false;
+};
+
+struct aggregation_options
+{
+    // Number of hash partitions (power of 2); each partition has its own table, small enough to stay in cache
+    std::size_t partitions = 64;
+    // Threads aggregating partitions, 0 means std::thread::hardware_concurrency()
+    std::size_t threads = 1;
+    // Rows are aggregated directly while tables take less memory than this (i.e. while they stay in cache), then
+    // they are buffered and partitioned first
+    std::size_t directTableBytes = 4u << 20;
+    // Rows buffered before they are partitioned and aggregated
+    std::size_t bufferedRows = 1u << 20;
+};
+
+// Hash aggregation of decimal values grouped by keys. Keys are hashed into partitions by high bits of their hashes,
+// every partition has its own open addressing table indexed by low bits of the hashes, whose slots are probed in
+// a dense array of hashes before keys are compared. While tables are small, rows are aggregated directly. Once
+// they outgrow the cache, rows are buffered together with their hashes; full buffers are partitioned with a
+// counting sort and partitions are aggregated one by one, so each table is hot while its rows are processed, and
+// in parallel when more threads are configured.
+template<typename KeyT, typename DecimalT, typename Hash = std::hash<KeyT>, typename KeyEqual = std::equal_to<KeyT>>
+class hash_aggregator
+{
+public:
+    using aggregate_type = decimal_aggregate<DecimalT>;
+    using underlying_type = typename DecimalT::underlying_type;
+
+    explicit hash_aggregator(aggregation_options options = {}) : mOptions(options) {
+        std::size_t partitions = 1;
+        while (partitions < mOptions.partitions) {
+            partitions *= 2;
+        }
+        mOptions.partitions = partitions;
+        mOptions.bufferedRows = std::max<std::size_t>(mOptions.bufferedRows, 1);
+        mPartitions.resize(partitions);
+    }
+
+    const aggregation_options& options() const noexcept { return mOptions; }
+
+    void add(const KeyT& key, const DecimalT& value) {
+        if (!mBuffering) {
+            const uint64_t hash = hash_of(key);
+            partition& target = mPartitions[partition_of(hash)];
+            const std::size_t slots = target.hashes.size();
+            target.aggregate(hash, key, value.nominator(), mKeyEqual);
+            mTableBytes += (target.hashes.size() - slots) * (sizeof(uint64_t) + sizeof(entry));
+            mBuffering = mTableBytes > mOptions.directTableBytes;
+            return;
+        }
+        if (mBuffer.empty()) {
+            mBuffer.reserve(mOptions.bufferedRows);
+        }
+        mBuffer.push_back({hash_of(key), key, value.nominator()});
+        if (mBuffer.size() >= mOptions.bufferedRows) {
+            flush();
+        }
+    }
+
+    // Adds rows (keys[i], values[i]); both spans must have equal size
+    void add(span<const KeyT> keys, span<const DecimalT> values) {
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            add(keys[i], values[i]);
+        }
+    }
+
+    // Aggregates all buffered rows
+    void flush() {
+        if (mBuffer.empty()) {
+            return;
+        }
+        // counting sort of buffered rows by partitions
+        std::vector<std::size_t> offsets(mOptions.partitions + 1, 0);
+        for (const row& bufferedRow : mBuffer) {
+            ++offsets[partition_of(bufferedRow.hash) + 1];
+        }
+        for (std::size_t idx = 1; idx <= mOptions.partitions; ++idx) {
+            offsets[idx] += offsets[idx - 1];
+        }
+        if (mPartitioned.size() < mBuffer.size()) {
+            mPartitioned.resize(mBuffer.size());
+        }
+        std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+        for (row& bufferedRow : mBuffer) {
+            mPartitioned[positions[partition_of(bufferedRow.hash)]++] = std::move(bufferedRow);
+        }
+        mBuffer.clear();
+
+        auto aggregate = [this, &offsets](std::size_t idx) {
+            mPartitions[idx].aggregate(mPartitioned.data() + offsets[idx], mPartitioned.data() + offsets[idx + 1], mKeyEqual);
+        };
+        const std::size_t threads = std::min(mOptions.partitions,
+                                             mOptions.threads != 0 ? mOptions.threads : std::max(1u, std::thread::hardware_concurrency()));
+        if (threads <= 1) {
+            for (std::size_t idx = 0; idx < mPartitions.size(); ++idx) {
+                aggregate(idx);
+            }
+        } else {
+            std::atomic<std::size_t> next{0};
+            auto worker = [this, &next, &aggregate] {
+                for (std::size_t idx = next++; idx < mPartitions.size(); idx = next++) {
+                    aggregate(idx);
+                }
+            };
+            std::vector<std::thread> workers;
+            for (std::size_t i = 1; i < threads; ++i) {
+                workers.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : workers) {
+                thread.join();
+            }
+        }
+    }
+
+    // Number of distinct keys, buffered rows are aggregated first
+    std::size_t group_count() {
+        flush();
+        std::size_t count = 0;
+        for (const auto& partition : mPartitions) {
+            count += partition.size;
+        }
+        return count;
+    }
+
+    // Aggregate of `key`, nullptr if there were no rows with the key; buffered rows are aggregated first
+    const aggregate_type* find(const KeyT& key) {
+        flush();
+        const uint64_t hash = hash_of(key);
+        return mPartitions[partition_of(hash)].find(hash, key, mKeyEqual);
+    }
+
+    // Calls fn(key, aggregate) for every group in unspecified order; buffered rows are aggregated first
+    template<typename Fn>
+    void for_each(Fn&& fn) {
+        flush();
+        for (const auto& partition : mPartitions) {
+            for (std::size_t slot = 0; slot < partition.hashes.size(); ++slot) {
+                if (partition.hashes[slot] != EMPTY) {
+                    fn(partition.entries[slot].key, partition.entries[slot].aggregate);
+                }
+            }
+        }
+    }
+
+    std::vector<std::pair<KeyT, aggregate_type>> results() {
+        std::vector<std::pair<KeyT, aggregate_type>> res;
+        res.reserve(group_count());
+        for_each([&res](const KeyT& key, const aggregate_type& aggregate) { res.emplace_back(key, aggregate); });
+        return res;
+    }
+
+private:
+    // Hashes have top bit set, so zero marks empty slots
+    static constexpr uint64_t EMPTY = 0;
+
+    struct row
+    {
+        uint64_t hash;
+        KeyT key;
+        underlying_type nominator;
+    };
+
+    struct entry
+    {
+        KeyT key{};
+        aggregate_type aggregate;
+    };
+
+    struct partition
+    {
+        std::vector<uint64_t> hashes;
+        std::vector<entry> entries;
+        std::size_t size = 0;
+
+        void aggregate(uint64_t hash, const KeyT& key, underlying_type nominator, const KeyEqual& keyEqual) {
+            if ((size + 1) * 4 > hashes.size() * 3) {
+                grow();
+            }
+            entries[insert(hash, key, keyEqual)].aggregate.add_nominator(nominator);
+        }
+
+        void aggregate(const row* first, const row* last, const KeyEqual& keyEqual) {
+            for (; first != last; ++first) {
+                aggregate(first->hash, first->key, first->nominator, keyEqual);
+            }
+        }
+
+        const aggregate_type* find(uint64_t hash, const KeyT& key, const KeyEqual& keyEqual) const {
+            const std::size_t mask = hashes.size() - 1;
+            for (std::size_t slot = hash & mask; !hashes.empty() && hashes[slot] != EMPTY; slot = (slot + 1) & mask) {
+                if (hashes[slot] == hash && keyEqual(entries[slot].key, key)) {
+                    return &entries[slot].aggregate;
+                }
+            }
+            return nullptr;
+        }
+
+        std::size_t insert(uint64_t hash, const KeyT& key, const KeyEqual& keyEqual) {
+            const std::size_t mask = hashes.size() - 1;
+            std::size_t slot = hash & mask;
+            for (; hashes[slot] != EMPTY; slot = (slot + 1) & mask) {
+                if (hashes[slot] == hash && keyEqual(entries[slot].key, key)) {
+                    return slot;
+                }
+            }
+            hashes[slot] = hash;
+            entries[slot].key = key;
+            ++size;
+            return slot;
+        }
+
+        void grow() {
+            const std::size_t slots = hashes.empty() ? 8 : hashes.size() * 2;
+            std::vector<uint64_t> oldHashes(slots, EMPTY);
+            std::vector<entry> oldEntries(slots);
+            oldHashes.swap(hashes);
+            oldEntries.swap(entries);
+            const std::size_t mask = slots - 1;
+            for (std::size_t idx = 0; idx < oldHashes.size(); ++idx) {
+                if (oldHashes[idx] != EMPTY) {
+                    std::size_t slot = oldHashes[idx] & mask;
+                    while (hashes[slot] != EMPTY) {
+                        slot = (slot + 1) & mask;
+                    }
+                    hashes[slot] = oldHashes[idx];
+                    entries[slot] = std::move(oldEntries[idx]);
+                }
+            }
+        }
+    };
+
+    static uint64_t hash_of(const KeyT& key) {
+        return detail::hash_nominator(static_cast<uint64_t>(Hash{}(key))) | (uint64_t{1} << 63);
+    }
+
+    // High bits select partition, low bits slot within partition's table
+    std::size_t partition_of(uint64_t hash) const noexcept {
+        return static_cast<std::size_t>(hash >> 40) & (mOptions.partitions - 1);
+    }
+
+    aggregation_options mOptions;
+    std::vector<partition> mPartitions;
+    std::vector<row> mBuffer;
+    std::vector<row> mPartitioned;
+    std::size_t mTableBytes = 0;
+    bool mBuffering = false;
+    KeyEqual mKeyEqual;
+};
+
+}  // namespace strict
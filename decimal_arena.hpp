@@ -0,0 +1,133 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_format.hpp"
+#include "decimal_span.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Formatting and parsing with memory taken from a std::pmr::memory_resource, typically an arena such as
+// std::pmr::monotonic_buffer_resource reset once per processed message. Views returned by these functions point to
+// memory of the resource and stay valid until the resource releases it; nothing has to be freed one by one.
+
+namespace strict
+{
+
+// Formats the value into memory allocated from `arena` (exactly the length of the text, no terminating null)
+template<typename DecimalT>
+std::string_view format_to_arena(const DecimalT& value, std::pmr::memory_resource& arena) {
+    char buffer[DecimalT::MAX_STRING_LENGTH];
+    const std::size_t length = static_cast<std::size_t>(value.to_chars(buffer) - buffer);
+    char* text = static_cast<char*>(arena.allocate(length, 1));
+    std::memcpy(text, buffer, length);
+    return std::string_view(text, length);
+}
+
+// Formats the column like format_column() into a single allocation from `arena`. The allocation is sized for
+// max_formatted_column_size(), so a monotonic arena keeps the unused tail until it is released.
+template<typename DecimalT>
+std::string_view format_column_to_arena(span<const DecimalT> column, char separator, std::pmr::memory_resource& arena) {
+    const std::size_t capacity = max_formatted_column_size<DecimalT>(column.size());
+    if (capacity == 0) {
+        return std::string_view();
+    }
+    char* text = static_cast<char*>(arena.allocate(capacity, 1));
+    return std::string_view(text, static_cast<std::size_t>(format_column(column, text, separator) - text));
+}
+
+// to_string() variant allocating from `resource`
+template<typename DecimalT>
+std::pmr::string to_pmr_string(const DecimalT& value, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    char buffer[DecimalT::MAX_STRING_LENGTH];
+    return std::pmr::string(buffer, value.to_chars(buffer), resource);
+}
+
+// Copies text, e.g. a received message, to `arena`, so that views of it can be parsed after the source buffer is reused
+inline std::string_view copy_to_arena(std::string_view text, std::pmr::memory_resource& arena) {
+    if (text.empty()) {
+        return std::string_view();
+    }
+    char* copy = static_cast<char*>(arena.allocate(text.size(), 1));
+    std::memcpy(copy, text.data(), text.size());
+    return std::string_view(copy, text.size());
+}
+
+// from_chars() of a view
+template<typename DecimalT>
+std::from_chars_result from_chars(std::string_view text, DecimalT& value) noexcept {
+    return from_chars(text.data(), text.data() + text.size(), value);
+}
+
+// Parses fields of `text` delimited by `delimiter` and appends them to `values`, which typically allocates from the
+// same arena as the text. Fields which are not entirely a decimal are appended as NAN_VALUE, like in
+// csv_column_parser. Returns number of such fields; empty text has no fields.
+template<typename DecimalT>
+std::size_t parse_delimited(std::string_view text, char delimiter, std::pmr::vector<DecimalT>& values) {
+    std::size_t invalid = 0;
+    if (text.empty()) {
+        return invalid;
+    }
+    const char* first = text.data();
+    const char* const last = first + text.size();
+    for (;;) {
+        const char* end = static_cast<const char*>(std::memchr(first, delimiter, static_cast<std::size_t>(last - first)));
+        end = end == nullptr ? last : end;
+        DecimalT value{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}};
+        const std::from_chars_result res = from_chars(first, end, value);
+        if (res.ec != std::errc{} || res.ptr != end) {
+            value = DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}};
+            ++invalid;
+        }
+        values.push_back(value);
+        if (end == last) {
+            return invalid;
+        }
+        first = end + 1;
+    }
+}
+
+}  // namespace strict
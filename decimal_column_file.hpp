@@ -0,0 +1,429 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_filter.hpp"
+#include "decimal_serialization.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STRICT_DECIMAL_HAS_MMAP 1
+#endif
+
+namespace strict
+{
+
+// Column file layout (all multi-byte integers are little endian):
+//   bytes 0-3    - magic "SDCF"
+//   bytes 4-5    - format version (COLUMN_FILE_VERSION)
+//   byte 6       - width of nominator in bytes
+//   byte 7       - flags: bit 0 - nominator is signed, bit 1 - block statistics are present
+//   byte 8       - precision of stored decimals (signed)
+//   bytes 9-15   - reserved, always 0
+//   bytes 16-23  - number of values
+//   bytes 24-31  - number of values per block, a multiple of 64
+//   bytes 32-39  - offset of block statistics: minimum and maximum nominator (`width` bytes each) per block
+//   bytes 40-47  - offset of values, a multiple of COLUMN_FILE_ALIGNMENT
+//   bytes 48-63  - reserved, always 0
+//   values       - `width` bytes of two's complement nominator per value
+// Values are aligned, so that a mapped file is used in place as an array of decimals. Statistics treat special
+// values (NaN, infinities) as plain nominators, like block statistics of compressed_column.
+constexpr std::size_t COLUMN_FILE_HEADER_SIZE = 64;
+constexpr std::size_t COLUMN_FILE_ALIGNMENT = 64;
+constexpr uint16_t COLUMN_FILE_VERSION = 1;
+constexpr std::size_t COLUMN_FILE_DEFAULT_BLOCK_SIZE = 4096;
+
+enum class column_file_error
+{
+    none,
+    io_error,
+    invalid_block_size,
+    invalid_header,
+    unsupported_version,
+    type_mismatch,
+    precision_mismatch,
+    truncated,
+    unsupported_byte_order,
+};
+
+namespace detail
+{
+
+constexpr unsigned char COLUMN_FILE_MAGIC[4] = {'S', 'D', 'C', 'F'};
+constexpr unsigned char COLUMN_FILE_SIGNED = 1;
+constexpr unsigned char COLUMN_FILE_STATISTICS = 2;
+
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+template<typename DecimalT>
+void encode_nominators(const DecimalT* values, std::size_t count, unsigned char* out) noexcept {
+    using UnsignedT = std::make_unsigned_t<typename DecimalT::underlying_type>;
+    if constexpr (IS_LITTLE_ENDIAN) {
+        std::memcpy(out, values, count * sizeof(UnsignedT));
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            store_le<UnsignedT>(out + i * sizeof(UnsignedT), static_cast<UnsignedT>(values[i].nominator()));
+        }
+    }
+}
+
+}  // namespace detail
+
+// Writes `values` to a column file at `path`, replacing it. Values are grouped in blocks of `blockSize` values, which
+// has to be a nonzero multiple of 64; minimum and maximum of every block are stored if `withStatistics` is set.
+template<typename DecimalT>
+column_file_error write_column_file(const char* path, span<const DecimalT> values,
+                                    std::size_t blockSize = COLUMN_FILE_DEFAULT_BLOCK_SIZE, bool withStatistics = true) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    constexpr std::size_t WIDTH = sizeof(UnderlyingType);
+
+    if (blockSize == 0 || blockSize % 64 != 0) {
+        return column_file_error::invalid_block_size;
+    }
+    const std::size_t blocks = (values.size() + blockSize - 1) / blockSize;
+    const std::size_t statisticsSize = withStatistics ? blocks * 2 * WIDTH : 0;
+    const std::size_t dataOffset = detail::align_up(COLUMN_FILE_HEADER_SIZE + statisticsSize, COLUMN_FILE_ALIGNMENT);
+
+    // header, statistics and padding are written at once
+    std::vector<unsigned char> head(dataOffset, 0);
+    std::memcpy(head.data(), detail::COLUMN_FILE_MAGIC, sizeof(detail::COLUMN_FILE_MAGIC));
+    detail::store_le<uint16_t>(head.data() + 4, COLUMN_FILE_VERSION);
+    head[6] = static_cast<unsigned char>(WIDTH);
+    head[7] = static_cast<unsigned char>((std::is_signed<UnderlyingType>::value ? detail::COLUMN_FILE_SIGNED : 0)
+                                         | (withStatistics ? detail::COLUMN_FILE_STATISTICS : 0));
+    head[8] = static_cast<unsigned char>(static_cast<signed char>(DecimalT::PRECISION));
+    detail::store_le<uint64_t>(head.data() + 16, values.size());
+    detail::store_le<uint64_t>(head.data() + 24, blockSize);
+    detail::store_le<uint64_t>(head.data() + 32, withStatistics ? COLUMN_FILE_HEADER_SIZE : 0);
+    detail::store_le<uint64_t>(head.data() + 40, dataOffset);
+    if (withStatistics) {
+        unsigned char* it = head.data() + COLUMN_FILE_HEADER_SIZE;
+        for (std::size_t first = 0; first < values.size(); first += blockSize) {
+            const std::size_t last = std::min(values.size(), first + blockSize);
+            UnderlyingType min = values[first].nominator();
+            UnderlyingType max = min;
+            for (std::size_t i = first + 1; i < last; ++i) {
+                min = std::min(min, values[i].nominator());
+                max = std::max(max, values[i].nominator());
+            }
+            detail::store_le<UnsignedT>(it, static_cast<UnsignedT>(min));
+            detail::store_le<UnsignedT>(it + WIDTH, static_cast<UnsignedT>(max));
+            it += 2 * WIDTH;
+        }
+    }
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return column_file_error::io_error;
+    }
+    bool written = std::fwrite(head.data(), 1, head.size(), file) == head.size();
+    if constexpr (detail::IS_LITTLE_ENDIAN) {
+        // data() of an empty column may be null, which fwrite does not accept
+        written = written && (values.empty() || std::fwrite(values.data(), WIDTH, values.size(), file) == values.size());
+    } else {
+        unsigned char buffer[64 * sizeof(UnderlyingType)];
+        for (std::size_t first = 0; written && first < values.size(); first += 64) {
+            const std::size_t count = std::min<std::size_t>(64, values.size() - first);
+            detail::encode_nominators(values.data() + first, count, buffer);
+            written = std::fwrite(buffer, WIDTH, count, file) == count;
+        }
+    }
+    written = std::fclose(file) == 0 && written;
+    return written ? column_file_error::none : column_file_error::io_error;
+}
+
+// Read only column of decimals backed by a column file. The file is memory mapped where the platform supports it
+// (read into memory otherwise), and values are accessed in place without copying or decoding, so opening takes time
+// independent of the number of values. Only files with the underlying type and precision of DecimalT are accepted,
+// and only on little endian platforms, where stored nominators are native decimals.
+template<typename DecimalT>
+class mapped_column
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    static_assert(detail::is_plain_decimal<DecimalT>(), "ranged decimals cannot be mapped without clamping");
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    static_assert(COLUMN_FILE_ALIGNMENT % alignof(DecimalT) == 0, "values of the file are not aligned for decimal");
+
+    mapped_column() noexcept = default;
+    mapped_column(const mapped_column&) = delete;
+    mapped_column& operator=(const mapped_column&) = delete;
+
+    mapped_column(mapped_column&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    mapped_column& operator=(mapped_column&& other) noexcept {
+        if (this != &other) {
+            close();
+            mMapping = other.mMapping;
+            mFileSize = other.mFileSize;
+            mBuffer = std::move(other.mBuffer);
+            mValues = other.mValues;
+            mStatistics = other.mStatistics;
+            mSize = other.mSize;
+            mBlockSize = other.mBlockSize;
+            other.mMapping = nullptr;
+            other.mFileSize = 0;
+            other.reset();
+        }
+        return *this;
+    }
+
+    ~mapped_column() {
+        close();
+    }
+
+    // Opens a column file; a previously opened file is closed first, also if opening fails
+    column_file_error open(const char* path) noexcept {
+        close();
+        if constexpr (!detail::IS_LITTLE_ENDIAN) {
+            return column_file_error::unsupported_byte_order;
+        }
+        const column_file_error error = load(path);
+        if (error != column_file_error::none) {
+            close();
+            return error;
+        }
+        return validate();
+    }
+
+    void close() noexcept {
+#if defined(STRICT_DECIMAL_HAS_MMAP)
+        if (mMapping != nullptr) {
+            ::munmap(mMapping, mFileSize);
+        }
+#endif
+        mMapping = nullptr;
+        mFileSize = 0;
+        mBuffer.clear();
+        mBuffer.shrink_to_fit();
+        reset();
+    }
+
+    bool is_open() const noexcept { return data() != nullptr; }
+    span<const DecimalT> values() const noexcept { return span<const DecimalT>(mValues, mSize); }
+    std::size_t size() const noexcept { return mSize; }
+    std::size_t block_size() const noexcept { return mBlockSize; }
+    std::size_t block_count() const noexcept { return mBlockSize == 0 ? 0 : (mSize + mBlockSize - 1) / mBlockSize; }
+    bool has_statistics() const noexcept { return mStatistics != nullptr; }
+
+    // Minimum and maximum of a block; the file has to have statistics
+    DecimalT block_min(std::size_t block) const noexcept { return DecimalT{typename DecimalT::nominator_t{statistic(block, 0)}}; }
+    DecimalT block_max(std::size_t block) const noexcept { return DecimalT{typename DecimalT::nominator_t{statistic(block, 1)}}; }
+
+    // False if statistics prove that no value of the block lies in [low, high]
+    bool block_may_contain(std::size_t block, const DecimalT& low, const DecimalT& high) const noexcept {
+        return !has_statistics()
+            || (statistic(block, 0) <= high.nominator() && low.nominator() <= statistic(block, 1));
+    }
+
+    // Sets bit i of `bitmask` if low <= values()[i] <= high, comparing nominators, and returns number of matching
+    // values. Blocks excluded by statistics are cleared without reading their values, so their pages are never
+    // faulted in. `bitmask` has to hold bitmask_words(size()) words.
+    std::size_t select_range(const DecimalT& low, const DecimalT& high, span<uint64_t> bitmask) const noexcept {
+        using UnsignedT = std::make_unsigned_t<underlying_type>;
+        const underlying_type* nominators = reinterpret_cast<const underlying_type*>(mValues);
+        // low <= x <= high as a single unsigned comparison of x - low with high - low
+        const UnsignedT lowCode = static_cast<UnsignedT>(low.nominator());
+        const UnsignedT width = static_cast<UnsignedT>(static_cast<UnsignedT>(high.nominator()) - lowCode);
+        const bool empty = high.nominator() < low.nominator();
+        // words of a larger bitmask beyond the last value are left untouched
+        const std::size_t words = std::min(bitmask.size(), bitmask_words(mSize));
+        std::size_t count = 0;
+        for (std::size_t block = 0; block < block_count(); ++block) {
+            const std::size_t firstWord = block * mBlockSize / 64;
+            const std::size_t lastWord = std::min(words, (block + 1) * mBlockSize / 64);
+            if (empty || !block_may_contain(block, low, high)) {
+                std::fill(bitmask.begin() + firstWord, bitmask.begin() + lastWord, uint64_t{0});
+                continue;
+            }
+            for (std::size_t word = firstWord; word < lastWord; ++word) {
+                const std::size_t first = word * 64;
+                const std::size_t rows = std::min<std::size_t>(64, mSize - first);
+                uint64_t bits = 0;
+                for (std::size_t i = 0; i < rows; ++i) {
+                    const UnsignedT offset = static_cast<UnsignedT>(static_cast<UnsignedT>(nominators[first + i]) - lowCode);
+                    bits |= static_cast<uint64_t>(offset <= width) << i;
+                }
+                bitmask[word] = bits;
+            }
+            count += bitmask_count(bitmask.subspan(firstWord, lastWord - firstWord));
+        }
+        return count;
+    }
+
+private:
+    const unsigned char* data() const noexcept {
+        return mMapping != nullptr ? static_cast<const unsigned char*>(mMapping)
+                                   : reinterpret_cast<const unsigned char*>(mBuffer.data());
+    }
+
+    void reset() noexcept {
+        mValues = nullptr;
+        mStatistics = nullptr;
+        mSize = 0;
+        mBlockSize = 0;
+    }
+
+    underlying_type statistic(std::size_t block, std::size_t which) const noexcept {
+        using UnsignedT = std::make_unsigned_t<underlying_type>;
+        return static_cast<underlying_type>(detail::load_le<UnsignedT>(mStatistics + (2 * block + which) * sizeof(underlying_type)));
+    }
+
+    column_file_error load(const char* path) noexcept {
+#if defined(STRICT_DECIMAL_HAS_MMAP)
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return column_file_error::io_error;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return column_file_error::io_error;
+        }
+        if (static_cast<std::size_t>(info.st_size) < COLUMN_FILE_HEADER_SIZE) {
+            ::close(fd);
+            return column_file_error::truncated;
+        }
+        void* mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            return column_file_error::io_error;
+        }
+        mMapping = mapping;
+        mFileSize = static_cast<std::size_t>(info.st_size);
+        return column_file_error::none;
+#else
+        std::FILE* file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            return column_file_error::io_error;
+        }
+        bool read = std::fseek(file, 0, SEEK_END) == 0;
+        const long size = read ? std::ftell(file) : -1;
+        read = size >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+        if (read) {
+            mBuffer.resize((static_cast<std::size_t>(size) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+            read = std::fread(mBuffer.data(), 1, static_cast<std::size_t>(size), file) == static_cast<std::size_t>(size);
+        }
+        std::fclose(file);
+        if (!read) {
+            return column_file_error::io_error;
+        }
+        mFileSize = static_cast<std::size_t>(size);
+        return static_cast<std::size_t>(size) < COLUMN_FILE_HEADER_SIZE ? column_file_error::truncated : column_file_error::none;
+#endif
+    }
+
+    column_file_error validate() noexcept {
+        const unsigned char* head = data();
+        const column_file_error error = check_header(head);
+        if (error != column_file_error::none) {
+            close();
+            return error;
+        }
+        mSize = static_cast<std::size_t>(detail::load_le<uint64_t>(head + 16));
+        mBlockSize = static_cast<std::size_t>(detail::load_le<uint64_t>(head + 24));
+        const std::size_t statisticsOffset = static_cast<std::size_t>(detail::load_le<uint64_t>(head + 32));
+        mStatistics = (head[7] & detail::COLUMN_FILE_STATISTICS) != 0 ? head + statisticsOffset : nullptr;
+        mValues = reinterpret_cast<const DecimalT*>(head + detail::load_le<uint64_t>(head + 40));
+        return column_file_error::none;
+    }
+
+    column_file_error check_header(const unsigned char* head) const noexcept {
+        constexpr std::size_t WIDTH = sizeof(underlying_type);
+        if (std::memcmp(head, detail::COLUMN_FILE_MAGIC, sizeof(detail::COLUMN_FILE_MAGIC)) != 0) {
+            return column_file_error::invalid_header;
+        }
+        if (detail::load_le<uint16_t>(head + 4) != COLUMN_FILE_VERSION) {
+            return column_file_error::unsupported_version;
+        }
+        if (head[6] != WIDTH || ((head[7] & detail::COLUMN_FILE_SIGNED) != 0) != std::is_signed<underlying_type>::value) {
+            return column_file_error::type_mismatch;
+        }
+        if (static_cast<signed char>(head[8]) != DecimalT::PRECISION) {
+            return column_file_error::precision_mismatch;
+        }
+        const uint64_t count = detail::load_le<uint64_t>(head + 16);
+        const uint64_t blockSize = detail::load_le<uint64_t>(head + 24);
+        const uint64_t statisticsOffset = detail::load_le<uint64_t>(head + 32);
+        const uint64_t dataOffset = detail::load_le<uint64_t>(head + 40);
+        const bool statistics = (head[7] & detail::COLUMN_FILE_STATISTICS) != 0;
+        if (blockSize == 0 || blockSize % 64 != 0 || dataOffset % COLUMN_FILE_ALIGNMENT != 0
+                || dataOffset < COLUMN_FILE_HEADER_SIZE || (statistics && statisticsOffset < COLUMN_FILE_HEADER_SIZE)) {
+            return column_file_error::invalid_header;
+        }
+        // sizes are checked with divisions, so that corrupted counts cannot overflow
+        const uint64_t size = mFileSize;
+        const uint64_t blocks = count / blockSize + (count % blockSize != 0 ? 1 : 0);
+        if (dataOffset > size || count > (size - dataOffset) / WIDTH
+                || (statistics && (statisticsOffset > dataOffset || blocks > (dataOffset - statisticsOffset) / (2 * WIDTH)))) {
+            return column_file_error::truncated;
+        }
+        return column_file_error::none;
+    }
+
+    void* mMapping = nullptr;
+    std::size_t mFileSize = 0;
+    std::vector<std::max_align_t> mBuffer;  // file contents where mapping is not supported
+    const DecimalT* mValues = nullptr;
+    const unsigned char* mStatistics = nullptr;
+    std::size_t mSize = 0;
+    std::size_t mBlockSize = 0;
+};
+
+}  // namespace strict
@@ -0,0 +1,252 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace strict
+{
+
+enum class compare_op : uint8_t
+{
+    equal,
+    not_equal,
+    less,
+    less_equal,
+    greater,
+    greater_equal,
+};
+
+// Number of 64 bit words of a bitmask with one bit per value
+constexpr std::size_t bitmask_words(std::size_t count) noexcept {
+    return (count + 63) / 64;
+}
+
+namespace detail
+{
+
+// Scalar of any precision expressed by a nominator of the column type: `nominator` is the scalar if `exact`,
+// otherwise the scalar lies strictly between `nominator` and the next nominator. `belowAll` is set if the scalar is
+// less than any value of the column type.
+template<typename UnderlyingType>
+struct compare_threshold
+{
+    UnderlyingType nominator{};
+    bool exact = true;
+    bool belowAll = false;
+};
+
+template<typename DecimalT, typename ScalarUnderlyingType, int ScalarPrecision>
+compare_threshold<typename DecimalT::underlying_type> make_threshold(const decimal_t<ScalarUnderlyingType, ScalarPrecision>& scalar) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using ScalarT = decimal_t<ScalarUnderlyingType, ScalarPrecision>;
+    using OperatingType = select_operating_type_t<UnderlyingType, ScalarUnderlyingType>;
+    constexpr bool SIGNED = std::is_signed<UnderlyingType>::value;
+    switch (special_rank<ScalarT>(scalar.nominator())) {
+    case 2: return {DecimalT::NAN_VALUE, true, false};
+    case 1: return {DecimalT::INFINITY_PLUS, true, false};
+    case -1: return SIGNED ? compare_threshold<UnderlyingType>{DecimalT::INFINITY_MINUS, true, false}
+                           : compare_threshold<UnderlyingType>{UnderlyingType{}, false, true};
+    default: break;
+    }
+
+    const auto minFinite = static_cast<OperatingType>(SIGNED ? DecimalT::INFINITY_MINUS + 1 : 0);
+    const auto maxFinite = static_cast<OperatingType>(DecimalT::INFINITY_PLUS - 1);
+    auto nominator = static_cast<OperatingType>(scalar.nominator());
+    bool exact = true;
+    bool above = false;
+    bool below = false;
+    if constexpr (ScalarT::PRECISION > DecimalT::PRECISION) {
+        constexpr int SHIFT = ScalarT::PRECISION - DecimalT::PRECISION;
+        OperatingType remainder = nominator;
+        nominator = 0;
+        if constexpr (SHIFT <= std::numeric_limits<OperatingType>::digits10) {
+            nominator = remainder / Power10<OperatingType>(SHIFT);
+            remainder = remainder % Power10<OperatingType>(SHIFT);
+        }
+        if (remainder < 0) {
+            --nominator;  // floor
+        }
+        exact = remainder == 0;
+    } else if constexpr (ScalarT::PRECISION < DecimalT::PRECISION) {
+        constexpr int SHIFT = DecimalT::PRECISION - ScalarT::PRECISION;
+        if constexpr (SHIFT <= std::numeric_limits<OperatingType>::digits10) {
+            const OperatingType limit = std::numeric_limits<OperatingType>::max() / Power10<OperatingType>(SHIFT);
+            above = nominator > limit;
+            below = nominator < -limit;
+            nominator *= above || below ? 0 : Power10<OperatingType>(SHIFT);
+        } else {
+            above = nominator > 0;
+            below = nominator < 0;
+        }
+    }
+    if (above || nominator > maxFinite) {
+        return {static_cast<UnderlyingType>(maxFinite), false, false};
+    }
+    if (below || nominator < minFinite) {
+        return SIGNED ? compare_threshold<UnderlyingType>{DecimalT::INFINITY_MINUS, false, false}
+                      : compare_threshold<UnderlyingType>{UnderlyingType{}, false, true};
+    }
+    return {static_cast<UnderlyingType>(nominator), exact, false};
+}
+
+enum class base_compare : uint8_t { less, equal, greater };
+
+template<base_compare Op, typename UnderlyingType>
+inline uint64_t compare_word_scalar(const UnderlyingType* values, std::size_t count, UnderlyingType threshold) noexcept {
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool match = Op == base_compare::less ? values[i] < threshold
+                         : Op == base_compare::equal ? values[i] == threshold
+                                                     : values[i] > threshold;
+        mask |= static_cast<uint64_t>(match) << i;
+    }
+    return mask;
+}
+
+#if defined(__AVX2__)
+template<base_compare Op>
+inline uint64_t compare_word_avx2(const int64_t* values, int64_t threshold) noexcept {
+    const __m256i pivot = _mm256_set1_epi64x(threshold);
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < 64; i += 4) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        const __m256i match = Op == base_compare::less ? _mm256_cmpgt_epi64(pivot, value)
+                            : Op == base_compare::equal ? _mm256_cmpeq_epi64(value, pivot)
+                                                        : _mm256_cmpgt_epi64(value, pivot);
+        mask |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(match))) << i;
+    }
+    return mask;
+}
+
+template<base_compare Op>
+inline uint64_t compare_word_avx2(const int32_t* values, int32_t threshold) noexcept {
+    const __m256i pivot = _mm256_set1_epi32(threshold);
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < 64; i += 8) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        const __m256i match = Op == base_compare::less ? _mm256_cmpgt_epi32(pivot, value)
+                            : Op == base_compare::equal ? _mm256_cmpeq_epi32(value, pivot)
+                                                        : _mm256_cmpgt_epi32(value, pivot);
+        mask |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(match))) << i;
+    }
+    return mask;
+}
+#endif
+
+// Sets bitmask bits of values satisfying `Op` (negated if `invert`), 64 values per word
+template<base_compare Op, typename UnderlyingType>
+void compare_nominators(const UnderlyingType* values, std::size_t count, UnderlyingType threshold, bool invert, uint64_t* bitmask) noexcept {
+    const uint64_t inversion = invert ? ~uint64_t{0} : 0;
+    std::size_t word = 0;
+    for (; (word + 1) * 64 <= count; ++word) {
+#if defined(__AVX2__)
+        if constexpr (std::is_same<UnderlyingType, int64_t>::value || std::is_same<UnderlyingType, int32_t>::value) {
+            bitmask[word] = compare_word_avx2<Op>(values + word * 64, threshold) ^ inversion;
+            continue;
+        }
+#endif
+        bitmask[word] = compare_word_scalar<Op>(values + word * 64, 64, threshold) ^ inversion;
+    }
+    if (word * 64 < count) {
+        const std::size_t rest = count - word * 64;
+        bitmask[word] = (compare_word_scalar<Op>(values + word * 64, rest, threshold) ^ inversion) & ((uint64_t{1} << rest) - 1);
+    }
+}
+
+// Compares nominators with a threshold made by make_threshold(), bitmask must have bitmask_words(count) words
+template<typename UnderlyingType>
+void compare_with_threshold(const UnderlyingType* nominators, std::size_t count, compare_op op,
+                            const compare_threshold<UnderlyingType>& threshold, uint64_t* bitmask) noexcept {
+    bool all = threshold.belowAll && (op == compare_op::not_equal || op == compare_op::greater || op == compare_op::greater_equal);
+    bool none = threshold.belowAll && !all;
+    if (!threshold.exact && !threshold.belowAll) {
+        all = op == compare_op::not_equal;
+        none = op == compare_op::equal;
+    }
+    if (all || none) {
+        for (std::size_t word = 0; word < bitmask_words(count); ++word) {
+            const std::size_t rest = count - word * 64;
+            bitmask[word] = none ? 0 : rest >= 64 ? ~uint64_t{0} : (uint64_t{1} << rest) - 1;
+        }
+        return;
+    }
+
+    // scalar between threshold and the next nominator: v < scalar <=> v <= threshold, v > scalar <=> v > threshold
+    const bool between = !threshold.exact;
+    const UnderlyingType pivot = threshold.nominator;
+    switch (op) {
+    case compare_op::equal: return compare_nominators<base_compare::equal>(nominators, count, pivot, false, bitmask);
+    case compare_op::not_equal: return compare_nominators<base_compare::equal>(nominators, count, pivot, true, bitmask);
+    case compare_op::less:
+        return between ? compare_nominators<base_compare::greater>(nominators, count, pivot, true, bitmask)
+                       : compare_nominators<base_compare::less>(nominators, count, pivot, false, bitmask);
+    case compare_op::less_equal: return compare_nominators<base_compare::greater>(nominators, count, pivot, true, bitmask);
+    case compare_op::greater: return compare_nominators<base_compare::greater>(nominators, count, pivot, false, bitmask);
+    case compare_op::greater_equal:
+        return between ? compare_nominators<base_compare::greater>(nominators, count, pivot, false, bitmask)
+                       : compare_nominators<base_compare::less>(nominators, count, pivot, true, bitmask);
+    }
+}
+
+}  // namespace detail
+
+// Sets bit i of `bitmask` (bitmask_words(values.size()) words, bit i % 64 of word i / 64) if `values[i] op scalar`.
+// The scalar may have any precision and is compared exactly, as by compare(). Columns of 32 and 64 bit nominators
+// are compared with AVX2 instructions when available.
+template<typename DecimalT, typename ScalarUnderlyingType, int ScalarPrecision>
+void compare_column(span<const DecimalT> values, compare_op op, const decimal_t<ScalarUnderlyingType, ScalarPrecision>& scalar,
+                    span<uint64_t> bitmask) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    detail::compare_with_threshold(reinterpret_cast<const UnderlyingType*>(values.data()), values.size(), op,
+                                   detail::make_threshold<DecimalT>(scalar), bitmask.data());
+}
+
+}  // namespace strict
@@ -0,0 +1,382 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_math.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Compounding and discounting of cash flows. Growth factors (1 + rate)^n are computed exactly when the power fits in
+// 128 bits and by exponentiation by squaring of 120 bit fixed point numbers otherwise, so that only the result is
+// rounded (half away from zero), never intermediate factors as in repeated multiplication of decimals.
+
+namespace strict
+{
+
+namespace detail
+{
+
+// Growth factor 1 + rate = numerator / 10^digits, reduced by common powers of 10
+struct growth_factor
+{
+    fixed_t numerator;
+    int digits;
+};
+
+// False if the rate is not finite or not above -1
+template<typename DecimalT>
+bool make_growth_factor(const DecimalT& rate, growth_factor& res) noexcept {
+    using WideT = signed_fixed_t;
+    const WideT numerator = static_cast<WideT>(Power10<uint64_t>(DecimalT::PRECISION)) + static_cast<WideT>(rate.nominator());
+    if (special_rank<DecimalT>(rate.nominator()) != 0 || numerator <= 0) {
+        return false;
+    }
+    res = {static_cast<fixed_t>(numerator), DecimalT::PRECISION};
+    while (res.digits > 0 && res.numerator % 10 == 0) {
+        res.numerator /= 10;
+        --res.digits;
+    }
+    return true;
+}
+
+// Nominator magnitude of growth^exponent with `precision` digits rounded half up, false if intermediate values do
+// not fit in 128 bits
+inline bool exact_growth(const growth_factor& growth, int64_t exponent, int precision, fixed_t& res) noexcept {
+    const uint64_t magnitude = exponent < 0 ? uint64_t{0} - static_cast<uint64_t>(exponent) : static_cast<uint64_t>(exponent);
+    if (magnitude > 128) {
+        return false;
+    }
+    fixed_t power = 1;
+    for (uint64_t idx = 0; idx < magnitude; ++idx) {
+        if (__builtin_mul_overflow(power, growth.numerator, &power)) {
+            return false;
+        }
+    }
+    // growth^n = numerator^n / 10^(digits n), growth^-n = 10^(digits n) / numerator^n
+    const int64_t scale = static_cast<int64_t>(growth.digits) * static_cast<int64_t>(magnitude);
+    fixed_t dividend = power;
+    fixed_t divisor = 1;
+    if (exponent < 0) {
+        if (scale + precision > 38) {
+            return false;
+        }
+        dividend = Power10<fixed_t>(static_cast<int>(scale) + precision);
+        divisor = power;
+    } else if (scale > precision) {
+        if (scale - precision > 38) {
+            res = 0;  // power < 2^128 < 10^39 / 2
+            return true;
+        }
+        divisor = Power10<fixed_t>(static_cast<int>(scale - precision));
+    } else if (__builtin_mul_overflow(power, Power10<fixed_t>(static_cast<int>(precision - scale)), &dividend)) {
+        return false;
+    }
+    const fixed_t remainder = dividend % divisor;
+    res = dividend / divisor + (remainder >= divisor - remainder ? 1 : 0);
+    return true;
+}
+
+// Exponents of fixed_power are clamped to this range, beyond it values are rounded to zero or infinity anyway
+constexpr int MAX_FIXED_EXPONENT = 1 << 20;
+
+inline fixed_power fixed_product(const fixed_power& lhs, const fixed_power& rhs) noexcept {
+    fixed_power res{fixed_multiply(lhs.mantissa, rhs.mantissa), lhs.exponent + rhs.exponent};
+    if (res.mantissa >= 2 * FIXED_ONE) {
+        res.mantissa >>= 1;
+        ++res.exponent;
+    }
+    res.exponent = std::min(std::max(res.exponent, -MAX_FIXED_EXPONENT), MAX_FIXED_EXPONENT);
+    return res;
+}
+
+// numerator / denominator, both positive
+inline fixed_power fixed_quotient(fixed_t numerator, uint64_t denominator) noexcept {
+    // numerator * 2^shift / denominator is in [2^120, 2^122)
+    const int shift = FIXED_BITS + 1 + (64 - __builtin_clzll(denominator)) - (128 - count_leading_zeros(numerator));
+    const uint256 dividend = shift >= 128 ? uint256{numerator << (shift - 128), 0}
+                                          : uint256{numerator >> (128 - shift), numerator << shift};
+    fixed_power res{divide_wide(dividend, denominator).low, FIXED_BITS - shift};
+    if (res.mantissa >= 2 * FIXED_ONE) {
+        res.mantissa >>= 1;
+        ++res.exponent;
+    }
+    return res;
+}
+
+// 1 / value: estimate from double refined by two Newton iterations r = r (2 - m r)
+inline fixed_power fixed_reciprocal(const fixed_power& value) noexcept {
+    const double mantissa = static_cast<double>(static_cast<uint64_t>(value.mantissa >> (FIXED_BITS - 62))) / static_cast<double>(uint64_t{1} << 62);
+    fixed_t reciprocal = static_cast<fixed_t>(static_cast<uint64_t>(static_cast<double>(uint64_t{1} << 62) / mantissa)) << (FIXED_BITS - 62);
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        reciprocal = fixed_multiply(reciprocal, 2 * FIXED_ONE - fixed_multiply(value.mantissa, reciprocal));
+    }
+    if (reciprocal < FIXED_ONE) {
+        return {reciprocal << 1, -value.exponent - 1};
+    }
+    return {reciprocal, -value.exponent};
+}
+
+// value^exponent by squaring, relative error below about 2 exponent 2^-120
+inline fixed_power fixed_pow(fixed_power value, uint64_t exponent) noexcept {
+    fixed_power res{FIXED_ONE, 0};
+    for (; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            res = fixed_product(res, value);
+        }
+        if (exponent > 1) {
+            value = fixed_product(value, value);
+        }
+    }
+    return res;
+}
+
+inline fixed_power fixed_growth(const growth_factor& growth) noexcept {
+    return fixed_quotient(growth.numerator, Power10<uint64_t>(growth.digits));
+}
+
+inline uint256 multiply_narrow(fixed_t lhs, uint64_t rhs) noexcept {
+    const fixed_t low = fixed_t{static_cast<uint64_t>(lhs)} * rhs;
+    const fixed_t high = fixed_t{static_cast<uint64_t>(lhs >> 64)} * rhs + (low >> 64);
+    return {high >> 64, (high << 64) | static_cast<uint64_t>(low)};
+}
+
+// Sum of nonnegative 256 bit numbers, false on overflow
+inline bool add_wide(uint256& sum, const uint256& value) noexcept {
+    const fixed_t low = sum.low + value.low;
+    const fixed_t carry = low < value.low ? 1 : 0;
+    const fixed_t high = sum.high + value.high + carry;
+    const bool overflow = high < sum.high || (high == sum.high && (value.high != 0 || carry != 0));
+    sum = {high, low};
+    return !overflow;
+}
+
+inline uint256 subtract_wide(const uint256& lhs, const uint256& rhs) noexcept {
+    return {lhs.high - rhs.high - (lhs.low < rhs.low ? 1 : 0), lhs.low - rhs.low};
+}
+
+inline bool less_wide(const uint256& lhs, const uint256& rhs) noexcept {
+    return lhs.high != rhs.high ? lhs.high < rhs.high : lhs.low < rhs.low;
+}
+
+inline uint256 shift_wide(const uint256& value, int shift) noexcept {
+    if (shift >= 0) {
+        // callers keep values below 2^(256 - shift)
+        if (shift == 0) {
+            return value;
+        }
+        if (shift >= 256) {
+            return {0, 0};
+        }
+        return shift >= 128 ? uint256{value.low << (shift - 128), 0}
+                            : uint256{(value.high << shift) | (value.low >> (128 - shift)), value.low << shift};
+    }
+    shift = -shift;
+    if (shift >= 256) {
+        return {0, 0};
+    }
+    if (shift >= 128) {
+        return {0, value.high >> (shift - 128)};
+    }
+    return {value.high >> shift, (value.low >> shift) | (shift == 0 ? 0 : value.high << (128 - shift))};
+}
+
+// Adds sums of products with factors of the same exponent to sums and clears them, returns infinity bits of
+// overflowing sums as in npv()
+inline int add_run(uint256 (&sums)[2], uint256 (&runSums)[2], int exponent) noexcept {
+    int infinities = 0;
+    for (int sign = 0; sign < 2; ++sign) {
+        if (!add_wide(sums[sign], shift_wide(runSums[sign], exponent))) {
+            infinities |= 1 << sign;
+        }
+        runSums[sign] = {0, 0};
+    }
+    return infinities;
+}
+
+}  // namespace detail
+
+// (1 + rate)^periods rounded once to precision of the rate; negative periods give discount factors. NaN if the rate
+// is NaN, -inf or not above -1 (except for zero periods, which give 1); +inf gives +inf or 0.
+template<typename UnderlyingType, int Precision>
+decimal_t<UnderlyingType, Precision> compound(const decimal_t<UnderlyingType, Precision>& rate, int64_t periods) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    static_assert(sizeof(UnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    if (periods == 0) {
+        return detail::from_magnitude<DecimalT>(Power10<uint64_t>(Precision), false);
+    }
+    if (rate.nominator() == DecimalT::INFINITY_PLUS) {
+        return detail::make_decimal<DecimalT>(periods > 0 ? DecimalT::INFINITY_PLUS : 0);
+    }
+    detail::growth_factor growth{};
+    if (!detail::make_growth_factor(rate, growth)) {
+        const bool zeroGrowth = static_cast<detail::signed_fixed_t>(rate.nominator()) + Power10<uint64_t>(Precision) == 0;
+        return detail::make_decimal<DecimalT>(!zeroGrowth ? DecimalT::NAN_VALUE : periods > 0 ? 0 : DecimalT::INFINITY_PLUS);
+    }
+    detail::fixed_t exact = 0;
+    if (detail::exact_growth(growth, periods, Precision, exact)) {
+        return detail::from_magnitude<DecimalT>(exact, false);
+    }
+    const uint64_t magnitude = periods < 0 ? uint64_t{0} - static_cast<uint64_t>(periods) : static_cast<uint64_t>(periods);
+    const detail::fixed_power power = detail::fixed_pow(detail::fixed_growth(growth), magnitude);
+    return detail::from_power<DecimalT>(periods < 0 ? detail::fixed_reciprocal(power) : power, false);
+}
+
+// factors[i] = (1 + rate)^-i, i.e. discount factors of periods 0, 1, ..., each rounded once as by compound(). Factors
+// are updated in O(1) per period, NaN if the rate is not valid for compound().
+template<typename DecimalT>
+void discount_factors(const DecimalT& rate, span<DecimalT> factors) noexcept {
+    detail::growth_factor growth{};
+    if (!detail::make_growth_factor(rate, growth)) {
+        for (std::size_t idx = 0; idx < factors.size(); ++idx) {
+            factors[idx] = compound(rate, -static_cast<int64_t>(idx));
+        }
+        return;
+    }
+    std::size_t idx = 0;
+    detail::fixed_t exact = 0;
+    for (; idx < factors.size() && detail::exact_growth(growth, -static_cast<int64_t>(idx), DecimalT::PRECISION, exact); ++idx) {
+        factors[idx] = detail::from_magnitude<DecimalT>(exact, false);
+    }
+    if (idx == factors.size()) {
+        return;
+    }
+    const detail::fixed_power discount = detail::fixed_reciprocal(detail::fixed_growth(growth));
+    for (detail::fixed_power power = detail::fixed_pow(discount, idx); idx < factors.size(); ++idx) {
+        factors[idx] = detail::from_power<DecimalT>(power, false);
+        power = detail::fixed_product(power, discount);
+    }
+}
+
+// Present value sum(cashflows[i] * factors[i]), products summed exactly and rounded (half away from zero) once to
+// precision of cash flows. Sums are kept in the wide operating type together with the number of times they wrapped
+// around; a sum which does not fit in it is far beyond the range of cash flows and gives +inf/-inf. NaN if any value
+// is NaN, infinite values give infinite results (NaN for both signs or infinity times zero). Spans must have equal
+// size.
+template<typename CashT, typename FactorT>
+CashT present_value(span<const CashT> cashflows, span<const FactorT> factors) noexcept {
+    using WideT = select_operating_type_t<typename CashT::underlying_type, typename FactorT::underlying_type>;
+    WideT sum = 0;
+    int64_t wraps = 0;  // multiples of 2^N added to (positive) or subtracted from (negative) the wrapped sum
+    int infinities = 0;  // bit 0 for +inf, bit 1 for -inf, bit 2 for NaN
+    for (std::size_t idx = 0; idx < cashflows.size(); ++idx) {
+        const int cashRank = detail::special_rank<CashT>(cashflows[idx].nominator());
+        const int factorRank = detail::special_rank<FactorT>(factors[idx].nominator());
+        if ((cashRank | factorRank) == 0) {
+            // products of nominators fit in the wide type, only their sum may not
+            const WideT product = static_cast<WideT>(cashflows[idx].nominator()) * static_cast<WideT>(factors[idx].nominator());
+            if (detail::add_overflows(sum, product, sum)) {
+                wraps += product < 0 ? -1 : 1;
+            }
+        } else if (cashRank == 2 || factorRank == 2 || cashflows[idx].nominator() == 0 || factors[idx].nominator() == 0) {
+            infinities |= 4;
+        } else {
+            const bool negative = (cashflows[idx].nominator() < 0) != (factors[idx].nominator() < 0);
+            infinities |= negative ? 2 : 1;
+        }
+    }
+    if (infinities != 0) {
+        return CashT{typename CashT::nominator_t{infinities == 1 ? CashT::INFINITY_PLUS : infinities == 2 ? CashT::INFINITY_MINUS : CashT::NAN_VALUE}};
+    }
+    if (wraps != 0) {
+        return CashT{typename CashT::nominator_t{wraps > 0 ? CashT::INFINITY_PLUS : CashT::INFINITY_MINUS}};
+    }
+    constexpr auto DENOMINATOR = static_cast<WideT>(Power10<uint64_t>(FactorT::PRECISION));
+    return detail::saturate_wide<CashT>(detail::divide_rounded(sum, DENOMINATOR));
+}
+
+// Net present value sum(cashflows[i] / (1 + rate)^i) of cash flows of periods 0, 1, ... Discounted cash flows are
+// summed in 120 bit fixed point and rounded (half away from zero) once to precision of cash flows; sums within the
+// error bound of a midpoint between decimals are taken as midpoints. NaN if the rate is not valid for compound() or
+// if a cash flow is NaN, infinite cash flows give infinite results (NaN for both signs).
+template<typename CashT, typename RateT>
+CashT npv(const RateT& rate, span<const CashT> cashflows) noexcept {
+    using detail::uint256;
+    detail::growth_factor growth{};
+    if (!detail::make_growth_factor(rate, growth)) {
+        return CashT{typename CashT::nominator_t{CashT::NAN_VALUE}};
+    }
+    const detail::fixed_power discount = detail::fixed_reciprocal(detail::fixed_growth(growth));
+    detail::fixed_power factor{detail::FIXED_ONE, 0};
+    // sums of positive and negative discounted cash flows, fixed point nominators with FIXED_BITS fraction bits.
+    // Exponents of factors change rarely, so products are summed unshifted while the exponent stays the same.
+    uint256 sums[2] = {{0, 0}, {0, 0}};
+    uint256 runSums[2] = {{0, 0}, {0, 0}};
+    int runExponent = 0;
+    int infinities = 0;  // bit 0 for +inf, bit 1 for -inf, bit 2 for NaN
+    for (std::size_t idx = 0; idx < cashflows.size(); ++idx, factor = detail::fixed_product(factor, discount)) {
+        const auto nominator = cashflows[idx].nominator();
+        if (factor.exponent != runExponent) {
+            infinities |= detail::add_run(sums, runSums, runExponent);
+            runExponent = factor.exponent;
+        }
+        const int rank = detail::special_rank<CashT>(nominator);
+        // products have at most 64 + 121 + 63 bits, larger ones overflow nominators of cash flows anyway
+        if (rank != 0 || (factor.exponent >= 64 && nominator != 0)) {
+            infinities |= rank == 2 ? 4 : nominator < 0 ? 2 : 1;
+            continue;
+        }
+        const auto magnitude = static_cast<uint64_t>(detail::decimal_magnitude(cashflows[idx]));
+        detail::add_wide(runSums[nominator < 0 ? 1 : 0], detail::multiply_narrow(factor.mantissa, magnitude));
+    }
+    infinities |= detail::add_run(sums, runSums, runExponent);
+    const uint256& positive = sums[0];
+    const uint256& negative = sums[1];
+    if (infinities != 0) {
+        return CashT{typename CashT::nominator_t{infinities == 1 ? CashT::INFINITY_PLUS : infinities == 2 ? CashT::INFINITY_MINUS : CashT::NAN_VALUE}};
+    }
+    const bool negativeSum = detail::less_wide(positive, negative);
+    uint256 magnitude = negativeSum ? detail::subtract_wide(negative, positive) : detail::subtract_wide(positive, negative);
+    // error of factors is below (idx + 1) 2^-117 of their value and products are truncated, so adding this bound
+    // rounds values near midpoints away from zero
+    const int countBits = 64 - __builtin_clzll(static_cast<uint64_t>(cashflows.size()) | 1);
+    uint256 bound = detail::shift_wide(positive, countBits - 116);
+    if (!detail::add_wide(bound, detail::shift_wide(negative, countBits - 116)) || !detail::add_wide(bound, uint256{0, cashflows.size()}) ||
+        !detail::add_wide(magnitude, bound)) {
+        return CashT{typename CashT::nominator_t{negativeSum ? CashT::INFINITY_MINUS : CashT::INFINITY_PLUS}};
+    }
+    return detail::from_magnitude<CashT>(detail::shift_rounded(magnitude, detail::FIXED_BITS), negativeSum);
+}
+
+}  // namespace strict
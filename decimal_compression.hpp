@@ -0,0 +1,428 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_serialization.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace strict
+{
+
+enum class compression_codec : uint8_t
+{
+    frame_of_reference,  // value - block minimum
+    delta,               // zigzag encoded difference to the value LANES positions earlier (first values: to block's first value)
+    xor_delta,           // bitwise xor with the value LANES positions earlier (first values: with block's first value)
+};
+
+namespace detail
+{
+
+inline unsigned bit_width(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return value == 0 ? 0u : 64u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+    unsigned width = 0;
+    for (; value != 0; value >>= 1) {
+        ++width;
+    }
+    return width;
+#endif
+}
+
+// Values of a block are distributed round robin over COMPRESSION_LANES lanes, so value i is stored in lane
+// i % COMPRESSION_LANES. Every lane is bit packed separately and words of lanes are interleaved, therefore bit
+// offsets are equal in all lanes and a block is unpacked with vertical (SIMD) operations only.
+constexpr std::size_t COMPRESSION_LANES = 4;
+constexpr std::size_t COMPRESSION_BLOCK_SIZE = 128;
+constexpr std::size_t VALUES_PER_LANE = COMPRESSION_BLOCK_SIZE / COMPRESSION_LANES;
+
+constexpr std::size_t packed_words(unsigned width) noexcept {
+    return (VALUES_PER_LANE * width + 63) / 64 * COMPRESSION_LANES;
+}
+
+inline void pack_block_scalar(const uint64_t* codes, unsigned width, uint64_t* words) noexcept {
+    std::fill(words, words + packed_words(width), uint64_t{0});
+    for (std::size_t k = 0; k < VALUES_PER_LANE; ++k) {
+        const std::size_t bit = k * width;
+        const std::size_t word = bit / 64 * COMPRESSION_LANES;
+        const unsigned shift = static_cast<unsigned>(bit % 64);
+        for (std::size_t lane = 0; lane < COMPRESSION_LANES; ++lane) {
+            const uint64_t code = codes[k * COMPRESSION_LANES + lane];
+            words[word + lane] |= code << shift;
+            if (shift + width > 64) {
+                words[word + COMPRESSION_LANES + lane] |= code >> (64 - shift);
+            }
+        }
+    }
+}
+
+template<compression_codec Codec>
+inline uint64_t decode_code(uint64_t code, uint64_t& previous, uint64_t base) noexcept {
+    switch (Codec) {
+    case compression_codec::frame_of_reference: return base + code;
+    case compression_codec::delta: return previous += zigzag_decode<int64_t>(code);
+    default: return previous ^= code;
+    }
+}
+
+template<compression_codec Codec>
+inline void unpack_block_scalar(const uint64_t* words, unsigned width, uint64_t base, uint64_t* out) noexcept {
+    const uint64_t mask = width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+    uint64_t previous[COMPRESSION_LANES] = {base, base, base, base};
+    for (std::size_t k = 0; k < VALUES_PER_LANE; ++k) {
+        const std::size_t bit = k * width;
+        const std::size_t word = bit / 64 * COMPRESSION_LANES;
+        const unsigned shift = static_cast<unsigned>(bit % 64);
+        const bool spill = shift + width > 64;
+        for (std::size_t lane = 0; lane < COMPRESSION_LANES; ++lane) {
+            uint64_t code = words[word + lane] >> shift;
+            if (spill) {
+                code |= words[word + COMPRESSION_LANES + lane] << (64 - shift);
+            }
+            out[k * COMPRESSION_LANES + lane] = decode_code<Codec>(code & mask, previous[lane], base);
+        }
+    }
+}
+
+#if defined(__AVX2__)
+
+// Codes of all lanes for one position are shifted and stored together, the mirror image of unpack_block_avx2
+inline void pack_block_avx2(const uint64_t* codes, unsigned width, uint64_t* words) noexcept {
+    std::fill(words, words + packed_words(width), uint64_t{0});
+    for (std::size_t k = 0; k < VALUES_PER_LANE; ++k) {
+        const std::size_t bit = k * width;
+        const std::size_t word = bit / 64 * COMPRESSION_LANES;
+        const int shift = static_cast<int>(bit % 64);
+        const __m256i code = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + k * COMPRESSION_LANES));
+        __m256i* const current = reinterpret_cast<__m256i*>(words + word);
+        _mm256_storeu_si256(current, _mm256_or_si256(_mm256_loadu_si256(current), _mm256_sll_epi64(code, _mm_cvtsi32_si128(shift))));
+        if (shift + width > 64) {
+            __m256i* const next = reinterpret_cast<__m256i*>(words + word + COMPRESSION_LANES);
+            _mm256_storeu_si256(next, _mm256_srl_epi64(code, _mm_cvtsi32_si128(64 - shift)));
+        }
+    }
+}
+
+template<compression_codec Codec>
+inline void unpack_block_avx2(const uint64_t* words, unsigned width, uint64_t base, uint64_t* out) noexcept {
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1));
+    const __m256i baseVector = _mm256_set1_epi64x(static_cast<long long>(base));
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i previous = baseVector;
+    for (std::size_t k = 0; k < VALUES_PER_LANE; ++k) {
+        const std::size_t bit = k * width;
+        const std::size_t word = bit / 64 * COMPRESSION_LANES;
+        const int shift = static_cast<int>(bit % 64);
+        __m256i code = _mm256_srl_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + word)), _mm_cvtsi32_si128(shift));
+        if (shift + width > 64) {
+            const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + word + COMPRESSION_LANES));
+            code = _mm256_or_si256(code, _mm256_sll_epi64(next, _mm_cvtsi32_si128(64 - shift)));
+        }
+        code = _mm256_and_si256(code, mask);
+        switch (Codec) {
+        case compression_codec::frame_of_reference:
+            previous = _mm256_add_epi64(baseVector, code);
+            break;
+        case compression_codec::delta: {
+            const __m256i sign = _mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(code, one));
+            previous = _mm256_add_epi64(previous, _mm256_xor_si256(_mm256_srli_epi64(code, 1), sign));
+            break;
+        }
+        default:
+            previous = _mm256_xor_si256(previous, code);
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k * COMPRESSION_LANES), previous);
+    }
+}
+
+#endif
+
+inline void pack_block(const uint64_t* codes, unsigned width, uint64_t* words) noexcept {
+#if defined(__AVX2__)
+    pack_block_avx2(codes, width, words);
+#else
+    pack_block_scalar(codes, width, words);
+#endif
+}
+
+template<compression_codec Codec>
+inline void unpack_block(const uint64_t* words, unsigned width, uint64_t base, uint64_t* out) noexcept {
+    if (width == 0) {
+        // all codes are zero, which decodes to the base value for every codec
+        std::fill(out, out + COMPRESSION_BLOCK_SIZE, base);
+        return;
+    }
+#if defined(__AVX2__)
+    unpack_block_avx2<Codec>(words, width, base, out);
+#else
+    unpack_block_scalar<Codec>(words, width, base, out);
+#endif
+}
+
+}  // namespace detail
+
+// Column of decimals compressed in blocks of BLOCK_SIZE values. Every block is encoded independently
+// (random access by block) and keeps its minimum and maximum, so block statistics are available without decoding.
+// Sentinel values (NaN, infinities) are stored losslessly and treated as plain nominators by min() and max(). Sums
+// skip NaN and propagate infinities, like decimal_aggregate; headers count sentinels of every block for that.
+template<typename DecimalT>
+class compressed_column
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    static_assert(sizeof(underlying_type) <= sizeof(uint64_t), "underlying type of at most 64 bits is required");
+    static constexpr std::size_t BLOCK_SIZE = detail::COMPRESSION_BLOCK_SIZE;
+
+    struct block_header
+    {
+        underlying_type min{};
+        underlying_type max{};
+        underlying_type base{};  // minimum for frame of reference, first value for other codecs
+        std::size_t wordOffset = 0;
+        unsigned bitWidth = 0;
+        // numbers of NaN, +inf and -inf values in the block
+        uint8_t nans = 0;
+        uint8_t plusInfinities = 0;
+        uint8_t minusInfinities = 0;
+    };
+
+    explicit compressed_column(compression_codec codec = compression_codec::delta) : mCodec(codec) {
+    }
+
+    static compressed_column compress(span<const DecimalT> values, compression_codec codec) {
+        compressed_column res(codec);
+        res.append(values);
+        return res;
+    }
+
+    // Appends values; the last incomplete block is re-encoded when further values are appended
+    void append(span<const DecimalT> values) {
+        std::size_t idx = 0;
+        if (mSize % BLOCK_SIZE != 0) {
+            std::vector<DecimalT> tail(mSize % BLOCK_SIZE, DecimalT{});
+            decode_block(mHeaders.size() - 1, span<DecimalT>(tail.data(), tail.size()));
+            mWords.resize(mHeaders.back().wordOffset);
+            mHeaders.pop_back();
+            mSize -= tail.size();
+            const std::size_t taken = std::min(values.size(), BLOCK_SIZE - tail.size());
+            tail.insert(tail.end(), values.begin(), values.begin() + taken);
+            encode_block(tail.data(), tail.size());
+            idx = taken;
+        }
+        for (; idx < values.size(); idx += BLOCK_SIZE) {
+            encode_block(values.data() + idx, std::min(BLOCK_SIZE, values.size() - idx));
+        }
+    }
+
+    compression_codec codec() const { return mCodec; }
+    std::size_t size() const { return mSize; }
+    std::size_t block_count() const { return mHeaders.size(); }
+    std::size_t block_size(std::size_t block) const { return std::min(BLOCK_SIZE, mSize - block * BLOCK_SIZE); }
+    const block_header& header(std::size_t block) const { return mHeaders[block]; }
+    std::size_t compressed_bytes() const { return mWords.size() * sizeof(uint64_t) + mHeaders.size() * sizeof(block_header); }
+
+    // Decodes block to `out` which has to hold block_size(block) values
+    void decode_block(std::size_t block, span<DecimalT> out) const {
+        uint64_t decoded[BLOCK_SIZE];
+        unpack(block, decoded);
+        const std::size_t count = block_size(block);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = DecimalT{typename DecimalT::nominator_t{static_cast<underlying_type>(decoded[i])}};
+        }
+    }
+
+    void decompress(span<DecimalT> out) const {
+        for (std::size_t block = 0; block < mHeaders.size(); ++block) {
+            decode_block(block, out.subspan(block * BLOCK_SIZE, block_size(block)));
+        }
+    }
+
+    DecimalT at(std::size_t idx) const {
+        uint64_t decoded[BLOCK_SIZE];
+        unpack(idx / BLOCK_SIZE, decoded);
+        return DecimalT{typename DecimalT::nominator_t{static_cast<underlying_type>(decoded[idx % BLOCK_SIZE])}};
+    }
+
+    DecimalT block_min(std::size_t block) const { return DecimalT{typename DecimalT::nominator_t{mHeaders[block].min}}; }
+    DecimalT block_max(std::size_t block) const { return DecimalT{typename DecimalT::nominator_t{mHeaders[block].max}}; }
+
+    // Minimum and maximum of the whole column computed from block headers only; column must not be empty
+    DecimalT min() const {
+        underlying_type res = mHeaders.front().min;
+        for (const auto& header : mHeaders) {
+            res = std::min(res, header.min);
+        }
+        return DecimalT{typename DecimalT::nominator_t{res}};
+    }
+    DecimalT max() const {
+        underlying_type res = mHeaders.front().max;
+        for (const auto& header : mHeaders) {
+            res = std::max(res, header.max);
+        }
+        return DecimalT{typename DecimalT::nominator_t{res}};
+    }
+
+    // Sum of finite values of the block accumulated in the wide operating type while unpacking; frame of reference
+    // blocks add the minimum once per block instead of once per value. Sentinels are summed as well and subtracted
+    // afterwards using counts from the header, so the loops stay branch free.
+    select_operating_type_t<underlying_type, underlying_type> block_sum(std::size_t block) const {
+        using OperatingType = select_operating_type_t<underlying_type, underlying_type>;
+        const auto& header = mHeaders[block];
+        const std::size_t count = block_size(block);
+        uint64_t decoded[BLOCK_SIZE];
+        OperatingType res{};
+        if (mCodec == compression_codec::frame_of_reference) {
+            detail::unpack_block<compression_codec::frame_of_reference>(mWords.data() + header.wordOffset, header.bitWidth, 0, decoded);
+            for (std::size_t i = 0; i < count; ++i) {
+                res += static_cast<OperatingType>(decoded[i]);
+            }
+            res += static_cast<OperatingType>(header.min) * static_cast<OperatingType>(count);
+        } else {
+            unpack(block, decoded);
+            for (std::size_t i = 0; i < count; ++i) {
+                res += static_cast<OperatingType>(static_cast<underlying_type>(decoded[i]));
+            }
+        }
+        return res - static_cast<OperatingType>(DecimalT::NAN_VALUE) * header.nans
+                   - static_cast<OperatingType>(DecimalT::INFINITY_PLUS) * header.plusInfinities
+                   - static_cast<OperatingType>(DecimalT::INFINITY_MINUS) * header.minusInfinities;
+    }
+
+    // Sum of all values; accumulated in the wide operating type and narrowed to the decimal at the end, +inf/-inf
+    // if it does not fit. NaN values are skipped, infinite values make the sum infinite (NaN if both signs occurred).
+    DecimalT sum() const {
+        select_operating_type_t<underlying_type, underlying_type> res{};
+        bool plusInfinity = false;
+        bool minusInfinity = false;
+        for (std::size_t block = 0; block < mHeaders.size(); ++block) {
+            plusInfinity = plusInfinity || mHeaders[block].plusInfinities != 0;
+            minusInfinity = minusInfinity || mHeaders[block].minusInfinities != 0;
+            res += block_sum(block);
+        }
+        if (plusInfinity || minusInfinity) {
+            return DecimalT{typename DecimalT::nominator_t{plusInfinity && minusInfinity ? DecimalT::NAN_VALUE
+                                                           : plusInfinity ? DecimalT::INFINITY_PLUS : DecimalT::INFINITY_MINUS}};
+        }
+        return detail::saturate_wide<DecimalT>(res);
+    }
+
+private:
+    static uint64_t to_code(underlying_type value) noexcept {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+
+    void encode_block(const DecimalT* values, std::size_t count) {
+        block_header header;
+        header.min = header.max = values[0].nominator();
+        for (std::size_t i = 0; i < count; ++i) {
+            const underlying_type nominator = values[i].nominator();
+            header.min = std::min(header.min, nominator);
+            header.max = std::max(header.max, nominator);
+            header.nans += nominator == DecimalT::NAN_VALUE;
+            header.plusInfinities += nominator == DecimalT::INFINITY_PLUS;
+            header.minusInfinities += std::is_signed<underlying_type>::value && nominator == DecimalT::INFINITY_MINUS;
+        }
+
+        // incomplete block is padded with its last value to keep codes small
+        uint64_t raw[BLOCK_SIZE];
+        for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+            raw[i] = to_code(values[std::min(i, count - 1)].nominator());
+        }
+        header.base = mCodec == compression_codec::frame_of_reference ? header.min : values[0].nominator();
+        const uint64_t base = to_code(header.base);
+        uint64_t codes[BLOCK_SIZE];
+        uint64_t combined = 0;
+        for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+            const uint64_t previous = i < detail::COMPRESSION_LANES ? base : raw[i - detail::COMPRESSION_LANES];
+            switch (mCodec) {
+            case compression_codec::frame_of_reference: codes[i] = raw[i] - base; break;
+            case compression_codec::delta: codes[i] = detail::zigzag_encode(static_cast<int64_t>(raw[i] - previous)); break;
+            default: codes[i] = raw[i] ^ previous; break;
+            }
+            combined |= codes[i];
+        }
+
+        header.bitWidth = detail::bit_width(combined);
+        header.wordOffset = mWords.size();
+        mWords.resize(mWords.size() + detail::packed_words(header.bitWidth));
+        if (header.bitWidth != 0) {
+            detail::pack_block(codes, header.bitWidth, mWords.data() + header.wordOffset);
+        }
+        mHeaders.push_back(header);
+        mSize += count;
+    }
+
+    void unpack(std::size_t block, uint64_t* out) const {
+        const auto& header = mHeaders[block];
+        const uint64_t* words = mWords.data() + header.wordOffset;
+        const uint64_t base = to_code(header.base);
+        switch (mCodec) {
+        case compression_codec::frame_of_reference:
+            detail::unpack_block<compression_codec::frame_of_reference>(words, header.bitWidth, base, out);
+            break;
+        case compression_codec::delta:
+            detail::unpack_block<compression_codec::delta>(words, header.bitWidth, base, out);
+            break;
+        default:
+            detail::unpack_block<compression_codec::xor_delta>(words, header.bitWidth, base, out);
+            break;
+        }
+    }
+
+    compression_codec mCodec;
+    std::size_t mSize = 0;
+    std::vector<block_header> mHeaders;
+    std::vector<uint64_t> mWords;
+};
+
+}  // namespace strict
@@ -0,0 +1,295 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace strict
+{
+
+struct csv_options
+{
+    char delimiter = ',';
+    bool skipHeader = true;
+    // Size of blocks read from file by the I/O thread
+    std::size_t blockSize = 4u << 20;
+};
+
+// Parses selected columns of CSV text directly into decimal columns. Text may be provided in arbitrary chunks,
+// lines split between chunks are carried over internally. Quoted fields containing delimiters are not supported.
+// Fields which cannot be parsed (and missing fields) are stored as NAN_VALUE and counted in invalid_fields().
+template<typename DecimalT>
+class csv_column_parser
+{
+public:
+    explicit csv_column_parser(std::vector<std::size_t> columnIndices, csv_options options = {})
+        : mOptions(options), mColumns(columnIndices.size()) {
+        std::size_t maxIndex = 0;
+        for (std::size_t idx : columnIndices) {
+            maxIndex = std::max(maxIndex, idx);
+        }
+        mFieldToColumn.assign(columnIndices.empty() ? 0 : maxIndex + 1, NOT_SELECTED);
+        for (std::size_t column = 0; column < columnIndices.size(); ++column) {
+            mFieldToColumn[columnIndices[column]] = column;
+        }
+        mSkipLine = options.skipHeader;
+    }
+
+    // Parses all complete lines from the chunk, the incomplete last line is kept until next call of parse() or finish()
+    void parse(const char* first, const char* last) {
+        if (!mCarry.empty()) {
+            const char* newline = static_cast<const char*>(std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+            if (newline == nullptr) {
+                mCarry.insert(mCarry.end(), first, last);
+                return;
+            }
+            mCarry.insert(mCarry.end(), first, newline);
+            parse_line(mCarry.data(), mCarry.data() + mCarry.size());
+            mCarry.clear();
+            first = newline + 1;
+        }
+        for (;;) {
+            const char* newline = static_cast<const char*>(std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+            if (newline == nullptr) {
+                break;
+            }
+            parse_line(first, newline);
+            first = newline + 1;
+        }
+        mCarry.assign(first, last);
+    }
+
+    // Parses the last line if it was not terminated with a new line character
+    void finish() {
+        if (!mCarry.empty()) {
+            parse_line(mCarry.data(), mCarry.data() + mCarry.size());
+            mCarry.clear();
+        }
+    }
+
+    const csv_options& options() const { return mOptions; }
+    const std::vector<std::vector<DecimalT>>& columns() const { return mColumns; }
+    std::vector<std::vector<DecimalT>> release_columns() { return std::move(mColumns); }
+    std::size_t rows() const { return mRows; }
+    std::size_t invalid_fields() const { return mInvalidFields; }
+
+private:
+    static constexpr std::size_t NOT_SELECTED = static_cast<std::size_t>(-1);
+
+    void parse_line(const char* first, const char* last) {
+        if (last != first && last[-1] == '\r') {
+            --last;
+        }
+        if (mSkipLine) {
+            mSkipLine = false;
+            return;
+        }
+        if (first == last) {
+            return;
+        }
+        for (auto& column : mColumns) {
+            column.emplace_back(typename DecimalT::nominator_t{DecimalT::NAN_VALUE});
+        }
+        std::size_t selected = 0;
+        for (std::size_t field = 0; field < mFieldToColumn.size() && selected < mColumns.size(); ++field) {
+            const char* fieldEnd = static_cast<const char*>(std::memchr(first, mOptions.delimiter, static_cast<std::size_t>(last - first)));
+            if (fieldEnd == nullptr) {
+                fieldEnd = last;
+            }
+            const std::size_t column = mFieldToColumn[field];
+            if (column != NOT_SELECTED) {
+                ++selected;
+                parse_field(first, fieldEnd, mColumns[column].back());
+            }
+            if (fieldEnd == last) {
+                break;
+            }
+            first = fieldEnd + 1;
+        }
+        mInvalidFields += mColumns.size() - selected;
+        ++mRows;
+    }
+
+    void parse_field(const char* first, const char* last, DecimalT& value) {
+        while (first != last && (*first == ' ' || *first == '"')) ++first;
+        while (last != first && (last[-1] == ' ' || last[-1] == '"')) --last;
+        const auto res = strict::from_chars(first, last, value);
+        if (res.ec != std::errc{} || res.ptr != last) {
+            value = DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}};
+            ++mInvalidFields;
+        }
+    }
+
+    csv_options mOptions;
+    std::vector<std::size_t> mFieldToColumn;
+    std::vector<std::vector<DecimalT>> mColumns;
+    std::vector<char> mCarry;
+    std::size_t mRows = 0;
+    std::size_t mInvalidFields = 0;
+    bool mSkipLine = false;
+};
+
+namespace detail
+{
+
+// Blocks exchanged between the I/O thread and the parsing thread
+class csv_block_queue
+{
+public:
+    struct block_t
+    {
+        std::vector<char> data;
+        std::size_t size = 0;
+    };
+
+    csv_block_queue(std::size_t blockCount, std::size_t blockSize) {
+        for (std::size_t i = 0; i < blockCount; ++i) {
+            mFree.push_back(block_t{std::vector<char>(blockSize), 0});
+        }
+    }
+
+    block_t acquire_free() { return pop(mFree); }
+    void release_free(block_t block) { push(mFree, std::move(block)); }
+    // Block with size 0 marks the end of data
+    block_t acquire_filled() { return pop(mFilled); }
+    void release_filled(block_t block) { push(mFilled, std::move(block)); }
+
+private:
+    block_t pop(std::deque<block_t>& queue) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [&queue] { return !queue.empty(); });
+        block_t block = std::move(queue.front());
+        queue.pop_front();
+        return block;
+    }
+
+    void push(std::deque<block_t>& queue, block_t block) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            queue.push_back(std::move(block));
+        }
+        mCondition.notify_all();
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<block_t> mFree;
+    std::deque<block_t> mFilled;
+};
+
+}  // namespace detail
+
+// Reads the whole file in large blocks on a separate I/O thread while the calling thread parses previously
+// read blocks. Returns false if the file cannot be opened or a read error occurred. If parsing throws, the I/O
+// thread is stopped and joined and the file is closed before the exception propagates.
+template<typename DecimalT>
+bool read_csv_file(const std::string& path, csv_column_parser<DecimalT>& parser) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    detail::csv_block_queue queue(3, std::max<std::size_t>(parser.options().blockSize, 1));
+    bool readError = false;
+    std::atomic<bool> cancelled{false};
+    std::thread reader([file, &queue, &readError, &cancelled] {
+        for (;;) {
+            auto block = queue.acquire_free();
+            block.size = cancelled ? 0 : std::fread(block.data.data(), 1, block.data.size(), file);
+            const bool finished = block.size == 0;
+            if (finished && std::ferror(file)) {
+                readError = true;
+            }
+            queue.release_filled(std::move(block));
+            if (finished) {
+                return;
+            }
+        }
+    });
+
+    // Joins the reader and closes the file on every path; blocks are returned to the reader until it has sent the
+    // end of data, so that it never waits for a free block forever
+    struct reader_guard
+    {
+        std::thread& reader;
+        detail::csv_block_queue& queue;
+        std::atomic<bool>& cancelled;
+        std::FILE* file;
+        bool endReached = false;
+
+        ~reader_guard() {
+            cancelled = true;
+            while (!endReached) {
+                auto block = queue.acquire_filled();
+                endReached = block.size == 0;
+                queue.release_free(std::move(block));
+            }
+            reader.join();
+            std::fclose(file);
+        }
+    };
+
+    {
+        reader_guard guard{reader, queue, cancelled, file, false};
+        while (!guard.endReached) {
+            auto block = queue.acquire_filled();
+            guard.endReached = block.size == 0;
+            if (!guard.endReached) {
+                parser.parse(block.data.data(), block.data.data() + block.size);
+            }
+            queue.release_free(std::move(block));
+        }
+    }
+    parser.finish();
+    return !readError;
+}
+
+}  // namespace strict
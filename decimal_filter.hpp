@@ -0,0 +1,245 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_compare.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace strict
+{
+
+// Bitmask helpers; bitmasks hold one bit per row, bit i % 64 of word i / 64, bits past the last row are zero
+
+inline void bitmask_and(span<uint64_t> target, span<const uint64_t> other) noexcept {
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        target[i] &= other[i];
+    }
+}
+
+inline void bitmask_or(span<uint64_t> target, span<const uint64_t> other) noexcept {
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        target[i] |= other[i];
+    }
+}
+
+// Negates bits of first `rows` rows
+inline void bitmask_not(span<uint64_t> target, std::size_t rows) noexcept {
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        const std::size_t rest = rows - std::min(rows, i * 64);
+        target[i] = ~target[i] & (rest >= 64 ? ~uint64_t{0} : (uint64_t{1} << rest) - 1);
+    }
+}
+
+inline std::size_t bitmask_count(span<const uint64_t> bitmask) noexcept {
+    std::size_t count = 0;
+    for (const uint64_t word : bitmask) {
+#if defined(__GNUC__) || defined(__clang__)
+        count += static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+        for (uint64_t bits = word; bits != 0; bits &= bits - 1) {
+            ++count;
+        }
+#endif
+    }
+    return count;
+}
+
+// Writes indices of set bits to `selection` in ascending order, which must have room for bitmask_count() indices.
+// Returns number of written indices.
+inline std::size_t bitmask_to_selection(span<const uint64_t> bitmask, uint32_t* selection) noexcept {
+    std::size_t count = 0;
+    for (std::size_t word = 0; word < bitmask.size(); ++word) {
+        for (uint64_t bits = bitmask[word]; bits != 0; bits &= bits - 1) {
+#if defined(__GNUC__) || defined(__clang__)
+            const auto bit = static_cast<uint32_t>(__builtin_ctzll(bits));
+#else
+            uint32_t bit = 0;
+            while (((bits >> bit) & 1) == 0) {
+                ++bit;
+            }
+#endif
+            selection[count++] = static_cast<uint32_t>(word * 64) + bit;
+        }
+    }
+    return count;
+}
+
+// Conjunctions and disjunctions of comparisons of columns with constants, e.g. `price > limit && qty <= max`.
+// Constants are converted to thresholds of column types when terms are added; evaluation runs over chunks of rows
+// small enough to keep intermediate bitmasks in L1 cache, comparing nominators with SIMD instructions (see
+// compare_column). Terms are combined from left to right and AND terms are skipped for chunks with no rows left.
+// All columns must have `rows` values, which must be less than 2^32.
+class column_filter
+{
+public:
+    static constexpr std::size_t CHUNK_ROWS = 4096;
+
+    explicit column_filter(std::size_t rows) : mRows(rows) {
+    }
+
+    std::size_t rows() const noexcept { return mRows; }
+
+    // Rows for which `column op constant` holds, combined with previous terms with AND
+    template<typename DecimalT, typename ConstantUnderlyingType, int ConstantPrecision>
+    column_filter& where(span<const DecimalT> column, compare_op op, const decimal_t<ConstantUnderlyingType, ConstantPrecision>& constant) {
+        mTerms.push_back({false, make_comparison<DecimalT>(column, op, constant)});
+        return *this;
+    }
+
+    // Rows for which `column op constant` holds, combined with previous terms with OR
+    template<typename DecimalT, typename ConstantUnderlyingType, int ConstantPrecision>
+    column_filter& or_where(span<const DecimalT> column, compare_op op, const decimal_t<ConstantUnderlyingType, ConstantPrecision>& constant) {
+        mTerms.push_back({true, make_comparison<DecimalT>(column, op, constant)});
+        return *this;
+    }
+
+    // Rows for which `low <= column <= high` holds, combined with previous terms with AND
+    template<typename DecimalT, typename LowDecimalT, typename HighDecimalT>
+    column_filter& where_between(span<const DecimalT> column, const LowDecimalT& low, const HighDecimalT& high) {
+        mTerms.push_back({false, make_range<DecimalT>(column, low, high)});
+        return *this;
+    }
+
+    // Rows whose values lie within bounds of `RangedDecimalT`, combined with previous terms with AND
+    template<typename RangedDecimalT, typename DecimalT>
+    column_filter& where_in_range(span<const DecimalT> column) {
+        using BaseT = typename RangedDecimalT::base_type;
+        return where_between<DecimalT>(column, BaseT{typename BaseT::nominator_t{RangedDecimalT::NOMINATOR_MIN_VALUE}},
+                                       BaseT{typename BaseT::nominator_t{RangedDecimalT::NOMINATOR_MAX_VALUE}});
+    }
+
+    // Writes bitmask of matching rows, `bitmask` must have bitmask_words(rows()) words. Without terms all rows match.
+    void evaluate(span<uint64_t> bitmask) const {
+        uint64_t scratch[CHUNK_ROWS / 64];
+        for (std::size_t first = 0; first < mRows; first += CHUNK_ROWS) {
+            const std::size_t rows = std::min(CHUNK_ROWS, mRows - first);
+            const std::size_t words = bitmask_words(rows);
+            uint64_t* const result = bitmask.data() + first / 64;
+            if (mTerms.empty()) {
+                std::fill(result, result + words, uint64_t{0});
+                bitmask_not(span<uint64_t>(result, words), rows);
+                continue;
+            }
+            mTerms.front().evaluate(first, rows, result);
+            bool empty = is_empty(result, words);
+            for (std::size_t term = 1; term < mTerms.size(); ++term) {
+                if (!mTerms[term].disjunction && empty) {
+                    continue;
+                }
+                mTerms[term].evaluate(first, rows, scratch);
+                if (mTerms[term].disjunction) {
+                    bitmask_or(span<uint64_t>(result, words), span<const uint64_t>(scratch, words));
+                } else {
+                    bitmask_and(span<uint64_t>(result, words), span<const uint64_t>(scratch, words));
+                }
+                empty = is_empty(result, words);
+            }
+        }
+    }
+
+    std::vector<uint64_t> bitmask() const {
+        std::vector<uint64_t> res(bitmask_words(mRows));
+        evaluate(res);
+        return res;
+    }
+
+    // Indices of matching rows in ascending order
+    std::vector<uint32_t> selection() const {
+        const std::vector<uint64_t> matching = bitmask();
+        std::vector<uint32_t> res(bitmask_count(matching));
+        bitmask_to_selection(matching, res.data());
+        return res;
+    }
+
+    std::size_t count() const {
+        return bitmask_count(bitmask());
+    }
+
+private:
+    using evaluator = std::function<void(std::size_t first, std::size_t rows, uint64_t* bitmask)>;
+
+    struct term
+    {
+        bool disjunction;
+        evaluator evaluate;
+    };
+
+    template<typename DecimalT, typename ConstantUnderlyingType, int ConstantPrecision>
+    static evaluator make_comparison(span<const DecimalT> column, compare_op op, const decimal_t<ConstantUnderlyingType, ConstantPrecision>& constant) {
+        using UnderlyingType = typename DecimalT::underlying_type;
+        static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+        const auto* nominators = reinterpret_cast<const UnderlyingType*>(column.data());
+        const auto threshold = detail::make_threshold<DecimalT>(constant);
+        return [nominators, op, threshold](std::size_t first, std::size_t rows, uint64_t* bitmask) {
+            detail::compare_with_threshold(nominators + first, rows, op, threshold, bitmask);
+        };
+    }
+
+    template<typename DecimalT, typename LowDecimalT, typename HighDecimalT>
+    static evaluator make_range(span<const DecimalT> column, const LowDecimalT& low, const HighDecimalT& high) {
+        const evaluator lower = make_comparison<DecimalT>(column, compare_op::greater_equal, low);
+        const evaluator upper = make_comparison<DecimalT>(column, compare_op::less_equal, high);
+        return [lower, upper](std::size_t first, std::size_t rows, uint64_t* bitmask) {
+            uint64_t scratch[CHUNK_ROWS / 64];
+            lower(first, rows, bitmask);
+            upper(first, rows, scratch);
+            bitmask_and(span<uint64_t>(bitmask, bitmask_words(rows)), span<const uint64_t>(scratch, bitmask_words(rows)));
+        };
+    }
+
+    static bool is_empty(const uint64_t* words, std::size_t count) noexcept {
+        uint64_t any = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            any |= words[i];
+        }
+        return any == 0;
+    }
+
+    std::size_t mRows;
+    std::vector<term> mTerms;
+};
+
+}  // namespace strict
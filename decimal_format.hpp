@@ -0,0 +1,315 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus > 201703L && __has_include(<format>)
+#include <format>
+#endif
+
+namespace strict
+{
+
+// Number of bytes which guarantees that format_column() does not write past the end of output buffer
+template<typename DecimalT>
+constexpr std::size_t max_formatted_column_size(std::size_t count) noexcept {
+    return count * (static_cast<std::size_t>(DecimalT::MAX_STRING_LENGTH) + 1);
+}
+
+// Writes all decimals from the column to `out`, delimited with `separator` (no separator after the last value).
+// The output buffer has to hold at least max_formatted_column_size<DecimalT>(column.size()) characters.
+// Returns pointer past the last written character.
+template<typename DecimalT>
+char* format_column(span<const DecimalT> column, char* out, char separator) noexcept {
+    if (column.empty()) {
+        return out;
+    }
+    const DecimalT* it = column.data();
+    const DecimalT* const last = it + column.size() - 1;
+    for (; it != last; ++it) {
+        out = it->to_chars(out);
+        *out++ = separator;
+    }
+    return last->to_chars(out);
+}
+
+// Format specification of a decimal, subset of the standard format specification with grouping:
+//   [[fill]align][sign][0][width][grouping][.precision][f]
+// align is '<', '>' or '^' (numbers are right aligned by default), sign is '-', '+' or ' ', '0' pads with zeros
+// after the sign, grouping is ',' or '_' inserted between thousands of the integer part, and precision is the
+// number of displayed fraction digits. Values are rounded half away from zero to fewer digits than PRECISION and
+// padded with zeros to more. NaN and infinities are written as by to_chars(), without zero padding.
+struct decimal_format_spec
+{
+    char fill = ' ';
+    char align = 0;      // 0 if not specified
+    char sign = '-';
+    bool zeroPad = false;
+    char grouping = 0;   // 0 if integer digits are not grouped
+    int width = 0;
+    int precision = -1;  // -1 if PRECISION of the decimal is displayed
+};
+
+constexpr int MAX_FORMAT_WIDTH = 1 << 16;
+
+namespace detail
+{
+
+template<typename It>
+constexpr bool parse_format_number(It& it, It last, int& value) noexcept {
+    value = 0;
+    const It first = it;
+    for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+        value = value * 10 + (*it - '0');
+        if (value > MAX_FORMAT_WIDTH) {
+            return false;
+        }
+    }
+    return it != first;
+}
+
+}  // namespace detail
+
+// Parses a format specification from [it, last) up to a closing brace or the end. On success `it` points past the
+// specification. Returns false if the specification is invalid.
+template<typename It>
+constexpr bool parse_format_spec(It& it, It last, decimal_format_spec& spec) noexcept {
+    const auto isAlign = [](char c) { return c == '<' || c == '>' || c == '^'; };
+    if (it == last || *it == '}') {
+        return true;
+    }
+    It next = it;
+    ++next;
+    if (next != last && isAlign(*next) && *it != '{' && *it != '}') {
+        spec.fill = *it;
+        spec.align = *next;
+        it = ++next;
+    } else if (isAlign(*it)) {
+        spec.align = *it++;
+    }
+    if (it != last && (*it == '-' || *it == '+' || *it == ' ')) {
+        spec.sign = *it++;
+    }
+    if (it != last && *it == '0') {
+        spec.zeroPad = true;
+        ++it;
+    }
+    if (it != last && *it >= '1' && *it <= '9' && !detail::parse_format_number(it, last, spec.width)) {
+        return false;
+    }
+    if (it != last && (*it == ',' || *it == '_')) {
+        spec.grouping = *it++;
+    }
+    if (it != last && *it == '.') {
+        ++it;
+        if (!detail::parse_format_number(it, last, spec.precision)) {
+            return false;
+        }
+    }
+    if (it != last && *it == 'f') {
+        ++it;
+    }
+    return it == last || *it == '}';
+}
+
+// Writes the value formatted according to `spec` to the output iterator and returns the iterator past it.
+// Sign, digits and separators are composed in a stack buffer; nothing is allocated.
+template<typename DecimalT, typename OutputIt>
+OutputIt format_to(OutputIt out, const DecimalT& value, const decimal_format_spec& spec) {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    constexpr int PRECISION = DecimalT::PRECISION;
+    constexpr int MAX_INTEGER_DIGITS = std::numeric_limits<UnsignedT>::digits10 + 1;
+    if constexpr (INSTRUMENTATION_ENABLED) {
+        ++detail::thread_counters().formats;
+    }
+
+    const UnderlyingType nominator = value.nominator();
+    bool negative = false;
+    UnsignedT magnitude = static_cast<UnsignedT>(nominator);
+    if constexpr (std::is_signed<UnderlyingType>::value) {
+        if (nominator < 0) {
+            negative = true;
+            magnitude = static_cast<UnsignedT>(UnsignedT{0} - magnitude);
+        }
+    }
+    const char sign = negative ? '-' : spec.sign == '-' ? 0 : spec.sign;
+    const int shown = spec.precision < 0 ? PRECISION : spec.precision;
+
+    // digits without sign are written backward from the end of the buffer; fraction digits beyond PRECISION are
+    // zeros written directly to the output
+    char buffer[MAX_INTEGER_DIGITS + MAX_INTEGER_DIGITS / 3 + 1 + PRECISION];
+    char* const last = buffer + sizeof(buffer);
+    char* first = last;
+    int zeros = 0;
+    bool special = false;
+    if constexpr (PRECISION != 0) {
+        if (nominator == DecimalT::NAN_VALUE || nominator == DecimalT::INFINITY_PLUS || nominator == DecimalT::INFINITY_MINUS) {
+            special = true;
+            first -= 3;
+            std::memcpy(first, nominator == DecimalT::NAN_VALUE ? "nan" : "inf", 3);
+        }
+    }
+    if (!special) {
+        // the common case of all digits displayed divides by the compile time DENOMINATOR
+        UnsignedT integerPart = magnitude / static_cast<UnsignedT>(DecimalT::DENOMINATOR);
+        UnsignedT fractionPart = magnitude % static_cast<UnsignedT>(DecimalT::DENOMINATOR);
+        if (shown >= PRECISION) {
+            if constexpr (PRECISION != 0) {
+                first = detail::write_digits_backward(first, fractionPart, PRECISION);
+            }
+            zeros = shown - PRECISION;
+        } else {
+            const UnsignedT divisor = static_cast<UnsignedT>(Power10<UnderlyingType>(PRECISION - shown));
+            const UnsignedT rest = fractionPart % divisor;
+            fractionPart = static_cast<UnsignedT>(fractionPart / divisor + (rest >= divisor / 2 ? 1 : 0));
+            // rounding carries to the integer part
+            if (fractionPart == static_cast<UnsignedT>(Power10<UnderlyingType>(shown))) {
+                fractionPart = 0;
+                ++integerPart;
+            }
+            first = detail::write_digits_backward(first, fractionPart, shown);
+        }
+        if (shown > 0) {
+            *--first = '.';
+        }
+        if (spec.grouping != 0) {
+            for (; integerPart >= 1000; integerPart /= 1000) {
+                first = detail::write_digits_backward(first, static_cast<UnsignedT>(integerPart % 1000), 3);
+                *--first = spec.grouping;
+            }
+        }
+        first = detail::write_digits_backward(first, integerPart, detail::count_digits(integerPart));
+    }
+
+    const int length = (sign != 0 ? 1 : 0) + static_cast<int>(last - first) + zeros;
+    const int padding = std::max(0, spec.width - length);
+    const bool zeroPad = spec.zeroPad && spec.align == 0 && !special;
+    const char align = spec.align != 0 ? spec.align : '>';
+    const int before = zeroPad ? 0 : align == '>' ? padding : align == '^' ? padding / 2 : 0;
+    const auto fill = [&out](char c, int count) {
+        for (int i = 0; i < count; ++i) {
+            *out++ = c;
+        }
+    };
+
+    fill(spec.fill, before);
+    if (sign != 0) {
+        *out++ = sign;
+    }
+    if (zeroPad) {
+        fill('0', padding);
+    }
+    for (; first != last; ++first) {
+        *out++ = *first;
+    }
+    fill('0', zeros);
+    fill(spec.fill, zeroPad ? 0 : padding - before);
+    return out;
+}
+
+}  // namespace strict
+
+#if defined(__cpp_lib_format)
+
+// std::format support, e.g. std::format("{:>12,.2}", price); see decimal_format_spec for the specification
+template<typename UnderlyingType, int Precision>
+struct std::formatter<strict::decimal_t<UnderlyingType, Precision>, char>
+{
+    strict::decimal_format_spec spec;
+
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (!strict::parse_format_spec(it, ctx.end(), spec)) {
+            throw std::format_error("invalid format specification of decimal");
+        }
+        return it;
+    }
+
+    template<typename FormatContext>
+    typename FormatContext::iterator format(const strict::decimal_t<UnderlyingType, Precision>& value, FormatContext& ctx) const {
+        return strict::format_to(ctx.out(), value, spec);
+    }
+};
+
+template<typename UnderlyingType, int Precision, UnderlyingType MinValue, UnderlyingType MaxValue>
+struct std::formatter<strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>, char>
+    : std::formatter<typename strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>::base_type, char>
+{
+};
+
+#endif
+
+#if defined(FMT_VERSION)
+
+// {fmt} support when fmt/format.h is included before this header, with the same specification as std::format
+template<typename UnderlyingType, int Precision>
+struct fmt::formatter<strict::decimal_t<UnderlyingType, Precision>, char>
+{
+    strict::decimal_format_spec spec;
+
+    constexpr fmt::format_parse_context::iterator parse(fmt::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (!strict::parse_format_spec(it, ctx.end(), spec)) {
+            throw fmt::format_error("invalid format specification of decimal");
+        }
+        return it;
+    }
+
+    template<typename FormatContext>
+    typename FormatContext::iterator format(const strict::decimal_t<UnderlyingType, Precision>& value, FormatContext& ctx) const {
+        return strict::format_to(ctx.out(), value, spec);
+    }
+};
+
+template<typename UnderlyingType, int Precision, UnderlyingType MinValue, UnderlyingType MaxValue>
+struct fmt::formatter<strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>, char>
+    : fmt::formatter<typename strict::ranged_decimal_t<UnderlyingType, Precision, MinValue, MaxValue>::base_type, char>
+{
+};
+
+#endif
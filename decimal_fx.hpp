@@ -0,0 +1,341 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if !defined(__SIZEOF_INT128__)
+#error "decimal_fx.hpp requires 128 bit integers"
+#endif
+
+// Currency conversion with precomputed rate tables. Converting an amount with a rate is a multiplication by a
+// rational number (rate nominator and powers of 10 for precisions of the amount, the rate and the result), which
+// is reduced and stored per currency pair. Conversions multiply and divide integers once and round (half away from
+// zero) once, the division uses a precomputed reciprocal of the divisor.
+
+namespace strict
+{
+
+// Three letter currency code (e.g. ISO 4217 "EUR") as an integer identifying currencies in rate tables
+constexpr uint32_t currency_code(const char (&code)[4]) noexcept {
+    return (static_cast<uint32_t>(static_cast<unsigned char>(code[0])) << 16) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(code[1])) << 8) | static_cast<unsigned char>(code[2]);
+}
+
+namespace detail
+{
+
+// Nominator of a converted amount is round(nominator * multiplier / divisor)
+struct fx_multiplier
+{
+    uint64_t multiplier;
+    uint64_t divisor;
+    uint64_t reciprocal;  // floor(2^64 / divisor), 2^64 - 1 for divisor 1
+    uint64_t limit;       // largest nominator magnitude whose product with multiplier fits in 64 bits
+};
+
+inline unsigned __int128 gcd_wide(unsigned __int128 lhs, unsigned __int128 rhs) noexcept {
+    while (rhs != 0) {
+        lhs = std::exchange(rhs, lhs % rhs);
+    }
+    return lhs;
+}
+
+// multiplier / divisor reduced by their greatest common divisor, false if it does not fit in 64 bits
+inline bool make_fx_multiplier(unsigned __int128 multiplier, unsigned __int128 divisor, fx_multiplier& res) noexcept {
+    const unsigned __int128 divisorGcd = gcd_wide(multiplier, divisor);
+    multiplier /= divisorGcd;
+    divisor /= divisorGcd;
+    constexpr uint64_t MAX = std::numeric_limits<uint64_t>::max();
+    if (multiplier > MAX || divisor > MAX) {
+        return false;
+    }
+    res.multiplier = static_cast<uint64_t>(multiplier);
+    res.divisor = static_cast<uint64_t>(divisor);
+    res.reciprocal = divisor == 1 ? MAX : static_cast<uint64_t>((static_cast<unsigned __int128>(1) << 64) / divisor);
+    res.limit = res.multiplier == 0 ? MAX : MAX / res.multiplier;
+    return true;
+}
+
+template<typename ResultT, typename AmountT>
+ResultT fx_convert(const AmountT& amount, const fx_multiplier& multiplier) noexcept {
+    using UnsignedT = std::make_unsigned_t<typename AmountT::underlying_type>;
+    const auto nominator = amount.nominator();
+    switch (special_rank<AmountT>(nominator)) {
+    case 2: return ResultT{typename ResultT::nominator_t{ResultT::NAN_VALUE}};
+    case 1: return ResultT{typename ResultT::nominator_t{ResultT::INFINITY_PLUS}};
+    case -1: return ResultT{typename ResultT::nominator_t{ResultT::INFINITY_MINUS}};
+    default: break;
+    }
+    const bool negative = nominator < 0;
+    const uint64_t magnitude = negative ? UnsignedT{0} - static_cast<UnsignedT>(nominator) : static_cast<UnsignedT>(nominator);
+    unsigned __int128 quotient = 0;
+    if (magnitude <= multiplier.limit) {
+        // the reciprocal underestimates the quotient by at most 1
+        const uint64_t product = magnitude * multiplier.multiplier;
+        uint64_t narrowQuotient = static_cast<uint64_t>((static_cast<unsigned __int128>(product) * multiplier.reciprocal) >> 64);
+        uint64_t remainder = product - narrowQuotient * multiplier.divisor;
+        if (remainder >= multiplier.divisor) {
+            ++narrowQuotient;
+            remainder -= multiplier.divisor;
+        }
+        quotient = narrowQuotient + (remainder >= multiplier.divisor - remainder ? 1 : 0);
+    } else {
+        const unsigned __int128 product = static_cast<unsigned __int128>(magnitude) * multiplier.multiplier;
+        const unsigned __int128 remainder = product % multiplier.divisor;
+        quotient = product / multiplier.divisor + (remainder >= multiplier.divisor - remainder ? 1 : 0);
+    }
+    const auto wide = static_cast<__int128>(std::min(quotient, static_cast<unsigned __int128>(1) << 126));
+    return saturate_wide<ResultT>(negative ? -wide : wide);
+}
+
+// Column conversion: a branch free pass converts amounts whose products fit in 64 bits and whose results are finite,
+// the rest (including special values, whose magnitudes are larger) is converted again one by one
+template<typename ResultT, typename AmountT>
+void fx_convert_column(span<const AmountT> amounts, const fx_multiplier& multiplier, span<ResultT> results) noexcept {
+    using AmountUnsigned = std::make_unsigned_t<typename AmountT::underlying_type>;
+    using ResultUnderlying = typename ResultT::underlying_type;
+    constexpr bool UNSIGNED_RESULT = !std::is_signed<ResultUnderlying>::value;
+    // results of magnitudes up to `safe` are at most (safe * multiplier / divisor) + 1 <= largest finite nominator
+    const auto maxFinite = static_cast<unsigned __int128>(ResultT::INFINITY_PLUS - 1);
+    const auto maxAmount = static_cast<uint64_t>(std::numeric_limits<typename AmountT::underlying_type>::max() - 2);
+    const auto safe = static_cast<uint64_t>(std::min<unsigned __int128>({multiplier.limit, maxAmount, (maxFinite - 1) * multiplier.divisor / multiplier.multiplier}));
+    const auto magnitude_of = [](typename AmountT::underlying_type nominator) -> uint64_t {
+        return nominator < 0 ? AmountUnsigned{0} - static_cast<AmountUnsigned>(nominator) : static_cast<AmountUnsigned>(nominator);
+    };
+    bool fallback = false;
+    for (std::size_t idx = 0; idx < amounts.size(); ++idx) {
+        // signs are random in typical data, so they are applied with masks instead of (mispredicted) branches
+        const auto nominator = static_cast<uint64_t>(static_cast<int64_t>(amounts[idx].nominator()));
+        const uint64_t signMask = std::is_signed<typename AmountT::underlying_type>::value ? uint64_t{0} - (nominator >> 63) : 0;
+        const uint64_t magnitude = (nominator ^ signMask) - signMask;
+        const uint64_t product = magnitude * multiplier.multiplier;
+        uint64_t quotient = static_cast<uint64_t>((static_cast<unsigned __int128>(product) * multiplier.reciprocal) >> 64);
+        uint64_t remainder = product - quotient * multiplier.divisor;
+        const uint64_t underestimated = remainder >= multiplier.divisor;
+        quotient += underestimated;
+        remainder -= multiplier.divisor & (uint64_t{0} - underestimated);
+        quotient += remainder >= multiplier.divisor - remainder;
+        fallback |= (magnitude > safe) | (UNSIGNED_RESULT && signMask != 0);
+        results[idx] = ResultT{typename ResultT::nominator_t{static_cast<ResultUnderlying>((quotient ^ signMask) - signMask)}};
+    }
+    for (std::size_t idx = 0; fallback && idx < amounts.size(); ++idx) {
+        const auto nominator = amounts[idx].nominator();
+        if (magnitude_of(nominator) > safe || (UNSIGNED_RESULT && nominator < 0)) {
+            results[idx] = fx_convert<ResultT>(amounts[idx], multiplier);
+        }
+    }
+}
+
+}  // namespace detail
+
+// Rates of currency pairs with multipliers precomputed for converting amounts of type AmountT to ResultT. A rate of
+// base/quote is the price of one unit of base in units of quote; conversions of quote to base use its exact
+// reciprocal unless the opposite pair has its own rate. Tables are built once and read concurrently.
+template<typename AmountT, typename RateT, typename ResultT = AmountT>
+class fx_table
+{
+public:
+    fx_table() {
+        // converting to the same currency only changes precision
+        detail::make_fx_multiplier(Power10<unsigned __int128>(ResultT::PRECISION), Power10<unsigned __int128>(AmountT::PRECISION), mIdentity);
+    }
+
+    // Sets rate of base/quote, false if the rate is not finite and positive or its multipliers do not fit in 64 bits
+    bool set(uint32_t base, uint32_t quote, const RateT& rate) {
+        using Wide = unsigned __int128;
+        if (detail::special_rank<RateT>(rate.nominator()) != 0 || rate.nominator() <= 0 || base == quote) {
+            return false;
+        }
+        // result = amount * rate: nominators multiplied by nominator * 10^result / 10^(amount + rate)
+        const auto nominator = static_cast<Wide>(rate.nominator());
+        detail::fx_multiplier direct{};
+        detail::fx_multiplier inverse{};
+        if (!detail::make_fx_multiplier(nominator * Power10<Wide>(ResultT::PRECISION), Power10<Wide>(AmountT::PRECISION + RateT::PRECISION), direct) ||
+            !detail::make_fx_multiplier(Power10<Wide>(RateT::PRECISION + ResultT::PRECISION), nominator * Power10<Wide>(AmountT::PRECISION), inverse)) {
+            return false;
+        }
+        assign(key(base, quote), direct, true);
+        assign(key(quote, base), inverse, false);
+        return true;
+    }
+
+    // Number of currency pairs that can be converted, including reciprocals of set rates
+    std::size_t size() const noexcept { return mEntries.size(); }
+
+    bool contains(uint32_t from, uint32_t to) const noexcept { return find(from, to) != nullptr; }
+
+    // Amount in currency `from` converted to currency `to`, NaN if the pair is unknown
+    ResultT convert(const AmountT& amount, uint32_t from, uint32_t to) const noexcept {
+        const detail::fx_multiplier* multiplier = find(from, to);
+        return multiplier != nullptr ? detail::fx_convert<ResultT>(amount, *multiplier) : ResultT{typename ResultT::nominator_t{ResultT::NAN_VALUE}};
+    }
+
+    // Converts a column of amounts in one pass, spans must have equal size. False (and results are not written) if
+    // the pair is unknown.
+    bool convert(span<const AmountT> amounts, uint32_t from, uint32_t to, span<ResultT> results) const noexcept {
+        const detail::fx_multiplier* multiplier = find(from, to);
+        if (multiplier == nullptr) {
+            return false;
+        }
+        detail::fx_convert_column(amounts, *multiplier, results);
+        return true;
+    }
+
+    const detail::fx_multiplier* find(uint32_t from, uint32_t to) const noexcept {
+        if (from == to) {
+            return &mIdentity;
+        }
+        const uint64_t searched = key(from, to);
+        const auto it = std::lower_bound(mEntries.begin(), mEntries.end(), searched, [](const entry& lhs, uint64_t rhs) { return lhs.key < rhs; });
+        return it != mEntries.end() && it->key == searched ? &it->multiplier : nullptr;
+    }
+
+private:
+    struct entry
+    {
+        uint64_t key;
+        detail::fx_multiplier multiplier;
+        bool direct;  // false for reciprocals of rates of opposite pairs
+    };
+
+    static uint64_t key(uint32_t from, uint32_t to) noexcept { return (static_cast<uint64_t>(from) << 32) | to; }
+
+    void assign(uint64_t pair, const detail::fx_multiplier& multiplier, bool direct) {
+        const auto it = std::lower_bound(mEntries.begin(), mEntries.end(), pair, [](const entry& lhs, uint64_t rhs) { return lhs.key < rhs; });
+        if (it == mEntries.end() || it->key != pair) {
+            mEntries.insert(it, entry{pair, multiplier, direct});
+        } else if (direct || !it->direct) {
+            *it = entry{pair, multiplier, direct};
+        }
+    }
+
+    std::vector<entry> mEntries;  // sorted by key
+    detail::fx_multiplier mIdentity{};
+};
+
+// Converter whose rate table can be replaced while other threads convert. Readers never take locks: they announce
+// themselves in one of two counters selected by an epoch, and a replaced table is deleted by the writer only after
+// the counter of the epoch it was published in drops to zero.
+template<typename AmountT, typename RateT, typename ResultT = AmountT>
+class fx_converter
+{
+public:
+    using table_type = fx_table<AmountT, RateT, ResultT>;
+
+    explicit fx_converter(table_type table = table_type{}) : mTable(new table_type(std::move(table))) {
+    }
+
+    fx_converter(const fx_converter&) = delete;
+    fx_converter& operator=(const fx_converter&) = delete;
+
+    ~fx_converter() { delete mTable.load(); }
+
+    // Publishes a new table and deletes the previous one once no thread reads it. Concurrent updates are serialised.
+    void update(table_type table) {
+        auto* published = new table_type(std::move(table));
+        std::lock_guard<std::mutex> lock(mUpdateMutex);
+        const table_type* previous = mTable.exchange(published);
+        const unsigned epoch = mEpoch.load();
+        mEpoch.store(epoch + 1);
+        // readers which could have loaded the previous table entered in the old epoch
+        while (mReaders[epoch & 1].load() != 0) {
+            std::this_thread::yield();
+        }
+        delete previous;
+    }
+
+    // Calls fn(const table_type&) with the current table, which stays valid until fn returns
+    template<typename Fn>
+    decltype(auto) read(Fn&& fn) const {
+        const reader_guard guard(*this);
+        return fn(*mTable.load());
+    }
+
+    ResultT convert(const AmountT& amount, uint32_t from, uint32_t to) const noexcept {
+        return read([&](const table_type& table) { return table.convert(amount, from, to); });
+    }
+
+    bool convert(span<const AmountT> amounts, uint32_t from, uint32_t to, span<ResultT> results) const noexcept {
+        return read([&](const table_type& table) { return table.convert(amounts, from, to, results); });
+    }
+
+private:
+    class reader_guard
+    {
+    public:
+        explicit reader_guard(const fx_converter& converter) : mCounter(nullptr) {
+            // an update may switch the epoch between loading and incrementing, then the other counter is used
+            for (;;) {
+                const unsigned epoch = converter.mEpoch.load();
+                mCounter = &converter.mReaders[epoch & 1];
+                mCounter->fetch_add(1);
+                if (converter.mEpoch.load() == epoch) {
+                    break;
+                }
+                mCounter->fetch_sub(1);
+            }
+        }
+        reader_guard(const reader_guard&) = delete;
+        reader_guard& operator=(const reader_guard&) = delete;
+        ~reader_guard() { mCounter->fetch_sub(1); }
+
+    private:
+        std::atomic<std::size_t>* mCounter;
+    };
+
+    std::atomic<const table_type*> mTable;
+    std::atomic<unsigned> mEpoch{0};
+    mutable std::atomic<std::size_t> mReaders[2] = {{0}, {0}};
+    std::mutex mUpdateMutex;
+};
+
+}  // namespace strict
@@ -0,0 +1,237 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strict
+{
+
+// Writes std::hash of every value to `hashes`, which must have size of `values`. The loop is branch free, so it is
+// vectorised by compilers on targets with 64 bit vector multiplication (e.g. AVX-512DQ).
+template<typename DecimalT>
+void hash_column(span<const DecimalT> values, span<uint64_t> hashes) noexcept {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        hashes[i] = detail::hash_nominator(static_cast<uint64_t>(values[i].nominator()));
+    }
+}
+
+// Open addressing hash map with decimal keys. Nominators of keys are stored in a flat array probed linearly, values
+// in a parallel array; erasure shifts following entries back, so there are no tombstones. The smallest nominator
+// marks empty slots and a key with that nominator is kept aside.
+template<typename DecimalT, typename ValueT>
+class flat_hash_map
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    using key_type = DecimalT;
+    using mapped_type = ValueT;
+
+    explicit flat_hash_map(std::size_t expectedSize = 0) {
+        reserve(expectedSize);
+    }
+
+    std::size_t size() const noexcept { return mSize + (mHasEmptyKey ? 1 : 0); }
+    bool empty() const noexcept { return size() == 0; }
+    std::size_t capacity() const noexcept { return mKeys.size(); }
+
+    // Makes room for `count` entries without rehashing
+    void reserve(std::size_t count) {
+        std::size_t slots = MIN_CAPACITY;
+        while (slots * MAX_LOAD_NUMERATOR < count * MAX_LOAD_DENOMINATOR) {
+            slots *= 2;
+        }
+        if (slots > mKeys.size()) {
+            rehash(slots);
+        }
+    }
+
+    void clear() {
+        std::fill(mKeys.begin(), mKeys.end(), EMPTY);
+        std::fill(mValues.begin(), mValues.end(), ValueT{});
+        mEmptyKeyValue = ValueT{};
+        mHasEmptyKey = false;
+        mSize = 0;
+    }
+
+    ValueT* find(const DecimalT& key) noexcept {
+        return const_cast<ValueT*>(static_cast<const flat_hash_map*>(this)->find(key));
+    }
+
+    const ValueT* find(const DecimalT& key) const noexcept {
+        const underlying_type nominator = key.nominator();
+        if (nominator == EMPTY) {
+            return mHasEmptyKey ? &mEmptyKeyValue : nullptr;
+        }
+        for (std::size_t slot = ideal_slot(nominator);; slot = (slot + 1) & mMask) {
+            if (mKeys[slot] == nominator) {
+                return &mValues[slot];
+            }
+            if (mKeys[slot] == EMPTY) {
+                return nullptr;
+            }
+        }
+    }
+
+    bool contains(const DecimalT& key) const noexcept { return find(key) != nullptr; }
+
+    // Returns value of `key`, default constructed if the key was not present
+    ValueT& operator[](const DecimalT& key) {
+        const underlying_type nominator = key.nominator();
+        if (nominator == EMPTY) {
+            mHasEmptyKey = true;
+            return mEmptyKeyValue;
+        }
+        for (std::size_t slot = ideal_slot(nominator);; slot = (slot + 1) & mMask) {
+            if (mKeys[slot] == nominator) {
+                return mValues[slot];
+            }
+            if (mKeys[slot] == EMPTY) {
+                if ((mSize + 1) * MAX_LOAD_DENOMINATOR > mKeys.size() * MAX_LOAD_NUMERATOR) {
+                    rehash(mKeys.size() * 2);
+                    return (*this)[key];
+                }
+                mKeys[slot] = nominator;
+                ++mSize;
+                return mValues[slot];
+            }
+        }
+    }
+
+    bool erase(const DecimalT& key) {
+        const underlying_type nominator = key.nominator();
+        if (nominator == EMPTY) {
+            const bool erased = mHasEmptyKey;
+            mHasEmptyKey = false;
+            mEmptyKeyValue = ValueT{};
+            return erased;
+        }
+        std::size_t hole = ideal_slot(nominator);
+        for (; mKeys[hole] != nominator; hole = (hole + 1) & mMask) {
+            if (mKeys[hole] == EMPTY) {
+                return false;
+            }
+        }
+        // entries after the hole which would be found through it are shifted back
+        for (std::size_t slot = (hole + 1) & mMask; mKeys[slot] != EMPTY; slot = (slot + 1) & mMask) {
+            const std::size_t ideal = ideal_slot(mKeys[slot]);
+            if (((slot - ideal) & mMask) >= ((slot - hole) & mMask)) {
+                mKeys[hole] = mKeys[slot];
+                mValues[hole] = std::move(mValues[slot]);
+                hole = slot;
+            }
+        }
+        mKeys[hole] = EMPTY;
+        mValues[hole] = ValueT{};
+        --mSize;
+        return true;
+    }
+
+    // Calls fn(key, value) for every entry in unspecified order
+    template<typename Fn>
+    void for_each(Fn&& fn) {
+        visit(*this, fn);
+    }
+
+    template<typename Fn>
+    void for_each(Fn&& fn) const {
+        visit(*this, fn);
+    }
+
+private:
+    static constexpr underlying_type EMPTY = std::numeric_limits<underlying_type>::min();
+    static constexpr std::size_t MIN_CAPACITY = 16;
+    static constexpr std::size_t MAX_LOAD_NUMERATOR = 3;
+    static constexpr std::size_t MAX_LOAD_DENOMINATOR = 4;
+
+    template<typename Self, typename Fn>
+    static void visit(Self& self, Fn& fn) {
+        if (self.mHasEmptyKey) {
+            fn(to_key(EMPTY), self.mEmptyKeyValue);
+        }
+        for (std::size_t slot = 0; slot < self.mKeys.size(); ++slot) {
+            if (self.mKeys[slot] != EMPTY) {
+                fn(to_key(self.mKeys[slot]), self.mValues[slot]);
+            }
+        }
+    }
+
+    static DecimalT to_key(underlying_type nominator) { return DecimalT{typename DecimalT::nominator_t{nominator}}; }
+
+    std::size_t ideal_slot(underlying_type nominator) const noexcept {
+        return static_cast<std::size_t>(detail::hash_nominator(static_cast<uint64_t>(nominator))) & mMask;
+    }
+
+    void rehash(std::size_t slots) {
+        std::vector<underlying_type> keys(slots, EMPTY);
+        std::vector<ValueT> values(slots);
+        const std::size_t mask = slots - 1;
+        for (std::size_t i = 0; i < mKeys.size(); ++i) {
+            if (mKeys[i] != EMPTY) {
+                std::size_t slot = static_cast<std::size_t>(detail::hash_nominator(static_cast<uint64_t>(mKeys[i]))) & mask;
+                while (keys[slot] != EMPTY) {
+                    slot = (slot + 1) & mask;
+                }
+                keys[slot] = mKeys[i];
+                values[slot] = std::move(mValues[i]);
+            }
+        }
+        mKeys = std::move(keys);
+        mValues = std::move(values);
+        mMask = mask;
+    }
+
+    std::vector<underlying_type> mKeys;
+    std::vector<ValueT> mValues;
+    std::size_t mMask = 0;
+    std::size_t mSize = 0;
+    ValueT mEmptyKeyValue{};
+    bool mHasEmptyKey = false;
+};
+
+}  // namespace strict
@@ -0,0 +1,497 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace strict
+{
+
+// Bits of IEEE 754-2008 decimal128 value split into two 64-bit words
+struct ieee754_decimal128
+{
+    uint64_t low{};
+    uint64_t high{};
+};
+
+enum class ieee754_encoding
+{
+    bid,  // binary integer decimal
+    dpd,  // densely packed decimal
+};
+
+// Ordered from the best to the worst result, batch conversions report the worst status of all values
+enum class ieee754_status
+{
+    exact,
+    inexact,   // value was rounded half up
+    overflow,  // value does not fit in the target, infinity with the value's sign is stored
+};
+
+namespace detail
+{
+
+constexpr int DECIMAL64_BIAS = 398;
+constexpr int DECIMAL64_DIGITS = 16;
+constexpr int DECIMAL64_MAX_EXPONENT = 767;
+constexpr int DECIMAL128_BIAS = 6176;
+constexpr int DECIMAL128_MAX_EXPONENT = 12287;
+
+// Encodes three decimal digits (0-999) as 10-bit declet
+constexpr uint16_t dpd_encode_declet(unsigned value) noexcept {
+    const unsigned d2 = value / 100, d1 = value / 10 % 10, d0 = value % 10;
+    const unsigned large = (d2 >= 8 ? 4u : 0u) | (d1 >= 8 ? 2u : 0u) | (d0 >= 8 ? 1u : 0u);
+    const unsigned d = d2 & 1u;
+    const unsigned f = (d1 >> 1) & 3u, h = d1 & 1u;
+    const unsigned j = (d0 >> 1) & 3u, m = d0 & 1u;
+    switch (large) {
+    case 0: return static_cast<uint16_t>(d2 << 7 | d1 << 4 | d0);
+    case 1: return static_cast<uint16_t>(d2 << 7 | d1 << 4 | 0x8u | m);
+    case 2: return static_cast<uint16_t>(d2 << 7 | j << 5 | h << 4 | 0xAu | m);
+    case 3: return static_cast<uint16_t>(d2 << 7 | 0x2u << 5 | h << 4 | 0xEu | m);
+    case 4: return static_cast<uint16_t>(j << 8 | d << 7 | d1 << 4 | 0xCu | m);
+    case 5: return static_cast<uint16_t>(f << 8 | d << 7 | 0x1u << 5 | h << 4 | 0xEu | m);
+    case 6: return static_cast<uint16_t>(j << 8 | d << 7 | h << 4 | 0xEu | m);
+    default: return static_cast<uint16_t>(d << 7 | 0x3u << 5 | h << 4 | 0xEu | m);
+    }
+}
+
+// Decodes 10-bit declet to its value (0-999), non-canonical declets are decoded as required by the standard
+constexpr uint16_t dpd_decode_declet(unsigned declet) noexcept {
+    const unsigned pq = (declet >> 8) & 3u, r = (declet >> 7) & 1u, pqr = declet >> 7;
+    const unsigned st = (declet >> 5) & 3u, u = (declet >> 4) & 1u, stu = (declet >> 4) & 7u;
+    const unsigned wx = (declet >> 1) & 3u, y = declet & 1u, wxy = declet & 7u;
+    unsigned d2 = pqr, d1 = stu, d0 = wxy;
+    if (declet & 0x8u) {
+        switch (wx) {
+        case 0: d0 = 8 + y; break;
+        case 1: d1 = 8 + u; d0 = st << 1 | y; break;
+        case 2: d2 = 8 + r; d0 = pq << 1 | y; break;
+        default:
+            switch (st) {
+            case 0: d2 = 8 + r; d1 = 8 + u; d0 = pq << 1 | y; break;
+            case 1: d2 = 8 + r; d1 = pq << 1 | u; d0 = 8 + y; break;
+            case 2: d1 = 8 + u; d0 = 8 + y; break;
+            default: d2 = 8 + r; d1 = 8 + u; d0 = 8 + y; break;
+            }
+        }
+    }
+    return static_cast<uint16_t>(d2 * 100 + d1 * 10 + d0);
+}
+
+template<std::size_t N, typename Fn>
+constexpr std::array<uint16_t, N> make_table(Fn fn) noexcept {
+    std::array<uint16_t, N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        table[i] = fn(static_cast<unsigned>(i));
+    }
+    return table;
+}
+
+inline constexpr std::array<uint16_t, 1000> DPD_ENCODE_TABLE = make_table<1000>(dpd_encode_declet);
+inline constexpr std::array<uint16_t, 1024> DPD_DECODE_TABLE = make_table<1024>(dpd_decode_declet);
+
+// Divides 128-bit value by a 32-bit divisor in place and returns remainder
+inline uint32_t divmod_u128(uint64_t& high, uint64_t& low, uint32_t divisor) noexcept {
+    const uint32_t limbs[4] = {static_cast<uint32_t>(high >> 32), static_cast<uint32_t>(high),
+                               static_cast<uint32_t>(low >> 32), static_cast<uint32_t>(low)};
+    uint32_t quotient[4]{};
+    uint64_t remainder = 0;
+    for (int i = 0; i < 4; ++i) {
+        const uint64_t current = remainder << 32 | limbs[i];
+        quotient[i] = static_cast<uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    high = static_cast<uint64_t>(quotient[0]) << 32 | quotient[1];
+    low = static_cast<uint64_t>(quotient[2]) << 32 | quotient[3];
+    return static_cast<uint32_t>(remainder);
+}
+
+// Computes coefficient * 10^shift rounded half up. Returns false if the result does not fit in uint64_t.
+inline bool scale_coefficient(uint64_t coefficient, int shift, uint64_t& result, bool& inexact) noexcept {
+    if (shift == 0) {
+        result = coefficient;
+        return true;
+    }
+    if (shift > 0) {
+        if (coefficient == 0) {
+            result = 0;
+            return true;
+        }
+        if (shift > 19 || coefficient > std::numeric_limits<uint64_t>::max() / POWERS_OF_10_U64[shift]) {
+            return false;
+        }
+        result = coefficient * POWERS_OF_10_U64[shift];
+        return true;
+    }
+    const int drop = -shift;
+    if (drop > 19) {
+        result = 0;
+        inexact = inexact || coefficient != 0;
+        return true;
+    }
+    const uint64_t remainder = coefficient % POWERS_OF_10_U64[drop];
+    result = coefficient / POWERS_OF_10_U64[drop];
+    inexact = inexact || remainder != 0;
+    if (remainder >= 5 * POWERS_OF_10_U64[drop - 1]) {
+        ++result;
+    }
+    return true;
+}
+
+// As above for coefficient equal to high * 10^18 + low where high < 10^16 and low < 10^18
+inline bool scale_coefficient(uint64_t high, uint64_t low, int shift, uint64_t& result, bool& inexact) noexcept {
+    constexpr uint64_t E18 = POWERS_OF_10_U64[18];
+    if (high == 0) {
+        return scale_coefficient(low, shift, result, inexact);
+    }
+    if (shift >= 0) {
+        return high < 10 && scale_coefficient(high * E18 + low, shift, result, inexact);
+    }
+    const int drop = -shift;
+    if (drop < 18) {
+        const uint64_t scale = POWERS_OF_10_U64[18 - drop];
+        if (high > std::numeric_limits<uint64_t>::max() / scale) {
+            return false;
+        }
+        uint64_t lowPart = 0;
+        scale_coefficient(low, shift, lowPart, inexact);
+        if (high * scale > std::numeric_limits<uint64_t>::max() - lowPart) {
+            return false;
+        }
+        result = high * scale + lowPart;
+        return true;
+    }
+    if (drop - 18 > 16) {
+        // high is not zero here, so some digits are always lost
+        result = 0;
+        inexact = true;
+        return true;
+    }
+    const uint64_t divisor = POWERS_OF_10_U64[drop - 18];
+    result = high / divisor;
+    inexact = inexact || low != 0 || high % divisor != 0;
+    if (drop > 18 ? high % divisor >= 5 * POWERS_OF_10_U64[drop - 19] : low >= 5 * POWERS_OF_10_U64[17]) {
+        ++result;
+    }
+    return true;
+}
+
+template<typename DecimalT>
+inline ieee754_status store_special(DecimalT& value, typename DecimalT::underlying_type nominator) noexcept {
+    value = DecimalT{typename DecimalT::nominator_t{nominator}};
+    return ieee754_status::exact;
+}
+
+// Converts magnitude of coefficient * 10^(exponent + PRECISION) to the decimal
+template<typename DecimalT>
+inline ieee754_status store_coefficient(DecimalT& value, bool negative, uint64_t high, uint64_t low, int exponent) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(std::is_signed<UnderlyingType>::value && sizeof(UnderlyingType) <= sizeof(int64_t),
+                  "IEEE 754 interchange requires signed underlying type of at most 64 bits");
+    uint64_t magnitude = 0;
+    bool inexact = false;
+    const bool fits = scale_coefficient(high, low, exponent + DecimalT::PRECISION, magnitude, inexact)
+            && magnitude < static_cast<uint64_t>(DecimalT::INFINITY_PLUS);
+    if (!fits) {
+        store_special(value, negative ? DecimalT::INFINITY_MINUS : DecimalT::INFINITY_PLUS);
+        return ieee754_status::overflow;
+    }
+    const auto nominator = static_cast<UnderlyingType>(negative ? UnderlyingType{0} - static_cast<UnderlyingType>(magnitude)
+                                                                : static_cast<UnderlyingType>(magnitude));
+    value = DecimalT{typename DecimalT::nominator_t{nominator}};
+    return inexact ? ieee754_status::inexact : ieee754_status::exact;
+}
+
+// Splits the decimal to sign, magnitude of nominator and -PRECISION exponent; returns false for NaN and infinities
+template<typename DecimalT>
+inline bool load_coefficient(const DecimalT& value, bool& negative, uint64_t& coefficient) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(std::is_signed<UnderlyingType>::value && sizeof(UnderlyingType) <= sizeof(int64_t),
+                  "IEEE 754 interchange requires signed underlying type of at most 64 bits");
+    const int64_t nominator = static_cast<int64_t>(value.nominator());
+    negative = nominator < 0;
+    coefficient = negative ? uint64_t{0} - static_cast<uint64_t>(nominator) : static_cast<uint64_t>(nominator);
+    const UnderlyingType raw = value.nominator();
+    return raw != DecimalT::NAN_VALUE && raw != DecimalT::INFINITY_PLUS && raw != DecimalT::INFINITY_MINUS;
+}
+
+template<typename DecimalT>
+inline uint64_t special_decimal64(const DecimalT& value) noexcept {
+    if (value.nominator() == DecimalT::NAN_VALUE) {
+        return 0x7C00000000000000ull;
+    }
+    return value.nominator() == DecimalT::INFINITY_PLUS ? 0x7800000000000000ull : 0xF800000000000000ull;
+}
+
+}  // namespace detail
+
+template<typename DecimalT>
+ieee754_status to_ieee754_decimal64(const DecimalT& value, ieee754_encoding encoding, uint64_t& bits) noexcept {
+    bool negative = false;
+    uint64_t coefficient = 0;
+    if (!detail::load_coefficient(value, negative, coefficient)) {
+        bits = detail::special_decimal64(value);
+        return ieee754_status::exact;
+    }
+
+    // nominators may have more digits than decimal64 can hold, such values are rounded half up
+    int exponent = -DecimalT::PRECISION;
+    bool inexact = false;
+    if (coefficient >= detail::POWERS_OF_10_U64[detail::DECIMAL64_DIGITS]) {
+        const int digits = detail::count_digits(coefficient);
+        detail::scale_coefficient(coefficient, detail::DECIMAL64_DIGITS - digits, coefficient, inexact);
+        exponent += digits - detail::DECIMAL64_DIGITS;
+        if (coefficient == detail::POWERS_OF_10_U64[detail::DECIMAL64_DIGITS]) {
+            coefficient /= 10;
+            ++exponent;
+        }
+    }
+    const uint64_t biasedExponent = static_cast<uint64_t>(exponent + detail::DECIMAL64_BIAS);
+    const uint64_t sign = negative ? 1ull << 63 : 0;
+
+    if (encoding == ieee754_encoding::bid) {
+        if (coefficient < (1ull << 53)) {
+            bits = sign | biasedExponent << 53 | coefficient;
+        } else {
+            bits = sign | 3ull << 61 | biasedExponent << 51 | (coefficient & ((1ull << 51) - 1));
+        }
+    } else {
+        const uint64_t leadingDigit = coefficient / detail::POWERS_OF_10_U64[15];
+        uint64_t trailing = 0;
+        uint64_t rest = coefficient % detail::POWERS_OF_10_U64[15];
+        for (int declet = 0; declet < 5; ++declet) {
+            trailing |= static_cast<uint64_t>(detail::DPD_ENCODE_TABLE[rest % 1000]) << (10 * declet);
+            rest /= 1000;
+        }
+        const uint64_t exponentMsb = biasedExponent >> 8;
+        const uint64_t combination = leadingDigit < 8 ? exponentMsb << 3 | leadingDigit
+                                                      : 0x18u | exponentMsb << 1 | (leadingDigit - 8);
+        bits = sign | combination << 58 | (biasedExponent & 0xFF) << 50 | trailing;
+    }
+    return inexact ? ieee754_status::inexact : ieee754_status::exact;
+}
+
+template<typename DecimalT>
+ieee754_status from_ieee754_decimal64(uint64_t bits, ieee754_encoding encoding, DecimalT& value) noexcept {
+    const bool negative = (bits >> 63) != 0;
+    const unsigned combination = static_cast<unsigned>(bits >> 58) & 0x1F;
+    if (combination == 0x1F) {
+        return detail::store_special(value, DecimalT::NAN_VALUE);
+    }
+    if (combination == 0x1E) {
+        return detail::store_special(value, negative ? DecimalT::INFINITY_MINUS : DecimalT::INFINITY_PLUS);
+    }
+
+    uint64_t coefficient = 0;
+    int biasedExponent = 0;
+    if (encoding == ieee754_encoding::bid) {
+        if ((combination >> 3) != 3) {
+            biasedExponent = static_cast<int>(bits >> 53) & 0x3FF;
+            coefficient = bits & ((1ull << 53) - 1);
+        } else {
+            biasedExponent = static_cast<int>(bits >> 51) & 0x3FF;
+            coefficient = 4ull << 51 | (bits & ((1ull << 51) - 1));
+            // non-canonical coefficients are interpreted as zero
+            coefficient = coefficient < detail::POWERS_OF_10_U64[detail::DECIMAL64_DIGITS] ? coefficient : 0;
+        }
+    } else {
+        const unsigned exponentMsb = (combination >> 3) != 3 ? combination >> 3 : (combination >> 1) & 3;
+        const uint64_t leadingDigit = (combination >> 3) != 3 ? combination & 7 : 8 + (combination & 1);
+        biasedExponent = static_cast<int>(exponentMsb << 8 | (static_cast<unsigned>(bits >> 50) & 0xFF));
+        coefficient = leadingDigit;
+        for (int declet = 4; declet >= 0; --declet) {
+            coefficient = coefficient * 1000 + detail::DPD_DECODE_TABLE[(bits >> (10 * declet)) & 0x3FF];
+        }
+    }
+    if (biasedExponent > detail::DECIMAL64_MAX_EXPONENT) {
+        biasedExponent = detail::DECIMAL64_MAX_EXPONENT;
+    }
+    return detail::store_coefficient(value, negative, 0, coefficient, biasedExponent - detail::DECIMAL64_BIAS);
+}
+
+template<typename DecimalT>
+ieee754_status to_ieee754_decimal128(const DecimalT& value, ieee754_encoding encoding, ieee754_decimal128& bits) noexcept {
+    bool negative = false;
+    uint64_t coefficient = 0;
+    if (!detail::load_coefficient(value, negative, coefficient)) {
+        bits.high = detail::special_decimal64(value);
+        bits.low = 0;
+        return ieee754_status::exact;
+    }
+
+    // every 64-bit nominator fits in 34 digits of decimal128 coefficient, conversion is always exact
+    const uint64_t biasedExponent = static_cast<uint64_t>(detail::DECIMAL128_BIAS - DecimalT::PRECISION);
+    const uint64_t sign = negative ? 1ull << 63 : 0;
+    if (encoding == ieee754_encoding::bid) {
+        bits.high = sign | biasedExponent << 49;
+        bits.low = coefficient;
+    } else {
+        // leading digit is always 0, 20 digits occupy 7 lowest declets of 110-bit trailing significand
+        uint64_t trailingLow = 0;
+        uint64_t trailingHigh = 0;
+        for (int declet = 0; declet < 7; ++declet) {
+            const uint64_t encoded = detail::DPD_ENCODE_TABLE[coefficient % 1000];
+            const int shift = 10 * declet;
+            trailingLow |= encoded << shift;
+            trailingHigh |= shift > 54 ? encoded >> (64 - shift) : 0;
+            coefficient /= 1000;
+        }
+        bits.high = sign | (biasedExponent >> 12) << 61 | (biasedExponent & 0xFFF) << 46 | trailingHigh;
+        bits.low = trailingLow;
+    }
+    return ieee754_status::exact;
+}
+
+template<typename DecimalT>
+ieee754_status from_ieee754_decimal128(const ieee754_decimal128& bits, ieee754_encoding encoding, DecimalT& value) noexcept {
+    const bool negative = (bits.high >> 63) != 0;
+    const unsigned combination = static_cast<unsigned>(bits.high >> 58) & 0x1F;
+    if (combination == 0x1F) {
+        return detail::store_special(value, DecimalT::NAN_VALUE);
+    }
+    if (combination == 0x1E) {
+        return detail::store_special(value, negative ? DecimalT::INFINITY_MINUS : DecimalT::INFINITY_PLUS);
+    }
+
+    // coefficient is represented as coefficientHigh * 10^18 + coefficientLow
+    uint64_t coefficientHigh = 0;
+    uint64_t coefficientLow = 0;
+    int biasedExponent = 0;
+    if (encoding == ieee754_encoding::bid) {
+        if ((combination >> 3) != 3) {
+            biasedExponent = static_cast<int>(bits.high >> 49) & 0x3FFF;
+            uint64_t high = bits.high & ((1ull << 49) - 1);
+            uint64_t low = bits.low;
+            // coefficients above 10^34 - 1 are non-canonical and interpreted as zero
+            constexpr uint64_t MAX_HIGH = 0x1ED09BEAD87C0ull;
+            constexpr uint64_t MAX_LOW = 0x378D8E63FFFFFFFFull;
+            if (high > MAX_HIGH || (high == MAX_HIGH && low > MAX_LOW)) {
+                high = low = 0;
+            }
+            if (high == 0 && low < detail::POWERS_OF_10_U64[18]) {
+                coefficientLow = low;
+            } else {
+                const uint64_t remainder0 = detail::divmod_u128(high, low, 1000000000u);
+                const uint64_t remainder1 = detail::divmod_u128(high, low, 1000000000u);
+                coefficientLow = remainder1 * 1000000000u + remainder0;
+                coefficientHigh = low;
+            }
+        } else {
+            biasedExponent = static_cast<int>(bits.high >> 47) & 0x3FFF;
+        }
+    } else {
+        const unsigned exponentMsb = (combination >> 3) != 3 ? combination >> 3 : (combination >> 1) & 3;
+        const uint64_t leadingDigit = (combination >> 3) != 3 ? combination & 7 : 8 + (combination & 1);
+        biasedExponent = static_cast<int>(exponentMsb << 12 | (static_cast<unsigned>(bits.high >> 46) & 0xFFF));
+        const auto declet = [&bits](int idx) -> uint64_t {
+            const int shift = 10 * idx;
+            uint64_t raw = 0;
+            if (shift >= 64) {
+                raw = bits.high >> (shift - 64);
+            } else {
+                raw = bits.low >> shift;
+                raw |= shift > 54 ? bits.high << (64 - shift) : 0;
+            }
+            return detail::DPD_DECODE_TABLE[raw & 0x3FF];
+        };
+        coefficientHigh = leadingDigit;
+        for (int idx = 10; idx >= 6; --idx) {
+            coefficientHigh = coefficientHigh * 1000 + declet(idx);
+        }
+        for (int idx = 5; idx >= 0; --idx) {
+            coefficientLow = coefficientLow * 1000 + declet(idx);
+        }
+    }
+    if (biasedExponent > detail::DECIMAL128_MAX_EXPONENT) {
+        biasedExponent = detail::DECIMAL128_MAX_EXPONENT;
+    }
+    return detail::store_coefficient(value, negative, coefficientHigh, coefficientLow, biasedExponent - detail::DECIMAL128_BIAS);
+}
+
+// Batch variants convert min(values.size(), bits.size()) elements and return the worst status
+
+template<typename DecimalT>
+ieee754_status to_ieee754_decimal64(span<const DecimalT> values, ieee754_encoding encoding, span<uint64_t> bits) noexcept {
+    ieee754_status res = ieee754_status::exact;
+    const std::size_t count = std::min(values.size(), bits.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        res = std::max(res, to_ieee754_decimal64(values[i], encoding, bits[i]));
+    }
+    return res;
+}
+
+template<typename DecimalT>
+ieee754_status from_ieee754_decimal64(span<const uint64_t> bits, ieee754_encoding encoding, span<DecimalT> values) noexcept {
+    ieee754_status res = ieee754_status::exact;
+    const std::size_t count = std::min(values.size(), bits.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        res = std::max(res, from_ieee754_decimal64(bits[i], encoding, values[i]));
+    }
+    return res;
+}
+
+template<typename DecimalT>
+ieee754_status to_ieee754_decimal128(span<const DecimalT> values, ieee754_encoding encoding, span<ieee754_decimal128> bits) noexcept {
+    ieee754_status res = ieee754_status::exact;
+    const std::size_t count = std::min(values.size(), bits.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        res = std::max(res, to_ieee754_decimal128(values[i], encoding, bits[i]));
+    }
+    return res;
+}
+
+template<typename DecimalT>
+ieee754_status from_ieee754_decimal128(span<const ieee754_decimal128> bits, ieee754_encoding encoding, span<DecimalT> values) noexcept {
+    ieee754_status res = ieee754_status::exact;
+    const std::size_t count = std::min(values.size(), bits.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        res = std::max(res, from_ieee754_decimal128(bits[i], encoding, values[i]));
+    }
+    return res;
+}
+
+}  // namespace strict
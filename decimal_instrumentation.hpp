@@ -0,0 +1,145 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Opt-in counters of decimal operations, enabled by defining STRICT_DECIMAL_INSTRUMENTATION (in every translation
+// unit of a program, e.g. with a compiler option) before decimal.hpp is included. Counters are thread local, so
+// counting takes no synchronisation, and calls are attributed to the thread making them. Without the definition
+// all hooks are discarded at compile time and snapshots are zero.
+
+namespace strict
+{
+
+#if defined(STRICT_DECIMAL_INSTRUMENTATION)
+inline constexpr bool INSTRUMENTATION_ENABLED = true;
+#else
+inline constexpr bool INSTRUMENTATION_ENABLED = false;
+#endif
+
+struct instrumentation_counters
+{
+    uint64_t additions = 0;        // additions, subtractions and negations
+    uint64_t multiplications = 0;
+    uint64_t divisions = 0;
+    uint64_t parses = 0;           // decimals constructed from strings, floating point numbers or parts
+    uint64_t formats = 0;          // decimals written as text, including to_string() and stream output
+    uint64_t roundings = 0;        // results rounded because nonzero digits were discarded
+    uint64_t overflows = 0;        // results which did not fit in the underlying type
+    uint64_t specialValues = 0;    // NaN and infinities produced by operations
+    uint64_t allocations = 0;      // heap allocated string buffers (strings longer than the small string buffer)
+
+    instrumentation_counters& operator+=(const instrumentation_counters& rhs) noexcept {
+        additions += rhs.additions;
+        multiplications += rhs.multiplications;
+        divisions += rhs.divisions;
+        parses += rhs.parses;
+        formats += rhs.formats;
+        roundings += rhs.roundings;
+        overflows += rhs.overflows;
+        specialValues += rhs.specialValues;
+        allocations += rhs.allocations;
+        return *this;
+    }
+
+    instrumentation_counters& operator-=(const instrumentation_counters& rhs) noexcept {
+        additions -= rhs.additions;
+        multiplications -= rhs.multiplications;
+        divisions -= rhs.divisions;
+        parses -= rhs.parses;
+        formats -= rhs.formats;
+        roundings -= rhs.roundings;
+        overflows -= rhs.overflows;
+        specialValues -= rhs.specialValues;
+        allocations -= rhs.allocations;
+        return *this;
+    }
+
+    // Sum of counters of several threads
+    friend instrumentation_counters operator+(instrumentation_counters lhs, const instrumentation_counters& rhs) noexcept { return lhs += rhs; }
+    // Counts between two snapshots of the same thread
+    friend instrumentation_counters operator-(instrumentation_counters lhs, const instrumentation_counters& rhs) noexcept { return lhs -= rhs; }
+};
+
+namespace detail
+{
+
+inline instrumentation_counters& thread_counters() noexcept {
+    thread_local instrumentation_counters counters;
+    return counters;
+}
+
+// Counts an operation and properties of its result
+inline void record_operation(uint64_t instrumentation_counters::*counter, bool rounded, bool overflow, bool special) noexcept {
+    instrumentation_counters& counters = thread_counters();
+    ++(counters.*counter);
+    counters.roundings += rounded ? 1 : 0;
+    counters.overflows += overflow ? 1 : 0;
+    counters.specialValues += special ? 1 : 0;
+}
+
+// Counts a string of `length` characters made by a decimal, which allocates if it does not fit in the small string
+// buffer
+inline void record_string(std::size_t length) noexcept {
+    static const std::size_t SMALL_STRING_CAPACITY = std::string().capacity();
+    thread_counters().allocations += length > SMALL_STRING_CAPACITY ? 1 : 0;
+}
+
+}  // namespace detail
+
+// Counters of the calling thread since its start or the last reset
+inline instrumentation_counters instrumentation_snapshot() noexcept {
+    if constexpr (INSTRUMENTATION_ENABLED) {
+        return detail::thread_counters();
+    } else {
+        return {};
+    }
+}
+
+// Resets counters of the calling thread
+inline void reset_instrumentation() noexcept {
+    if constexpr (INSTRUMENTATION_ENABLED) {
+        detail::thread_counters() = {};
+    }
+}
+
+}  // namespace strict
@@ -0,0 +1,288 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+// JSON numbers (RFC 8259: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?) read and written directly as nominators,
+// without converting through double and without allocation. JSON has no NaN and infinities, they are written as
+// null and null is read as NaN.
+
+namespace strict
+{
+
+struct json_array_result
+{
+    const char* ptr = nullptr;  // past the closing bracket on success, position of the error otherwise
+    std::errc ec{};             // invalid_argument, result_out_of_range or value_too_large if `values` is too small
+    std::size_t count = 0;      // number of values read
+};
+
+namespace detail
+{
+
+constexpr bool is_digit(char c) noexcept {
+    return static_cast<unsigned>(c - '0') < 10;
+}
+
+// Exponents beyond this bound make every nonzero value overflow or round to zero
+constexpr long JSON_MAX_EXPONENT = 100000;
+
+inline const char* skip_json_whitespace(const char* it, const char* last) noexcept {
+    while (it != last && (*it == ' ' || *it == '\n' || *it == '\r' || *it == '\t')) {
+        ++it;
+    }
+    return it;
+}
+
+}  // namespace detail
+
+// Reads a JSON number (or null) from [first, last). The value is mantissa digits scaled by the exponent exactly;
+// digits beyond PRECISION are rounded half away from zero as by from_chars(). On success `value` is assigned and ptr
+// points past the number. On failure `value` is left untouched and ec is set to std::errc::invalid_argument or
+// std::errc::result_out_of_range.
+template<typename DecimalT>
+std::from_chars_result from_json_number(const char* first, const char* last, DecimalT& value) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    using nominator_t = typename DecimalT::nominator_t;
+    constexpr long PRECISION = DecimalT::PRECISION;
+
+    const char* it = first;
+    if (last - it >= 4 && std::memcmp(it, "null", 4) == 0) {
+        value = DecimalT{nominator_t{DecimalT::NAN_VALUE}};
+        if constexpr (INSTRUMENTATION_ENABLED) {
+            detail::record_operation(&instrumentation_counters::parses, false, false, true);
+        }
+        return {it + 4, std::errc{}};
+    }
+    const bool negative = it != last && *it == '-';
+    it += negative ? 1 : 0;
+
+    // syntax is validated first, digits are converted when the exponent is known
+    const char* const integerBegin = it;
+    if (it == last || !detail::is_digit(*it)) {
+        return {first, std::errc::invalid_argument};
+    }
+    if (*it++ != '0') {
+        while (it != last && detail::is_digit(*it)) {
+            ++it;
+        }
+    }
+    const long integerLength = it - integerBegin;
+    const char* fractionBegin = it;
+    long fractionLength = 0;
+    if (it != last && *it == '.') {
+        fractionBegin = ++it;
+        while (it != last && detail::is_digit(*it)) {
+            ++it;
+        }
+        fractionLength = it - fractionBegin;
+        if (fractionLength == 0) {
+            return {first, std::errc::invalid_argument};
+        }
+    }
+    long exponent = 0;
+    if (it != last && (*it == 'e' || *it == 'E')) {
+        ++it;
+        const bool negativeExponent = it != last && *it == '-';
+        it += it != last && (*it == '-' || *it == '+') ? 1 : 0;
+        const char* const exponentBegin = it;
+        for (; it != last && detail::is_digit(*it); ++it) {
+            exponent = std::min(exponent * 10 + (*it - '0'), detail::JSON_MAX_EXPONENT);
+        }
+        if (it == exponentBegin) {
+            return {first, std::errc::invalid_argument};
+        }
+        exponent = negativeExponent ? -exponent : exponent;
+    }
+    if (negative && !std::is_signed<UnderlyingType>::value) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // nominator = digits * 10^shift, where digits are integer digits followed by fraction digits; with negative
+    // shift only the leading `kept` digits are converted and the next one decides rounding
+    const long shift = exponent - fractionLength + PRECISION;
+    const long digits = integerLength + fractionLength;
+    const long kept = digits + std::min(shift, 0L);
+    // nominators reserved for nan and infinities are out of range, like in from_chars
+    const UnsignedT maxMagnitude = detail::max_parsed_magnitude<DecimalT>(negative);
+    // the first digits10 digits cannot overflow the unsigned type, further ones and scaling are checked
+    constexpr long SAFE_DIGITS = std::numeric_limits<UnsignedT>::digits10;
+    UnsignedT magnitude{};
+    bool overflow = false;
+    long converted = 0;
+    const auto append = [&](char c) {
+        const UnsignedT digit = static_cast<UnsignedT>(c - '0');
+        if (converted++ < SAFE_DIGITS) {
+            magnitude = static_cast<UnsignedT>(magnitude * 10 + digit);
+        } else {
+            UnsignedT scaled{};
+            const bool scaleOverflows = detail::multiply_overflows(magnitude, UnsignedT{10}, scaled);
+            overflow = detail::add_overflows(scaled, digit, magnitude) || scaleOverflows || overflow;
+        }
+    };
+    const long keptInteger = std::clamp(kept, 0L, integerLength);
+    for (long i = 0; i < keptInteger; ++i) {
+        append(integerBegin[i]);
+    }
+    for (long i = 0; i < kept - keptInteger; ++i) {
+        append(fractionBegin[i]);
+    }
+    if (shift > 0 && magnitude != 0) {
+        const UnsignedT scale = Power10<UnsignedT>(static_cast<int>(std::min(shift, SAFE_DIGITS)));
+        overflow = detail::multiply_overflows(magnitude, scale, magnitude) || overflow || shift > SAFE_DIGITS;
+    }
+    overflow = overflow || magnitude > maxMagnitude;
+    bool roundUp = false;
+    if (kept >= 0 && kept < digits) {
+        roundUp = (kept < integerLength ? integerBegin[kept] : fractionBegin[kept - integerLength]) >= '5';
+    }
+    if (roundUp) {
+        overflow = overflow || magnitude == maxMagnitude;
+        magnitude = static_cast<UnsignedT>(magnitude + 1);
+    }
+    if (overflow) {
+        return {it, std::errc::result_out_of_range};
+    }
+    value = DecimalT{nominator_t{negative ? static_cast<UnderlyingType>(UnsignedT{0} - magnitude)
+                                          : static_cast<UnderlyingType>(magnitude)}};
+    if constexpr (INSTRUMENTATION_ENABLED) {
+        bool rounded = false;
+        for (long i = std::max(kept, 0L); i < digits; ++i) {
+            rounded = rounded || (i < integerLength ? integerBegin[i] : fractionBegin[i - integerLength]) != '0';
+        }
+        detail::record_operation(&instrumentation_counters::parses, rounded, false, false);
+    }
+    return {it, std::errc{}};
+}
+
+// Buffer size sufficient for any value written by to_json_number()
+template<typename DecimalT>
+constexpr std::size_t max_json_number_size() noexcept {
+    return static_cast<std::size_t>(std::max(DecimalT::MAX_STRING_LENGTH, 4));
+}
+
+// Writes the value as a JSON number with PRECISION fraction digits, or null for NaN and infinities. The buffer has to
+// hold max_json_number_size() characters. Returns pointer past the last written character.
+template<typename DecimalT>
+char* to_json_number(const DecimalT& value, char* first) noexcept {
+    if constexpr (DecimalT::PRECISION != 0) {
+        const auto nominator = value.nominator();
+        if (nominator == DecimalT::NAN_VALUE || nominator == DecimalT::INFINITY_PLUS || nominator == DecimalT::INFINITY_MINUS) {
+            std::memcpy(first, "null", 4);
+            return first + 4;
+        }
+    }
+    return value.to_chars(first);
+}
+
+// Reads a JSON array of numbers (and nulls) surrounded by optional whitespace, e.g. "[1.25, -3e-2, null]", into
+// `values`. Reading stops at the first error; values read before it are kept and counted.
+template<typename DecimalT>
+json_array_result from_json_array(const char* first, const char* last, span<DecimalT> values) noexcept {
+    json_array_result res;
+    const char* it = detail::skip_json_whitespace(first, last);
+    if (it == last || *it != '[') {
+        res.ptr = it;
+        res.ec = std::errc::invalid_argument;
+        return res;
+    }
+    it = detail::skip_json_whitespace(it + 1, last);
+    if (it != last && *it == ']') {
+        res.ptr = it + 1;
+        return res;
+    }
+    for (;;) {
+        if (res.count == values.size()) {
+            res.ptr = it;
+            res.ec = std::errc::value_too_large;
+            return res;
+        }
+        const std::from_chars_result number = from_json_number(it, last, values[res.count]);
+        if (number.ec != std::errc{}) {
+            res.ptr = number.ptr;
+            res.ec = number.ec;
+            return res;
+        }
+        ++res.count;
+        it = detail::skip_json_whitespace(number.ptr, last);
+        if (it != last && *it == ',') {
+            it = detail::skip_json_whitespace(it + 1, last);
+        } else if (it != last && *it == ']') {
+            res.ptr = it + 1;
+            return res;
+        } else {
+            res.ptr = it;
+            res.ec = std::errc::invalid_argument;
+            return res;
+        }
+    }
+}
+
+// Number of bytes which guarantees that to_json_array() does not write past the end of output buffer
+template<typename DecimalT>
+constexpr std::size_t max_json_array_size(std::size_t count) noexcept {
+    return 2 + count * (max_json_number_size<DecimalT>() + 1);
+}
+
+// Writes values as a JSON array without whitespace, e.g. "[1.25,-0.03,null]". The output buffer has to hold
+// max_json_array_size<DecimalT>(values.size()) characters. Returns pointer past the last written character.
+template<typename DecimalT>
+char* to_json_array(span<const DecimalT> values, char* out) noexcept {
+    *out++ = '[';
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        out = to_json_number(values[i], out);
+        *out++ = ',';
+    }
+    out -= values.empty() ? 0 : 1;
+    *out++ = ']';
+    return out;
+}
+
+}  // namespace strict
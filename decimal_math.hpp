@@ -0,0 +1,500 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if !defined(__SIZEOF_INT128__)
+#error "decimal_math.hpp requires 128 bit integers"
+#endif
+
+// Elementary functions computed with integers only. sqrt() and pow() with integer exponents whose exact result
+// fits in 128 bits are correctly rounded (half away from zero). Other results are rounded from 128 bit fixed point
+// approximations with relative error about 2^-110, so they are correctly rounded unless the exact value lies within
+// that distance of a midpoint between decimals. Special values follow IEEE 754: NaN propagates, results too large
+// for the decimal are +inf/-inf and invalid arguments (e.g. logarithm of a negative value) give NaN.
+
+namespace strict
+{
+
+namespace detail
+{
+
+// Unsigned fixed point numbers with FIXED_BITS fraction bits, range [0, 128); signed ones have range (-128, 128)
+using fixed_t = unsigned __int128;
+using signed_fixed_t = __int128;
+constexpr int FIXED_BITS = 120;
+constexpr fixed_t FIXED_ONE = fixed_t{1} << FIXED_BITS;
+
+struct uint256
+{
+    fixed_t high;
+    fixed_t low;
+};
+
+constexpr uint256 multiply_wide(fixed_t lhs, fixed_t rhs) noexcept {
+    const auto lhs0 = static_cast<uint64_t>(lhs);
+    const auto lhs1 = static_cast<uint64_t>(lhs >> 64);
+    const auto rhs0 = static_cast<uint64_t>(rhs);
+    const auto rhs1 = static_cast<uint64_t>(rhs >> 64);
+    const fixed_t low = fixed_t{lhs0} * rhs0;
+    const fixed_t cross0 = fixed_t{lhs0} * rhs1;
+    const fixed_t cross1 = fixed_t{lhs1} * rhs0;
+    const fixed_t middle = (low >> 64) + static_cast<uint64_t>(cross0) + static_cast<uint64_t>(cross1);
+    return {fixed_t{lhs1} * rhs1 + (cross0 >> 64) + (cross1 >> 64) + (middle >> 64), (middle << 64) | static_cast<uint64_t>(low)};
+}
+
+// Product of fixed point numbers, truncated
+constexpr fixed_t fixed_multiply(fixed_t lhs, fixed_t rhs) noexcept {
+    const uint256 product = multiply_wide(lhs, rhs);
+    return (product.high << (128 - FIXED_BITS)) | (product.low >> FIXED_BITS);
+}
+
+// value / 2^shift rounded half up (0 < shift < 256), max value of fixed_t if the result does not fit
+constexpr fixed_t shift_rounded(uint256 value, int shift) noexcept {
+    if (shift > 128) {
+        const fixed_t half = fixed_t{1} << (shift - 129);
+        value.high += half;
+    } else {
+        const fixed_t half = fixed_t{1} << (shift - 1);
+        value.low += half;
+        value.high += value.low < half ? 1 : 0;
+    }
+    if (shift >= 128) {
+        return value.high >> (shift - 128);
+    }
+    if ((value.high >> shift) != 0) {
+        return std::numeric_limits<fixed_t>::max();
+    }
+    return (value.high << (128 - shift)) | (value.low >> shift);
+}
+
+// value / divisor, truncated
+constexpr uint256 divide_wide(const uint256& value, uint64_t divisor) noexcept {
+    const uint64_t limbs[4] = {static_cast<uint64_t>(value.high >> 64), static_cast<uint64_t>(value.high),
+                               static_cast<uint64_t>(value.low >> 64), static_cast<uint64_t>(value.low)};
+    uint64_t quotients[4] = {};
+    fixed_t remainder = 0;
+    for (int idx = 0; idx < 4; ++idx) {
+        const fixed_t current = (remainder << 64) | limbs[idx];
+        quotients[idx] = static_cast<uint64_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    return {(fixed_t{quotients[0]} << 64) | quotients[1], (fixed_t{quotients[2]} << 64) | quotients[3]};
+}
+
+constexpr int count_leading_zeros(fixed_t value) noexcept {
+    const auto high = static_cast<uint64_t>(value >> 64);
+    return high != 0 ? __builtin_clzll(high) : 64 + __builtin_clzll(static_cast<uint64_t>(value));
+}
+
+// Quotient of fixed point numbers by long division, used only to compute tables at compile time
+constexpr fixed_t fixed_divide(fixed_t lhs, fixed_t rhs) noexcept {
+    fixed_t quotient = lhs / rhs;
+    fixed_t remainder = lhs % rhs;
+    for (int bit = 0; bit < FIXED_BITS; ++bit) {
+        remainder <<= 1;
+        quotient <<= 1;
+        if (remainder >= rhs) {
+            remainder -= rhs;
+            quotient |= 1;
+        }
+    }
+    return quotient;
+}
+
+// ln(value) for value in [1, 2] as 2 * atanh((value - 1) / (value + 1)), used to compute tables
+constexpr fixed_t series_log(fixed_t value) noexcept {
+    const fixed_t ratio = fixed_divide(value - FIXED_ONE, value + FIXED_ONE);
+    const fixed_t ratioSquare = fixed_multiply(ratio, ratio);
+    fixed_t sum = 0;
+    for (fixed_t power = ratio, denominator = 1; power != 0; power = fixed_multiply(power, ratioSquare), denominator += 2) {
+        sum += power / denominator;
+    }
+    return 2 * sum;
+}
+
+// exp(value) for value in [0, 1] as Taylor series, used to compute tables
+constexpr fixed_t series_exp(fixed_t value) noexcept {
+    fixed_t sum = 0;
+    for (fixed_t term = FIXED_ONE, n = 1; term != 0; term = fixed_multiply(term, value) / n, ++n) {
+        sum += term;
+    }
+    return sum;
+}
+
+// exp() reduces its argument to [0, 1/4096) with coarse (steps of 1/64) and fine (steps of 1/4096) tables, ln() to
+// [1, 1 + 1/4096) by multiplication with reciprocals of table points. The rest takes a short polynomial.
+struct math_tables
+{
+    fixed_t ln2;
+    fixed_t ln10;
+    fixed_t inverseLn2;
+    fixed_t expCoarse[64];
+    fixed_t expFine[64];
+    fixed_t logCoarse[64];
+    fixed_t logFine[64];
+    fixed_t reciprocalCoarse[64];
+    fixed_t reciprocalFine[64];
+    fixed_t inverse[16];
+    fixed_t inverseFactorial[16];
+    uint16_t sqrtEstimate[256];
+};
+
+constexpr math_tables make_math_tables() noexcept {
+    math_tables tables{};
+    tables.ln2 = series_log(2 * FIXED_ONE);
+    tables.ln10 = 3 * tables.ln2 + series_log(FIXED_ONE + FIXED_ONE / 4);
+    tables.inverseLn2 = fixed_divide(FIXED_ONE, tables.ln2);
+    for (unsigned idx = 0; idx < 64; ++idx) {
+        tables.expCoarse[idx] = series_exp(FIXED_ONE / 64 * idx);
+        tables.expFine[idx] = series_exp(FIXED_ONE / 4096 * idx);
+        tables.logCoarse[idx] = series_log(FIXED_ONE + FIXED_ONE / 64 * idx);
+        tables.logFine[idx] = series_log(FIXED_ONE + FIXED_ONE / 4096 * idx);
+        tables.reciprocalCoarse[idx] = fixed_divide(FIXED_ONE, FIXED_ONE + FIXED_ONE / 64 * idx);
+        tables.reciprocalFine[idx] = fixed_divide(FIXED_ONE, FIXED_ONE + FIXED_ONE / 4096 * idx);
+    }
+    fixed_t factorial = 1;
+    for (unsigned n = 1; n < 16; ++n) {
+        factorial *= n;
+        tables.inverse[n] = FIXED_ONE / n;
+        tables.inverseFactorial[n] = FIXED_ONE / factorial;
+    }
+    tables.inverseFactorial[0] = FIXED_ONE;
+    // ceil(16 * sqrt(idx + 1)), an upper estimate of square roots of 8 leading bits
+    for (unsigned idx = 0; idx < 256; ++idx) {
+        unsigned root = 0;
+        while (root * root < (idx + 1) * 256) {
+            ++root;
+        }
+        tables.sqrtEstimate[idx] = static_cast<uint16_t>(root);
+    }
+    return tables;
+}
+
+inline constexpr math_tables MATH_TABLES = make_math_tables();
+
+// floor(sqrt(value)): table estimate of 8 bits refined by Newton iterations, from above
+inline fixed_t integer_sqrt(fixed_t value) noexcept {
+    if (value < 2) {
+        return value;
+    }
+    const int bits = 128 - count_leading_zeros(value);
+    int shift = bits > 8 ? bits - 8 : 0;
+    shift += shift & 1;
+    const auto top = static_cast<unsigned>(value >> shift);
+    fixed_t root = ((fixed_t{MATH_TABLES.sqrtEstimate[top]} << (shift / 2)) + 15) >> 4;
+    if (value <= std::numeric_limits<uint64_t>::max()) {
+        const auto narrow = static_cast<uint64_t>(value);
+        auto narrowRoot = static_cast<uint64_t>(root);
+        for (uint64_t next = (narrowRoot + narrow / narrowRoot) / 2; next < narrowRoot; next = (narrowRoot + narrow / narrowRoot) / 2) {
+            narrowRoot = next;
+        }
+        return narrowRoot;
+    }
+    for (fixed_t next = (root + value / root) / 2; next < root; next = (root + value / root) / 2) {
+        root = next;
+    }
+    return root;
+}
+
+// exp(value) = mantissa * 2^exponent, mantissa in [1, 2)
+struct fixed_power
+{
+    fixed_t mantissa;
+    int exponent;
+};
+
+inline fixed_power fixed_exp(signed_fixed_t value) noexcept {
+    // exponent = floor(value / ln 2), estimated with the reciprocal (128 bit division is a slow library call)
+    const auto ln2 = static_cast<signed_fixed_t>(MATH_TABLES.ln2);
+    const auto estimate = static_cast<signed_fixed_t>(fixed_multiply(static_cast<fixed_t>(value < 0 ? -value : value),
+                                                                     MATH_TABLES.inverseLn2) >> FIXED_BITS);
+    signed_fixed_t exponent = value < 0 ? -estimate - 1 : estimate;
+    while (value - exponent * ln2 < 0) {
+        --exponent;
+    }
+    while (value - exponent * ln2 >= ln2) {
+        ++exponent;
+    }
+    auto rest = static_cast<fixed_t>(value - exponent * ln2);
+    const auto coarse = static_cast<unsigned>(rest >> (FIXED_BITS - 6));
+    rest -= static_cast<fixed_t>(coarse) << (FIXED_BITS - 6);
+    const auto fine = static_cast<unsigned>(rest >> (FIXED_BITS - 12));
+    rest -= static_cast<fixed_t>(fine) << (FIXED_BITS - 12);
+    // rest < 2^-12, so 10 terms of Taylor series reach 2^-120
+    fixed_t polynomial = MATH_TABLES.inverseFactorial[9];
+    for (int n = 8; n >= 0; --n) {
+        polynomial = MATH_TABLES.inverseFactorial[n] + fixed_multiply(polynomial, rest);
+    }
+    fixed_power res{fixed_multiply(fixed_multiply(MATH_TABLES.expCoarse[coarse], MATH_TABLES.expFine[fine]), polynomial),
+                    static_cast<int>(exponent)};
+    if (res.mantissa >= 2 * FIXED_ONE) {
+        res.mantissa >>= 1;
+        ++res.exponent;
+    }
+    return res;
+}
+
+// ln(value) for value >= 1
+inline signed_fixed_t fixed_log(uint64_t value) noexcept {
+    const int exponent = 63 - __builtin_clzll(value);
+    fixed_t mantissa = fixed_t{value} << (FIXED_BITS - exponent);
+    const auto coarse = static_cast<unsigned>((mantissa - FIXED_ONE) >> (FIXED_BITS - 6));
+    mantissa = std::max(fixed_multiply(mantissa, MATH_TABLES.reciprocalCoarse[coarse]), FIXED_ONE);
+    const auto fine = static_cast<unsigned>((mantissa - FIXED_ONE) >> (FIXED_BITS - 12));
+    mantissa = std::max(fixed_multiply(mantissa, MATH_TABLES.reciprocalFine[fine]), FIXED_ONE);
+    // ln(1 + x) = x (1 - x (1/2 - x (1/3 - ...))), x < 2^-12, so 11 terms reach 2^-120
+    const fixed_t rest = mantissa - FIXED_ONE;
+    fixed_t polynomial = MATH_TABLES.inverse[11];
+    for (int n = 10; n >= 1; --n) {
+        polynomial = MATH_TABLES.inverse[n] - fixed_multiply(rest, polynomial);
+    }
+    return static_cast<signed_fixed_t>(fixed_multiply(rest, polynomial) + MATH_TABLES.logCoarse[coarse] + MATH_TABLES.logFine[fine] +
+                                       MATH_TABLES.ln2 * static_cast<unsigned>(exponent));
+}
+
+template<typename DecimalT>
+DecimalT make_decimal(typename DecimalT::underlying_type nominator) noexcept {
+    return DecimalT{typename DecimalT::nominator_t{nominator}};
+}
+
+template<typename DecimalT>
+fixed_t decimal_magnitude(const DecimalT& value) noexcept {
+    using UnsignedT = std::make_unsigned_t<typename DecimalT::underlying_type>;
+    const auto nominator = static_cast<UnsignedT>(value.nominator());
+    return value.nominator() < 0 ? UnsignedT{0} - nominator : nominator;
+}
+
+// Decimal with nominator `magnitude` (negated if `negative`), +inf/-inf if it does not fit
+template<typename DecimalT>
+DecimalT from_magnitude(fixed_t magnitude, bool negative) noexcept {
+    const auto clamped = static_cast<signed_fixed_t>(std::min(magnitude, fixed_t{1} << 126));
+    return saturate_wide<DecimalT>(negative ? -clamped : clamped);
+}
+
+// Fixed point value of a decimal, false if its magnitude is not below 128
+template<typename DecimalT>
+bool to_fixed(const DecimalT& value, signed_fixed_t& res) noexcept {
+    constexpr auto DENOMINATOR = Power10<uint64_t>(DecimalT::PRECISION);
+    const fixed_t magnitude = decimal_magnitude(value);
+    const fixed_t integerPart = magnitude / DENOMINATOR;
+    const fixed_t fractionPart = magnitude % DENOMINATOR;
+    if (integerPart >= 128) {
+        return false;
+    }
+    // fraction * 2^120 / 10^PRECISION as fraction * floor(2^(120 + SHIFT) / 10^PRECISION) / 2^SHIFT, where the
+    // scaled reciprocal has 127 bits; error is below 2^-126
+    constexpr int SHIFT = 7 + (63 - __builtin_clzll(DENOMINATOR));
+    constexpr fixed_t SCALED_RECIPROCAL = fixed_divide(fixed_t{1} << SHIFT, DENOMINATOR);
+    const uint256 fraction = multiply_wide(fractionPart, SCALED_RECIPROCAL);
+    const fixed_t fixedFraction = (fraction.high << (128 - SHIFT)) | (fraction.low >> SHIFT);
+    const auto fixed = static_cast<signed_fixed_t>((integerPart << FIXED_BITS) + fixedFraction);
+    res = value.nominator() < 0 ? -fixed : fixed;
+    return true;
+}
+
+// Decimal nearest to power.mantissa * 2^power.exponent
+template<typename DecimalT>
+DecimalT from_power(const fixed_power& power, bool negative) noexcept {
+    const int shift = FIXED_BITS - power.exponent;
+    if (shift <= 0) {
+        return from_magnitude<DecimalT>(std::numeric_limits<fixed_t>::max(), negative);
+    }
+    if (shift >= 256) {
+        return make_decimal<DecimalT>(0);
+    }
+    return from_magnitude<DecimalT>(shift_rounded(multiply_wide(power.mantissa, Power10<fixed_t>(DecimalT::PRECISION)), shift), negative);
+}
+
+// Decimal nearest to a fixed point value
+template<typename DecimalT>
+DecimalT from_fixed(signed_fixed_t value) noexcept {
+    const auto magnitude = static_cast<fixed_t>(value < 0 ? -value : value);
+    return from_magnitude<DecimalT>(shift_rounded(multiply_wide(magnitude, Power10<fixed_t>(DecimalT::PRECISION)), FIXED_BITS), value < 0);
+}
+
+// ln(value) of a positive finite decimal
+template<typename DecimalT>
+signed_fixed_t decimal_log(const DecimalT& value) noexcept {
+    return fixed_log(static_cast<uint64_t>(value.nominator())) - static_cast<signed_fixed_t>(MATH_TABLES.ln10) * DecimalT::PRECISION;
+}
+
+// exp(log * multiplier / 10^precision) with sign `negative`, multiplier given by its magnitude and sign
+template<typename DecimalT>
+DecimalT exp_of_product(signed_fixed_t log, fixed_t multiplier, bool negativeMultiplier, uint64_t divisor, bool negative) noexcept {
+    const bool negativeProduct = (log < 0) != negativeMultiplier;
+    const uint256 product = divide_wide(multiply_wide(static_cast<fixed_t>(log < 0 ? -log : log), multiplier), divisor);
+    if (product.high != 0 || product.low >= (fixed_t{128} << FIXED_BITS)) {
+        return negativeProduct ? make_decimal<DecimalT>(0) : from_magnitude<DecimalT>(std::numeric_limits<fixed_t>::max(), negative);
+    }
+    const auto exponent = static_cast<signed_fixed_t>(product.low);
+    return from_power<DecimalT>(fixed_exp(negativeProduct ? -exponent : exponent), negative);
+}
+
+}  // namespace detail
+
+// Square root, NaN for negative values
+template<typename UnderlyingType, int Precision>
+decimal_t<UnderlyingType, Precision> sqrt(const decimal_t<UnderlyingType, Precision>& value) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    static_assert(sizeof(UnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    if (detail::special_rank<DecimalT>(value.nominator()) != 0 || value.nominator() < 0) {
+        return detail::make_decimal<DecimalT>(value.nominator() == DecimalT::INFINITY_PLUS ? DecimalT::INFINITY_PLUS : DecimalT::NAN_VALUE);
+    }
+    // sqrt(n / 10^p) * 10^p = sqrt(n * 10^p); rounded up when the radicand exceeds root^2 + root, i.e. (root + 1/2)^2
+    const detail::fixed_t radicand = detail::fixed_t{static_cast<uint64_t>(value.nominator())} * Power10<uint64_t>(Precision);
+    const detail::fixed_t root = detail::integer_sqrt(radicand);
+    return detail::make_decimal<DecimalT>(static_cast<UnderlyingType>(root + (radicand - root * root > root ? 1 : 0)));
+}
+
+template<typename UnderlyingType, int Precision>
+decimal_t<UnderlyingType, Precision> exp(const decimal_t<UnderlyingType, Precision>& value) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    static_assert(sizeof(UnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    switch (detail::special_rank<DecimalT>(value.nominator())) {
+    case 2: return value;
+    case 1: return value;
+    case -1: return detail::make_decimal<DecimalT>(0);
+    default: break;
+    }
+    detail::signed_fixed_t exponent{};
+    if (!detail::to_fixed(value, exponent)) {
+        return value.nominator() < 0 ? detail::make_decimal<DecimalT>(0) : detail::make_decimal<DecimalT>(DecimalT::INFINITY_PLUS);
+    }
+    return detail::from_power<DecimalT>(detail::fixed_exp(exponent), false);
+}
+
+// Natural logarithm, -inf for zero and NaN for negative values (and for values below 1 of unsigned decimals)
+template<typename UnderlyingType, int Precision>
+decimal_t<UnderlyingType, Precision> log(const decimal_t<UnderlyingType, Precision>& value) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    static_assert(sizeof(UnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    if (detail::special_rank<DecimalT>(value.nominator()) != 0 || value.nominator() <= 0) {
+        const bool minusInfinity = value.nominator() == 0 && std::is_signed<UnderlyingType>::value;
+        return detail::make_decimal<DecimalT>(value.nominator() == DecimalT::INFINITY_PLUS ? DecimalT::INFINITY_PLUS
+                                              : minusInfinity ? DecimalT::INFINITY_MINUS : DecimalT::NAN_VALUE);
+    }
+    const detail::signed_fixed_t res = detail::decimal_log(value);
+    if (res < 0 && !std::is_signed<UnderlyingType>::value) {
+        return detail::make_decimal<DecimalT>(DecimalT::NAN_VALUE);
+    }
+    return detail::from_fixed<DecimalT>(res);
+}
+
+// value^exponent. Computed exactly and rounded once when value^|exponent| fits in 128 bits, through exp and ln otherwise.
+template<typename UnderlyingType, int Precision>
+decimal_t<UnderlyingType, Precision> pow(const decimal_t<UnderlyingType, Precision>& value, int64_t exponent) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    using detail::fixed_t;
+    static_assert(sizeof(UnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    const int rank = detail::special_rank<DecimalT>(value.nominator());
+    const bool negative = value.nominator() < 0 && exponent % 2 != 0;
+    if (rank == 2) {
+        return value;
+    }
+    if (exponent == 0) {
+        return detail::make_decimal<DecimalT>(static_cast<UnderlyingType>(Power10<uint64_t>(Precision)));
+    }
+    if (rank != 0 || value.nominator() == 0) {
+        // infinity or zero raised to positive powers stays, to negative powers swaps
+        const bool infinite = (rank != 0) == (exponent > 0);
+        return infinite ? detail::from_magnitude<DecimalT>(std::numeric_limits<fixed_t>::max(), negative) : detail::make_decimal<DecimalT>(0);
+    }
+
+    const fixed_t base = detail::decimal_magnitude(value);
+    const uint64_t magnitude = exponent < 0 ? uint64_t{0} - static_cast<uint64_t>(exponent) : static_cast<uint64_t>(exponent);
+    fixed_t power = 1;
+    bool exact = true;
+    fixed_t square = base;
+    for (uint64_t bits = magnitude; bits != 0 && exact; bits >>= 1) {
+        if ((bits & 1) != 0) {
+            exact = !__builtin_mul_overflow(power, square, &power);
+        }
+        if (bits > 1) {
+            exact = exact && !__builtin_mul_overflow(square, square, &square);
+        }
+    }
+    // n^k / 10^(p (k - 1)) for positive exponents, 10^(p (k + 1)) / n^k for negative ones
+    const uint64_t scale = Precision * (exponent > 0 ? magnitude - 1 : magnitude + 1);
+    if (exact && exponent > 0 && scale > 38) {
+        return detail::make_decimal<DecimalT>(0);  // n^k < 2^128 < 10^39 / 2
+    }
+    if (exact && scale <= 38) {
+        const fixed_t dividend = exponent > 0 ? power : Power10<fixed_t>(static_cast<int>(scale));
+        const fixed_t divisor = exponent > 0 ? Power10<fixed_t>(static_cast<int>(scale)) : power;
+        const fixed_t remainder = dividend % divisor;
+        return detail::from_magnitude<DecimalT>(dividend / divisor + (remainder >= divisor - remainder ? 1 : 0), negative);
+    }
+    const DecimalT absolute = detail::make_decimal<DecimalT>(static_cast<UnderlyingType>(base));
+    return detail::exp_of_product<DecimalT>(detail::decimal_log(absolute), magnitude, exponent < 0, 1, negative);
+}
+
+// value^exponent for non-negative values (or negative ones raised to integers), computed as exp(exponent * ln(value))
+template<typename UnderlyingType, int Precision, typename ExponentUnderlyingType, int ExponentPrecision>
+decimal_t<UnderlyingType, Precision> pow(const decimal_t<UnderlyingType, Precision>& value,
+                                         const decimal_t<ExponentUnderlyingType, ExponentPrecision>& exponent) noexcept {
+    using DecimalT = decimal_t<UnderlyingType, Precision>;
+    using ExponentT = decimal_t<ExponentUnderlyingType, ExponentPrecision>;
+    static_assert(sizeof(ExponentUnderlyingType) <= sizeof(uint64_t), "nominators up to 64 bits are supported");
+    const int exponentRank = detail::special_rank<ExponentT>(exponent.nominator());
+    if (exponentRank != 0 || detail::special_rank<DecimalT>(value.nominator()) == 2) {
+        return detail::make_decimal<DecimalT>(DecimalT::NAN_VALUE);
+    }
+    constexpr auto DENOMINATOR = Power10<uint64_t>(ExponentPrecision);
+    const detail::fixed_t magnitude = detail::decimal_magnitude(exponent);
+    if (magnitude % DENOMINATOR == 0 && magnitude / DENOMINATOR <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        const auto integer = static_cast<int64_t>(magnitude / DENOMINATOR);
+        return pow(value, exponent.nominator() < 0 ? -integer : integer);
+    }
+    if (value.nominator() < 0) {
+        return detail::make_decimal<DecimalT>(DecimalT::NAN_VALUE);
+    }
+    if (value.nominator() == 0 || value.nominator() == DecimalT::INFINITY_PLUS) {
+        const bool infinite = (value.nominator() != 0) == (exponent.nominator() > 0);
+        return detail::make_decimal<DecimalT>(infinite ? DecimalT::INFINITY_PLUS : 0);
+    }
+    return detail::exp_of_product<DecimalT>(detail::decimal_log(value), magnitude, exponent.nominator() < 0, DENOMINATOR, false);
+}
+
+}  // namespace strict
@@ -0,0 +1,113 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_serialization.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace strict
+{
+
+namespace detail
+{
+
+inline constexpr std::size_t PARTS_BLOCK = 64;
+
+// Writes nominators of a block of values assuming that none needs rounding or overflow checks. Returns true if that
+// holds: every fraction part has at most PRECISION digits and every integer part can be scaled by DENOMINATOR (with
+// a margin keeping results away from special values).
+template<typename DecimalT>
+bool plain_parts_block(const typename DecimalT::underlying_type* integerParts,
+                       const typename DecimalT::underlying_type* fractionParts, DecimalT* values, std::size_t count) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    constexpr UnderlyingType LIMIT = std::numeric_limits<UnderlyingType>::max() / DecimalT::DENOMINATOR - 1;
+    UnderlyingType* const out = reinterpret_cast<UnderlyingType*>(values);
+    // flags are accumulated as integers, so that the loop has no branches
+    UnderlyingType outside = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const UnderlyingType integer = integerParts[i];
+        UnderlyingType fraction = fractionParts[i];
+        outside |= static_cast<UnderlyingType>(integer > LIMIT) | static_cast<UnderlyingType>(fraction >= DecimalT::DENOMINATOR);
+        if constexpr (std::is_signed<UnderlyingType>::value) {
+            outside |= static_cast<UnderlyingType>(integer < -LIMIT) | static_cast<UnderlyingType>(fraction < 0);
+            // fraction part takes sign of integer part
+            const UnderlyingType mask = -static_cast<UnderlyingType>(integer < 0);
+            fraction = (fraction ^ mask) - mask;
+        }
+        out[i] = integer * DecimalT::DENOMINATOR + fraction;
+    }
+    return outside == 0;
+}
+
+}  // namespace detail
+
+// values[i] = DecimalT(integerParts[i], fractionParts[i]); all spans must have equal size. Every block is first
+// converted by a branch free loop, which compilers vectorise, and converted again one by one by the constructor only
+// if a fraction part needs rounding or an integer part overflows. Ranged decimals are not supported, the fast path
+// stores nominators without clamping.
+template<typename DecimalT>
+void from_parts(span<const typename DecimalT::underlying_type> integerParts,
+                span<const typename DecimalT::underlying_type> fractionParts, span<DecimalT> values) noexcept {
+    static_assert(detail::is_plain_decimal<DecimalT>(), "ranged decimals cannot be built from parts without clamping");
+    using UnderlyingType = typename DecimalT::underlying_type;
+    for (std::size_t first = 0; first < values.size(); first += detail::PARTS_BLOCK) {
+        const std::size_t count = std::min(detail::PARTS_BLOCK, values.size() - first);
+        const UnderlyingType* const integers = integerParts.data() + first;
+        const UnderlyingType* const fractions = fractionParts.data() + first;
+        DecimalT* const out = values.data() + first;
+        if (detail::plain_parts_block(integers, fractions, out, count)) {
+            if constexpr (INSTRUMENTATION_ENABLED) {
+                detail::thread_counters().parses += count;
+            }
+            continue;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = DecimalT(integers[i], fractions[i]);
+        }
+    }
+}
+
+}  // namespace strict
@@ -0,0 +1,314 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strict
+{
+
+namespace detail
+{
+
+inline unsigned count_trailing_zeros(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned count = 0;
+    for (; (value & 1) == 0; value >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+inline unsigned count_leading_zeros(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(value));
+#else
+    unsigned count = 0;
+    for (; (value & (uint64_t{1} << 63)) == 0; value <<= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+}  // namespace detail
+
+// Price levels of one side of an order book. Prices are mapped to ticks (nominator / tick nominator) and ticks to
+// slots of a ring of `capacity` slots (tick modulo capacity), so lookup and insertion are O(1) and the window of
+// representable prices slides with the occupied levels without moving any data. When the occupied levels span
+// more ticks than the capacity, the ring doubles up to the maximum window given to the constructor; prices which
+// would widen the span beyond it are rejected. The ring shrinks again when the span falls well under its capacity,
+// so a single stray level does not keep a large ring allocated. Occupancy is kept in a bitmap, which makes scans
+// for the best level (highest bid, lowest ask) cheap.
+template<typename DecimalT, typename ValueT>
+class price_ladder
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    static_assert(std::is_signed<underlying_type>::value && sizeof(underlying_type) <= sizeof(int64_t),
+                  "signed underlying type of at most 64 bits is required");
+    // Largest power of 2 representable in std::size_t
+    static constexpr std::size_t MAX_CAPACITY = std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 1);
+    static constexpr std::size_t DEFAULT_MAX_CAPACITY = std::size_t{1} << 16;
+
+    // `tick` is the price increment, `capacity` the initial number of slots and `maxCapacity` the maximum number of
+    // ticks spanned by the levels (both rounded up to power of 2)
+    price_ladder(const DecimalT& tick, std::size_t capacity = 1024, std::size_t maxCapacity = DEFAULT_MAX_CAPACITY)
+        : mTick(tick.nominator() > 0 ? tick.nominator() : 1),
+          mMaxCapacity(round_capacity(maxCapacity)),
+          mMinCapacity(std::min(round_capacity(capacity), mMaxCapacity)) {
+        mValues.resize(mMinCapacity);
+        mOccupied.resize(mMinCapacity / 64, 0);
+    }
+
+    std::size_t size() const noexcept { return mSize; }
+    bool empty() const noexcept { return mSize == 0; }
+    std::size_t capacity() const noexcept { return mValues.size(); }
+    std::size_t max_capacity() const noexcept { return mMaxCapacity; }
+    DecimalT tick() const { return to_price(1); }
+
+    bool contains(const DecimalT& price) const noexcept { return find(price) != nullptr; }
+
+    ValueT* find(const DecimalT& price) noexcept {
+        return const_cast<ValueT*>(static_cast<const price_ladder*>(this)->find(price));
+    }
+
+    const ValueT* find(const DecimalT& price) const noexcept {
+        int64_t tick = 0;
+        if (mSize == 0 || !to_tick(price, tick) || tick < mLowestTick || tick > mHighestTick) {
+            return nullptr;
+        }
+        const std::size_t slot = slot_of(tick);
+        return is_occupied(slot) ? &mValues[slot] : nullptr;
+    }
+
+    // Returns level of given price, default constructed if it did not exist. Returns nullptr if price is not finite,
+    // is not a multiple of the tick or the levels would span more than max_capacity() ticks.
+    ValueT* insert(const DecimalT& price) {
+        int64_t tick = 0;
+        if (!to_tick(price, tick)) {
+            return nullptr;
+        }
+        if (mSize == 0) {
+            mLowestTick = mHighestTick = tick;
+        } else if (tick < mLowestTick || tick > mHighestTick) {
+            const int64_t lowest = std::min(mLowestTick, tick);
+            const int64_t highest = std::max(mHighestTick, tick);
+            const uint64_t span = static_cast<uint64_t>(highest) - static_cast<uint64_t>(lowest) + 1;
+            if (span > mMaxCapacity) {
+                return nullptr;
+            }
+            if (span > mValues.size()) {
+                std::size_t slots = mValues.size();
+                while (slots < span) {
+                    slots *= 2;
+                }
+                resize(slots);
+            }
+            mLowestTick = lowest;
+            mHighestTick = highest;
+        }
+        const std::size_t slot = slot_of(tick);
+        if (!is_occupied(slot)) {
+            mOccupied[slot / 64] |= uint64_t{1} << (slot % 64);
+            ++mSize;
+        }
+        return &mValues[slot];
+    }
+
+    bool erase(const DecimalT& price) {
+        int64_t tick = 0;
+        if (mSize == 0 || !to_tick(price, tick) || tick < mLowestTick || tick > mHighestTick) {
+            return false;
+        }
+        const std::size_t slot = slot_of(tick);
+        if (!is_occupied(slot)) {
+            return false;
+        }
+        mOccupied[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+        mValues[slot] = ValueT{};
+        if (--mSize == 0) {
+            shrink(0);
+        } else if (tick == mLowestTick || tick == mHighestTick) {
+            if (tick == mLowestTick) {
+                mLowestTick = next_occupied(tick + 1);
+            } else {
+                mHighestTick = previous_occupied(tick - 1);
+            }
+            shrink(static_cast<std::size_t>(static_cast<uint64_t>(mHighestTick) - static_cast<uint64_t>(mLowestTick) + 1));
+        }
+        return true;
+    }
+
+    void clear() {
+        int64_t tick = mLowestTick;
+        for (std::size_t visited = 0; visited < mSize; ++visited) {
+            tick = visited == 0 ? tick : next_occupied(tick + 1);
+            mValues[slot_of(tick)] = ValueT{};
+        }
+        std::fill(mOccupied.begin(), mOccupied.end(), uint64_t{0});
+        mSize = 0;
+        shrink(0);
+    }
+
+    // Lowest price with a level (best ask), NaN if empty
+    DecimalT lowest() const { return mSize == 0 ? nan() : to_price(mLowestTick); }
+    // Highest price with a level (best bid), NaN if empty
+    DecimalT highest() const { return mSize == 0 ? nan() : to_price(mHighestTick); }
+
+    // Calls fn(price, value) for levels from the lowest price up
+    template<typename Fn>
+    void for_each_ascending(Fn&& fn) {
+        int64_t tick = mLowestTick;
+        for (std::size_t visited = 0; visited < mSize; ++visited) {
+            tick = visited == 0 ? tick : next_occupied(tick + 1);
+            fn(to_price(tick), mValues[slot_of(tick)]);
+        }
+    }
+
+    // Calls fn(price, value) for levels from the highest price down
+    template<typename Fn>
+    void for_each_descending(Fn&& fn) {
+        int64_t tick = mHighestTick;
+        for (std::size_t visited = 0; visited < mSize; ++visited) {
+            tick = visited == 0 ? tick : previous_occupied(tick - 1);
+            fn(to_price(tick), mValues[slot_of(tick)]);
+        }
+    }
+
+private:
+    static DecimalT nan() { return DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}}; }
+
+    bool to_tick(const DecimalT& price, int64_t& tick) const noexcept {
+        const underlying_type nominator = price.nominator();
+        if (nominator == DecimalT::NAN_VALUE || nominator == DecimalT::INFINITY_PLUS || nominator == DecimalT::INFINITY_MINUS
+            || nominator % mTick != 0) {
+            return false;
+        }
+        tick = static_cast<int64_t>(nominator / mTick);
+        return true;
+    }
+
+    DecimalT to_price(int64_t tick) const { return DecimalT{typename DecimalT::nominator_t{static_cast<underlying_type>(tick * mTick)}}; }
+
+    std::size_t slot_of(int64_t tick) const noexcept { return static_cast<std::size_t>(static_cast<uint64_t>(tick) & (mValues.size() - 1)); }
+
+    bool is_occupied(std::size_t slot) const noexcept { return (mOccupied[slot / 64] >> (slot % 64)) & 1; }
+
+    // First occupied tick not lower than `tick`; there must be one
+    int64_t next_occupied(int64_t tick) const noexcept {
+        for (;;) {
+            const std::size_t slot = slot_of(tick);
+            const uint64_t bits = mOccupied[slot / 64] >> (slot % 64);
+            if (bits != 0) {
+                return tick + detail::count_trailing_zeros(bits);
+            }
+            tick += static_cast<int64_t>(64 - slot % 64);
+        }
+    }
+
+    // Last occupied tick not greater than `tick`; there must be one
+    int64_t previous_occupied(int64_t tick) const noexcept {
+        for (;;) {
+            const std::size_t slot = slot_of(tick);
+            const uint64_t bits = mOccupied[slot / 64] << (63 - slot % 64);
+            if (bits != 0) {
+                return tick - detail::count_leading_zeros(bits);
+            }
+            tick -= static_cast<int64_t>(slot % 64 + 1);
+        }
+    }
+
+    static std::size_t round_capacity(std::size_t capacity) noexcept {
+        std::size_t slots = 64;
+        while (slots < capacity && slots < MAX_CAPACITY) {
+            slots *= 2;
+        }
+        return slots;
+    }
+
+    // Halves the ring while the levels span at most a quarter of it, keeping the initial capacity; the margin
+    // avoids growing and shrinking repeatedly around one size
+    void shrink(std::size_t span) {
+        std::size_t slots = mValues.size();
+        while (slots > mMinCapacity && span <= slots / 4) {
+            slots /= 2;
+        }
+        if (slots != mValues.size()) {
+            resize(slots);
+        }
+    }
+
+    // Moves occupied levels to a ring of `slots` slots, which must not be smaller than their span
+    void resize(std::size_t slots) {
+        std::vector<ValueT> values(slots);
+        std::vector<uint64_t> occupied(slots / 64, 0);
+        int64_t tick = mLowestTick;
+        for (std::size_t visited = 0; visited < mSize; ++visited) {
+            tick = visited == 0 ? tick : next_occupied(tick + 1);
+            const std::size_t slot = static_cast<std::size_t>(static_cast<uint64_t>(tick) & (slots - 1));
+            values[slot] = std::move(mValues[slot_of(tick)]);
+            occupied[slot / 64] |= uint64_t{1} << (slot % 64);
+        }
+        mValues = std::move(values);
+        mOccupied = std::move(occupied);
+    }
+
+    underlying_type mTick;
+    std::size_t mMaxCapacity;
+    std::size_t mMinCapacity;
+    std::vector<ValueT> mValues;
+    std::vector<uint64_t> mOccupied;
+    std::size_t mSize = 0;
+    int64_t mLowestTick = 0;
+    int64_t mHighestTick = 0;
+};
+
+}  // namespace strict
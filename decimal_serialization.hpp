@@ -0,0 +1,305 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace strict
+{
+
+// Binary layout of serialized column (all multi-byte integers are little endian):
+//   byte 0      - format (binary_format)
+//   byte 1      - precision of serialized decimals
+//   byte 2      - width of nominator in bytes
+//   byte 3      - reserved, always 0
+//   bytes 4-11  - number of serialized values
+//   payload     - fixed: `width` bytes of two's complement nominator per value
+//                 compact: zigzag encoded nominator written as LEB128 varint per value
+enum class binary_format : uint8_t
+{
+    fixed = 1,
+    compact = 2,
+};
+
+enum class serialization_error
+{
+    none,
+    buffer_too_small,
+    invalid_header,
+    precision_mismatch,
+    width_mismatch,
+    out_of_range,
+};
+
+struct serialization_result
+{
+    serialization_error error = serialization_error::none;
+    std::size_t bytes = 0;   // number of bytes written or consumed
+    std::size_t count = 0;   // number of values serialized or deserialized
+};
+
+constexpr std::size_t BINARY_HEADER_SIZE = 12;
+
+namespace detail
+{
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+constexpr bool IS_LITTLE_ENDIAN = true;
+#elif defined(_MSC_VER)
+constexpr bool IS_LITTLE_ENDIAN = true;
+#else
+constexpr bool IS_LITTLE_ENDIAN = false;
+#endif
+
+template<typename UnsignedT>
+inline void store_le(unsigned char* out, UnsignedT value) noexcept {
+    for (std::size_t i = 0; i < sizeof(UnsignedT); ++i) {
+        out[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+template<typename UnsignedT>
+inline UnsignedT load_le(const unsigned char* in) noexcept {
+    UnsignedT value{};
+    for (std::size_t i = 0; i < sizeof(UnsignedT); ++i) {
+        value = static_cast<UnsignedT>(value | static_cast<UnsignedT>(static_cast<UnsignedT>(in[i]) << (8 * i)));
+    }
+    return value;
+}
+
+template<typename UnderlyingType>
+constexpr std::make_unsigned_t<UnderlyingType> zigzag_encode(UnderlyingType value) noexcept {
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    if constexpr (std::is_signed<UnderlyingType>::value) {
+        return static_cast<UnsignedT>((static_cast<UnsignedT>(value) << 1) ^ static_cast<UnsignedT>(value >> (sizeof(UnderlyingType) * 8 - 1)));
+    } else {
+        return value;
+    }
+}
+
+template<typename UnderlyingType>
+constexpr UnderlyingType zigzag_decode(std::make_unsigned_t<UnderlyingType> value) noexcept {
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    if constexpr (std::is_signed<UnderlyingType>::value) {
+        return static_cast<UnderlyingType>(static_cast<UnsignedT>(value >> 1) ^ static_cast<UnsignedT>(UnsignedT{0} - (value & 1)));
+    } else {
+        return value;
+    }
+}
+
+template<typename UnsignedT>
+constexpr std::size_t max_varint_size() noexcept {
+    return (sizeof(UnsignedT) * 8 + 6) / 7;
+}
+
+template<typename UnsignedT>
+inline unsigned char* write_varint(unsigned char* out, UnsignedT value) noexcept {
+    while (value >= 0x80) {
+        *out++ = static_cast<unsigned char>(value | 0x80);
+        value = static_cast<UnsignedT>(value >> 7);
+    }
+    *out++ = static_cast<unsigned char>(value);
+    return out;
+}
+
+// Returns nullptr if the varint is truncated (`truncated` is set) or does not fit in UnsignedT
+template<typename UnsignedT>
+inline const unsigned char* read_varint(const unsigned char* in, const unsigned char* last, UnsignedT& value, bool& truncated) noexcept {
+    constexpr unsigned BITS = sizeof(UnsignedT) * 8;
+    value = 0;
+    for (unsigned shift = 0; in != last; shift += 7) {
+        const unsigned payload = *in & 0x7fu;
+        const bool more = (*in & 0x80u) != 0;
+        ++in;
+        if (shift >= BITS || (BITS - shift < 7 && (payload >> (BITS - shift)) != 0)) {
+            return nullptr;
+        }
+        value = static_cast<UnsignedT>(value | static_cast<UnsignedT>(static_cast<UnsignedT>(payload) << shift));
+        if (!more) {
+            return in;
+        }
+    }
+    truncated = true;
+    return nullptr;
+}
+
+template<typename DecimalT>
+constexpr bool is_plain_decimal() noexcept {
+    return std::is_same<DecimalT, decimal_t<typename DecimalT::underlying_type, DecimalT::PRECISION>>::value;
+}
+
+}  // namespace detail
+
+// Upper bound of number of bytes needed to serialize `count` values
+template<typename DecimalT>
+constexpr std::size_t max_serialized_size(std::size_t count, binary_format format) noexcept {
+    using UnsignedT = std::make_unsigned_t<typename DecimalT::underlying_type>;
+    return BINARY_HEADER_SIZE + count * (format == binary_format::fixed ? sizeof(UnsignedT) : detail::max_varint_size<UnsignedT>());
+}
+
+template<typename DecimalT>
+serialization_result serialize(span<const DecimalT> values, span<unsigned char> out, binary_format format) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+
+    serialization_result res;
+    if (out.size() < BINARY_HEADER_SIZE
+            || (format == binary_format::fixed && out.size() < max_serialized_size<DecimalT>(values.size(), format))) {
+        res.error = serialization_error::buffer_too_small;
+        return res;
+    }
+    unsigned char* it = out.data();
+    it[0] = static_cast<unsigned char>(format);
+    it[1] = static_cast<unsigned char>(DecimalT::PRECISION);
+    it[2] = static_cast<unsigned char>(sizeof(UnderlyingType));
+    it[3] = 0;
+    detail::store_le<uint64_t>(it + 4, values.size());
+    it += BINARY_HEADER_SIZE;
+
+    if (format == binary_format::fixed) {
+        if constexpr (detail::IS_LITTLE_ENDIAN && detail::is_plain_decimal<DecimalT>() && sizeof(DecimalT) == sizeof(UnderlyingType)) {
+            std::memcpy(it, values.data(), values.size() * sizeof(UnderlyingType));
+            it += values.size() * sizeof(UnderlyingType);
+        } else {
+            for (const auto& value : values) {
+                detail::store_le(it, static_cast<UnsignedT>(value.nominator()));
+                it += sizeof(UnderlyingType);
+            }
+        }
+    } else {
+        const unsigned char* const safeEnd = out.data() + out.size() - std::min(out.size(), detail::max_varint_size<UnsignedT>());
+        for (const auto& value : values) {
+            const UnsignedT encoded = detail::zigzag_encode(value.nominator());
+            if (it > safeEnd) {
+                unsigned char buffer[detail::max_varint_size<UnsignedT>()];
+                const std::size_t size = static_cast<std::size_t>(detail::write_varint(buffer, encoded) - buffer);
+                if (size > static_cast<std::size_t>(out.data() + out.size() - it)) {
+                    res.error = serialization_error::buffer_too_small;
+                    return res;
+                }
+                std::memcpy(it, buffer, size);
+                it += size;
+            } else {
+                it = detail::write_varint(it, encoded);
+            }
+        }
+    }
+    res.bytes = static_cast<std::size_t>(it - out.data());
+    res.count = values.size();
+    return res;
+}
+
+// Reads the number of values stored in serialized buffer, returns false if the header is incomplete or invalid
+inline bool serialized_count(span<const unsigned char> in, std::size_t& count) noexcept {
+    if (in.size() < BINARY_HEADER_SIZE || (in[0] != static_cast<unsigned char>(binary_format::fixed)
+                                           && in[0] != static_cast<unsigned char>(binary_format::compact))) {
+        return false;
+    }
+    count = static_cast<std::size_t>(detail::load_le<uint64_t>(in.data() + 4));
+    return true;
+}
+
+// Deserializes values to `out` which has to hold at least serialized_count() values.
+// Values of ranged decimals are clamped to their range. Width of nominators has to match the underlying type in both
+// formats, otherwise NaN and infinities of another width would be read as finite values.
+template<typename DecimalT>
+serialization_result deserialize(span<const unsigned char> in, span<DecimalT> out) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    using nominator_t = typename DecimalT::nominator_t;
+
+    serialization_result res;
+    std::size_t count = 0;
+    if (!serialized_count(in, count) || in[3] != 0) {
+        res.error = serialization_error::invalid_header;
+        return res;
+    }
+    if (in[1] != DecimalT::PRECISION) {
+        res.error = serialization_error::precision_mismatch;
+        return res;
+    }
+    if (in[2] != sizeof(UnderlyingType)) {
+        res.error = serialization_error::width_mismatch;
+        return res;
+    }
+    if (count > out.size()) {
+        res.error = serialization_error::buffer_too_small;
+        return res;
+    }
+    const unsigned char* it = in.data() + BINARY_HEADER_SIZE;
+    const unsigned char* const last = in.data() + in.size();
+
+    if (in[0] == static_cast<unsigned char>(binary_format::fixed)) {
+        if (static_cast<std::size_t>(last - it) / sizeof(UnderlyingType) < count) {
+            res.error = serialization_error::buffer_too_small;
+            return res;
+        }
+        if constexpr (detail::IS_LITTLE_ENDIAN && detail::is_plain_decimal<DecimalT>() && sizeof(DecimalT) == sizeof(UnderlyingType)) {
+            std::memcpy(static_cast<void*>(out.data()), it, count * sizeof(UnderlyingType));
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = DecimalT{nominator_t{static_cast<UnderlyingType>(detail::load_le<UnsignedT>(it + i * sizeof(UnderlyingType)))}};
+            }
+        }
+        it += count * sizeof(UnderlyingType);
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            UnsignedT encoded{};
+            bool truncated = false;
+            it = detail::read_varint(it, last, encoded, truncated);
+            if (it == nullptr) {
+                res.error = truncated ? serialization_error::buffer_too_small : serialization_error::out_of_range;
+                res.count = i;
+                return res;
+            }
+            out[i] = DecimalT{nominator_t{detail::zigzag_decode<UnderlyingType>(encoded)}};
+        }
+    }
+    res.bytes = static_cast<std::size_t>(it - in.data());
+    res.count = count;
+    return res;
+}
+
+}  // namespace strict
@@ -0,0 +1,246 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Order produced by functions below is the order of operator<, i.e. the signed order of nominators. Sentinel values
+// are ordered as their nominators: -inf first, +inf after all finite values and NaN last. Sorting is stable.
+
+namespace strict
+{
+
+namespace detail
+{
+
+// Unsigned key whose unsigned order equals signed order of nominators
+template<typename DecimalT>
+using radix_key_t = std::make_unsigned_t<typename DecimalT::underlying_type>;
+
+template<typename DecimalT>
+inline radix_key_t<DecimalT> radix_key(const DecimalT& value) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using KeyT = radix_key_t<DecimalT>;
+    if constexpr (std::is_signed<UnderlyingType>::value) {
+        return static_cast<KeyT>(value.nominator()) ^ (KeyT{1} << (sizeof(KeyT) * 8 - 1));
+    } else {
+        return value.nominator();
+    }
+}
+
+template<typename KeyT, typename IndexT>
+struct keyed_index
+{
+    KeyT key;
+    IndexT index;
+};
+
+// LSD radix sort with 8 bit digits. Histograms of all digits are computed in one pass and passes in which all
+// elements share the same digit (e.g. high bytes of prices) are skipped. Returns pointer to the buffer which holds
+// the result, which is either `data` or `scratch`.
+template<typename T, typename KeyFn>
+T* lsd_radix_sort(T* data, T* scratch, std::size_t count, KeyFn key) {
+    using KeyT = decltype(key(*data));
+    constexpr std::size_t DIGITS = sizeof(KeyT);
+    std::vector<std::size_t> histograms(DIGITS * 256, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const KeyT k = key(data[i]);
+        for (std::size_t digit = 0; digit < DIGITS; ++digit) {
+            ++histograms[digit * 256 + ((k >> (digit * 8)) & 0xFF)];
+        }
+    }
+    for (std::size_t digit = 0; digit < DIGITS; ++digit) {
+        std::size_t* const histogram = histograms.data() + digit * 256;
+        if (count == 0 || histogram[(key(data[0]) >> (digit * 8)) & 0xFF] == count) {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < 256; ++bucket) {
+            const std::size_t size = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += size;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            scratch[histogram[(key(data[i]) >> (digit * 8)) & 0xFF]++] = data[i];
+        }
+        std::swap(data, scratch);
+    }
+    return data;
+}
+
+}  // namespace detail
+
+// Sorts values in ascending order, `scratch` must have at least as many elements as `values`
+template<typename DecimalT>
+void radix_sort(span<DecimalT> values, span<DecimalT> scratch) {
+    const DecimalT* const sorted = detail::lsd_radix_sort(values.data(), scratch.data(), values.size(),
+                                                          [](const DecimalT& value) { return detail::radix_key(value); });
+    if (sorted != values.data()) {
+        std::copy(sorted, sorted + values.size(), values.data());
+    }
+}
+
+template<typename DecimalT>
+void radix_sort(span<DecimalT> values) {
+    std::vector<DecimalT> scratch(values.size());
+    radix_sort<DecimalT>(values, scratch);
+}
+
+// Writes to `indices` positions of `values` in their ascending order; `indices` must have size of `values`
+template<typename DecimalT>
+void argsort(span<const DecimalT> values, span<std::size_t> indices) {
+    using KeyT = detail::radix_key_t<DecimalT>;
+    using EntryT = detail::keyed_index<KeyT, std::size_t>;
+    std::vector<EntryT> entries(values.size() * 2);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        entries[i] = EntryT{detail::radix_key(values[i]), i};
+    }
+    const EntryT* const sorted = detail::lsd_radix_sort(entries.data(), entries.data() + values.size(), values.size(),
+                                                        [](const EntryT& entry) { return entry.key; });
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        indices[i] = sorted[i].index;
+    }
+}
+
+template<typename DecimalT>
+std::vector<std::size_t> argsort(span<const DecimalT> values) {
+    std::vector<std::size_t> indices(values.size());
+    argsort<DecimalT>(values, indices);
+    return indices;
+}
+
+// Sorts `keys` in ascending order and reorders `values` accordingly; both spans must have equal size
+template<typename DecimalT, typename ValueT>
+void radix_sort_by_key(span<DecimalT> keys, span<ValueT> values) {
+    const std::vector<std::size_t> order = argsort<DecimalT>(span<const DecimalT>(keys.data(), keys.size()));
+    std::vector<DecimalT> sortedKeys;
+    std::vector<ValueT> sortedValues;
+    sortedKeys.reserve(keys.size());
+    sortedValues.reserve(values.size());
+    for (const std::size_t index : order) {
+        sortedKeys.push_back(keys[index]);
+        sortedValues.push_back(std::move(values[index]));
+    }
+    std::copy(sortedKeys.begin(), sortedKeys.end(), keys.begin());
+    std::move(sortedValues.begin(), sortedValues.end(), values.begin());
+}
+
+namespace detail
+{
+
+constexpr std::size_t SEARCH_WINDOW = 16;
+
+// Number of elements of sorted `window` which are less than `key` (or not greater when `Inclusive`)
+template<bool Inclusive, typename DecimalT>
+inline std::size_t count_preceding(const DecimalT* window, std::size_t size, const DecimalT& key) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+#if defined(__AVX2__)
+    if constexpr (std::is_same<UnderlyingType, int64_t>::value && sizeof(DecimalT) == sizeof(int64_t)) {
+        if (size == SEARCH_WINDOW) {
+            // v < key is counted directly, v <= key as complement of v > key
+            const __m256i needle = _mm256_set1_epi64x(key.nominator());
+            const auto* data = reinterpret_cast<const __m256i*>(window);
+            unsigned mask = 0;
+            for (std::size_t i = 0; i < SEARCH_WINDOW / 4; ++i) {
+                const __m256i value = _mm256_loadu_si256(data + i);
+                const __m256i match = Inclusive ? _mm256_cmpgt_epi64(value, needle) : _mm256_cmpgt_epi64(needle, value);
+                mask |= static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(match))) << (i * 4);
+            }
+            const auto matches = static_cast<std::size_t>(__builtin_popcount(mask));
+            return Inclusive ? SEARCH_WINDOW - matches : matches;
+        }
+    }
+#endif
+    const UnderlyingType pivot = key.nominator();
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        count += Inclusive ? window[i].nominator() <= pivot : window[i].nominator() < pivot;
+    }
+    return count;
+}
+
+// Branchless binary search narrowing the range to SEARCH_WINDOW elements, which are compared at once
+template<bool Inclusive, typename DecimalT>
+inline std::size_t sorted_search(span<const DecimalT> sorted, const DecimalT& key) noexcept {
+    const DecimalT* base = sorted.data();
+    std::size_t size = sorted.size();
+    const auto pivot = key.nominator();
+    while (size > SEARCH_WINDOW) {
+        const std::size_t half = size / 2;
+        const auto probe = base[half].nominator();
+        base = (Inclusive ? probe <= pivot : probe < pivot) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<std::size_t>(base - sorted.data()) + count_preceding<Inclusive>(base, size, key);
+}
+
+}  // namespace detail
+
+// Index of first element of ascending `sorted` which is not less than `key`
+template<typename DecimalT>
+std::size_t lower_bound(span<const DecimalT> sorted, const DecimalT& key) noexcept {
+    return detail::sorted_search<false>(sorted, key);
+}
+
+// Index of first element of ascending `sorted` which is greater than `key`
+template<typename DecimalT>
+std::size_t upper_bound(span<const DecimalT> sorted, const DecimalT& key) noexcept {
+    return detail::sorted_search<true>(sorted, key);
+}
+
+// Batch variant: writes lower_bound of every key to `indices`, which must have size of `keys`
+template<typename DecimalT>
+void lower_bound(span<const DecimalT> sorted, span<const DecimalT> keys, span<std::size_t> indices) noexcept {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        indices[i] = detail::sorted_search<false>(sorted, keys[i]);
+    }
+}
+
+}  // namespace strict
@@ -0,0 +1,109 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus > 201703L && __has_include(<span>)
+#include <span>
+#endif
+
+namespace strict
+{
+
+#if defined(__cpp_lib_span)
+
+template<typename T>
+using span = std::span<T>;
+
+#else
+
+// Minimal replacement of std::span (dynamic extent only) used by column algorithms in C++17 mode
+template<typename T>
+class span
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr span() noexcept = default;
+    constexpr span(T* data, std::size_t size) noexcept : mData(data), mSize(size) {
+    }
+    constexpr span(T* first, T* last) noexcept : mData(first), mSize(static_cast<std::size_t>(last - first)) {
+    }
+    template<std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : mData(array), mSize(N) {
+    }
+    template<typename Container,
+             std::enable_if_t<std::is_convertible<decltype(std::declval<Container&>().data()), T*>::value, bool> = true>
+    constexpr span(Container& container) noexcept : mData(container.data()), mSize(container.size()) {
+    }
+    template<typename Container,
+             std::enable_if_t<std::is_convertible<decltype(std::declval<const Container&>().data()), T*>::value, bool> = true>
+    constexpr span(const Container& container) noexcept : mData(container.data()), mSize(container.size()) {
+    }
+
+    constexpr T* data() const noexcept { return mData; }
+    constexpr std::size_t size() const noexcept { return mSize; }
+    constexpr std::size_t size_bytes() const noexcept { return mSize * sizeof(T); }
+    constexpr bool empty() const noexcept { return mSize == 0; }
+    constexpr T& operator[](std::size_t idx) const noexcept { return mData[idx]; }
+    constexpr T& front() const noexcept { return mData[0]; }
+    constexpr T& back() const noexcept { return mData[mSize - 1]; }
+    constexpr T* begin() const noexcept { return mData; }
+    constexpr T* end() const noexcept { return mData + mSize; }
+
+    constexpr span<T> first(std::size_t count) const noexcept { return span<T>(mData, count); }
+    constexpr span<T> last(std::size_t count) const noexcept { return span<T>(mData + mSize - count, count); }
+    constexpr span<T> subspan(std::size_t offset, std::size_t count = static_cast<std::size_t>(-1)) const noexcept {
+        return span<T>(mData + offset, count == static_cast<std::size_t>(-1) ? mSize - offset : count);
+    }
+
+private:
+    T* mData = nullptr;
+    std::size_t mSize = 0;
+};
+
+#endif
+
+}  // namespace strict
@@ -0,0 +1,495 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Statistics below ignore NaN values. Infinities are ordered before and after all finite values.
+
+namespace strict
+{
+
+namespace detail
+{
+
+// Position of the q-quantile among `count` sorted values by the nearest rank method
+inline std::size_t quantile_rank(double probability, std::size_t count) noexcept {
+    if (count == 0 || !(probability > 0)) {
+        return 0;
+    }
+    const double rank = std::ceil(probability * static_cast<double>(count));
+    return rank >= static_cast<double>(count) ? count - 1 : static_cast<std::size_t>(rank) - 1;
+}
+
+template<typename UnderlyingType>
+struct value_summary
+{
+    std::size_t count = 0;
+    std::size_t nan = 0;
+    std::size_t minusInfinities = 0;
+    std::size_t plusInfinities = 0;
+    UnderlyingType minimum = std::numeric_limits<UnderlyingType>::max();
+    UnderlyingType maximum = std::numeric_limits<UnderlyingType>::lowest();
+
+    std::size_t valid() const noexcept { return count - nan; }
+    std::size_t finite() const noexcept { return count - nan - minusInfinities - plusInfinities; }
+};
+
+template<typename DecimalT>
+value_summary<typename DecimalT::underlying_type> summarize(span<const DecimalT> values) noexcept {
+    value_summary<typename DecimalT::underlying_type> res;
+    res.count = values.size();
+    for (const DecimalT& value : values) {
+        const auto nominator = value.nominator();
+        switch (special_rank<DecimalT>(nominator)) {
+        case 2: ++res.nan; break;
+        case 1: ++res.plusInfinities; break;
+        case -1: ++res.minusInfinities; break;
+        default:
+            res.minimum = std::min(res.minimum, nominator);
+            res.maximum = std::max(res.maximum, nominator);
+        }
+    }
+    return res;
+}
+
+constexpr std::size_t SELECT_BUCKETS = std::size_t{1} << 16;
+
+// Writes to `out` finite values at `ranks` (positions among sorted finite values). Radix selection: finite values
+// are counted in buckets by the highest 16 bits of their offset from the minimum, values of buckets holding requested
+// ranks are gathered in a second pass and the ranks are selected among them with std::nth_element. Both passes are
+// sequential, so selection of any number of quantiles of a huge column reads it only twice.
+template<typename DecimalT>
+void select_finite(span<const DecimalT> values, const value_summary<typename DecimalT::underlying_type>& summary,
+                   const std::size_t* ranks, std::size_t rankCount, DecimalT* out) {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    using UnsignedT = std::make_unsigned_t<UnderlyingType>;
+    using nominator_t = typename DecimalT::nominator_t;
+    if (rankCount == 0) {
+        return;
+    }
+    const UnsignedT range = static_cast<UnsignedT>(static_cast<UnsignedT>(summary.maximum) - static_cast<UnsignedT>(summary.minimum));
+    unsigned shift = 0;
+    while ((range >> shift) >= SELECT_BUCKETS) {
+        ++shift;
+    }
+    const auto bucket_of = [&summary, shift](UnderlyingType nominator) {
+        return static_cast<std::size_t>(static_cast<UnsignedT>(static_cast<UnsignedT>(nominator) - static_cast<UnsignedT>(summary.minimum)) >> shift);
+    };
+    const auto finite = [](UnderlyingType nominator) { return special_rank<DecimalT>(nominator) == 0; };
+
+    std::vector<std::size_t> offsets(SELECT_BUCKETS + 1, 0);
+    for (const DecimalT& value : values) {
+        if (finite(value.nominator())) {
+            ++offsets[bucket_of(value.nominator()) + 1];
+        }
+    }
+    for (std::size_t bucket = 1; bucket <= SELECT_BUCKETS; ++bucket) {
+        offsets[bucket] += offsets[bucket - 1];
+    }
+
+    // candidates of every requested bucket are gathered into one vector, in order of buckets
+    std::vector<std::size_t> rankBuckets(rankCount);
+    std::vector<std::size_t> gatherOffsets(SELECT_BUCKETS, std::numeric_limits<std::size_t>::max());
+    std::size_t candidateCount = 0;
+    for (std::size_t idx = 0; idx < rankCount; ++idx) {
+        const std::size_t bucket = static_cast<std::size_t>(std::upper_bound(offsets.begin(), offsets.end(), ranks[idx]) - offsets.begin()) - 1;
+        rankBuckets[idx] = bucket;
+        if (gatherOffsets[bucket] == std::numeric_limits<std::size_t>::max()) {
+            gatherOffsets[bucket] = candidateCount;
+            candidateCount += offsets[bucket + 1] - offsets[bucket];
+        }
+    }
+    std::vector<UnderlyingType> candidates(candidateCount);
+    std::vector<std::size_t> positions(gatherOffsets);
+    for (const DecimalT& value : values) {
+        if (finite(value.nominator())) {
+            const std::size_t bucket = bucket_of(value.nominator());
+            if (gatherOffsets[bucket] != std::numeric_limits<std::size_t>::max()) {
+                candidates[positions[bucket]++] = value.nominator();
+            }
+        }
+    }
+    for (std::size_t idx = 0; idx < rankCount; ++idx) {
+        const std::size_t bucket = rankBuckets[idx];
+        const auto first = candidates.begin() + static_cast<std::ptrdiff_t>(gatherOffsets[bucket]);
+        const auto last = first + static_cast<std::ptrdiff_t>(offsets[bucket + 1] - offsets[bucket]);
+        const auto nth = first + static_cast<std::ptrdiff_t>(ranks[idx] - offsets[bucket]);
+        std::nth_element(first, nth, last);
+        out[idx] = DecimalT{nominator_t{*nth}};
+    }
+}
+
+// Writes to `out` values at `ranks` (positions among sorted values other than NaN, each less than summary.valid())
+template<typename DecimalT>
+void select_ranks(span<const DecimalT> values, const value_summary<typename DecimalT::underlying_type>& summary,
+                  const std::size_t* ranks, std::size_t rankCount, DecimalT* out) {
+    using nominator_t = typename DecimalT::nominator_t;
+    std::vector<std::size_t> finiteRanks;
+    std::vector<std::size_t> finiteIndices;
+    for (std::size_t idx = 0; idx < rankCount; ++idx) {
+        if (ranks[idx] < summary.minusInfinities) {
+            out[idx] = DecimalT{nominator_t{DecimalT::INFINITY_MINUS}};
+        } else if (ranks[idx] >= summary.minusInfinities + summary.finite()) {
+            out[idx] = DecimalT{nominator_t{DecimalT::INFINITY_PLUS}};
+        } else {
+            finiteRanks.push_back(ranks[idx] - summary.minusInfinities);
+            finiteIndices.push_back(idx);
+        }
+    }
+    std::vector<DecimalT> selected(finiteRanks.size());
+    select_finite(values, summary, finiteRanks.data(), finiteRanks.size(), selected.data());
+    for (std::size_t idx = 0; idx < finiteIndices.size(); ++idx) {
+        out[finiteIndices[idx]] = selected[idx];
+    }
+}
+
+}  // namespace detail
+
+// k-th smallest (counting from 0) value other than NaN, NaN if there are not more than k such values.
+// The column is not modified.
+template<typename DecimalT>
+DecimalT nth_smallest(span<const DecimalT> values, std::size_t k) {
+    const auto summary = detail::summarize(values);
+    DecimalT res{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}};
+    if (k < summary.valid()) {
+        detail::select_ranks(values, summary, &k, 1, &res);
+    }
+    return res;
+}
+
+// Exact quantiles by the nearest rank method: q-quantile is the value at position ceil(q * n) - 1 (0 for q = 0) of
+// n sorted values other than NaN. Results are NaN if there are no such values. `results` must have the size of
+// `probabilities`; the column is read three times regardless of the number of quantiles.
+template<typename DecimalT>
+void quantiles(span<const DecimalT> values, span<const double> probabilities, span<DecimalT> results) {
+    const auto summary = detail::summarize(values);
+    if (summary.valid() == 0) {
+        std::fill(results.begin(), results.end(), DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}});
+        return;
+    }
+    std::vector<std::size_t> ranks;
+    ranks.reserve(probabilities.size());
+    for (const double probability : probabilities) {
+        ranks.push_back(detail::quantile_rank(probability, summary.valid()));
+    }
+    detail::select_ranks(values, summary, ranks.data(), ranks.size(), results.data());
+}
+
+template<typename DecimalT>
+DecimalT quantile(span<const DecimalT> values, double probability) {
+    DecimalT res;
+    quantiles<DecimalT>(values, span<const double>(&probability, 1), span<DecimalT>(&res, 1));
+    return res;
+}
+
+// Values not counted in buckets of a histogram
+struct histogram_outliers
+{
+    std::size_t below = 0;
+    std::size_t above = 0;
+    std::size_t nan = 0;
+};
+
+namespace detail
+{
+
+// Buckets are computed in doubles (multiplication by reciprocal of width, corrected by exact comparison with the
+// bucket edge) when offsets of values in buckets have at most 52 bits, otherwise by integer division
+template<typename DecimalT>
+class histogram_binner
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    using wide_type = select_operating_type_t<underlying_type, underlying_type>;
+
+    histogram_binner(underlying_type low, underlying_type width, std::size_t buckets) noexcept
+        : mLow(low), mWidth(width) {
+        const wide_type high = static_cast<wide_type>(low) + static_cast<wide_type>(width) * static_cast<wide_type>(buckets);
+        const wide_type maxFinite = static_cast<wide_type>(DecimalT::INFINITY_PLUS - 1);
+        mLast = static_cast<underlying_type>(std::min(high - 1, maxFinite));
+        mUseDouble = static_cast<wide_type>(mLast) - static_cast<wide_type>(low) < (wide_type{1} << 52);
+        mReciprocal = 1.0 / static_cast<double>(width);
+    }
+
+    template<typename CountT>
+    void add(underlying_type nominator, CountT* counts, histogram_outliers& outliers) const noexcept {
+        if (nominator == DecimalT::NAN_VALUE) {
+            ++outliers.nan;
+        } else if (nominator < mLow) {
+            ++outliers.below;
+        } else if (nominator > mLast) {
+            ++outliers.above;
+        } else {
+            ++counts[bucket(static_cast<uint64_t>(static_cast<wide_type>(nominator) - static_cast<wide_type>(mLow)))];
+        }
+    }
+
+    std::size_t bucket(uint64_t offset) const noexcept {
+        if (!mUseDouble) {
+            return static_cast<std::size_t>(offset / static_cast<uint64_t>(mWidth));
+        }
+        auto res = static_cast<uint64_t>(static_cast<double>(offset) * mReciprocal);
+        const uint64_t edge = res * static_cast<uint64_t>(mWidth);
+        if (edge > offset) {
+            --res;
+        } else if (edge + static_cast<uint64_t>(mWidth) <= offset) {
+            ++res;
+        }
+        return static_cast<std::size_t>(res);
+    }
+
+#if defined(__AVX2__)
+    // Counts 4 values of a 64 bit column, false if some of them are outliers and must be counted by add()
+    template<typename CountT>
+    bool add_avx2(const int64_t* values, CountT* counts) const noexcept {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(_mm256_set1_epi64x(mLow), value),
+                                                _mm256_cmpgt_epi64(value, _mm256_set1_epi64x(mLast)));
+        if (!_mm256_testz_si256(outside, outside)) {
+            return false;
+        }
+        // offsets below 2^52 are converted to doubles exactly by setting them as mantissa of 2^52
+        const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+        const __m256i offset = _mm256_sub_epi64(value, _mm256_set1_epi64x(mLow));
+        const __m256d exact = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(offset, _mm256_castpd_si256(magic))), magic);
+        const __m256d width = _mm256_set1_pd(static_cast<double>(mWidth));
+        __m256d bucket = _mm256_floor_pd(_mm256_mul_pd(exact, _mm256_set1_pd(mReciprocal)));
+        const __m256d edge = _mm256_mul_pd(bucket, width);
+        const __m256d one = _mm256_set1_pd(1.0);
+        bucket = _mm256_sub_pd(bucket, _mm256_and_pd(_mm256_cmp_pd(edge, exact, _CMP_GT_OQ), one));
+        bucket = _mm256_add_pd(bucket, _mm256_and_pd(_mm256_cmp_pd(_mm256_add_pd(edge, width), exact, _CMP_LE_OQ), one));
+        const __m256i indices = _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(bucket, magic)), _mm256_castpd_si256(magic));
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), indices);
+        ++counts[lanes[0]];
+        ++counts[lanes[1]];
+        ++counts[lanes[2]];
+        ++counts[lanes[3]];
+        return true;
+    }
+#endif
+
+    bool uses_double() const noexcept { return mUseDouble; }
+
+private:
+    underlying_type mLow;
+    underlying_type mWidth;
+    underlying_type mLast;
+    bool mUseDouble;
+    double mReciprocal;
+};
+
+}  // namespace detail
+
+// Counts values in buckets [low + i * width, low + (i + 1) * width) for i < counts.size(); counts are incremented,
+// not reset, so histograms of several columns can be accumulated. Values outside of the buckets (including
+// infinities) and NaN values are counted in returned outliers. Width must be positive. Buckets of 64 bit columns
+// are computed 4 at a time with AVX2 instructions when available.
+template<typename DecimalT>
+histogram_outliers histogram(span<const DecimalT> values, const DecimalT& low, const DecimalT& width, span<uint64_t> counts) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    histogram_outliers outliers;
+    if (counts.empty()) {
+        for (const DecimalT& value : values) {
+            ++(value.nominator() == DecimalT::NAN_VALUE ? outliers.nan : value < low ? outliers.below : outliers.above);
+        }
+        return outliers;
+    }
+    const detail::histogram_binner<DecimalT> binner(low.nominator(), width.nominator(), counts.size());
+    const UnderlyingType* nominators = reinterpret_cast<const UnderlyingType*>(values.data());
+    std::size_t idx = 0;
+#if defined(__AVX2__)
+    if constexpr (std::is_same<UnderlyingType, int64_t>::value) {
+        if (binner.uses_double()) {
+            for (; idx + 4 <= values.size(); idx += 4) {
+                if (!binner.add_avx2(nominators + idx, counts.data())) {
+                    for (std::size_t lane = idx; lane < idx + 4; ++lane) {
+                        binner.add(nominators[lane], counts.data(), outliers);
+                    }
+                }
+            }
+        }
+    }
+#endif
+    for (; idx < values.size(); ++idx) {
+        binner.add(nominators[idx], counts.data(), outliers);
+    }
+    return outliers;
+}
+
+// Mergeable streaming quantile sketch in the manner of the KLL sketch: values are kept in levels, level i values
+// standing for 2^i values each. A full level is sorted and every other value (starting randomly from the first or
+// the second) moves to the next level. Quantiles are values actually added, so they are exact decimals, with rank
+// error proportional to 1 / accuracy; memory is O(accuracy) values. Sketches of parts of data can be merged.
+template<typename DecimalT>
+class quantile_sketch
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+
+    explicit quantile_sketch(std::size_t accuracy = 200) : mAccuracy(std::max(accuracy, MIN_CAPACITY)), mLevels(1) {
+        update_capacities();
+    }
+
+    // Adds value, NaN values are ignored
+    void add(const DecimalT& value) {
+        if (value.nominator() == DecimalT::NAN_VALUE) {
+            return;
+        }
+        mLevels[0].push_back(value.nominator());
+        ++mCount;
+        if (mLevels[0].size() >= mCapacities[0]) {
+            compress(false);
+        }
+    }
+
+    void merge(const quantile_sketch& other) {
+        if (mLevels.size() < other.mLevels.size()) {
+            mLevels.resize(other.mLevels.size());
+        }
+        for (std::size_t level = 0; level < other.mLevels.size(); ++level) {
+            mLevels[level].insert(mLevels[level].end(), other.mLevels[level].begin(), other.mLevels[level].end());
+        }
+        mCount += other.mCount;
+        update_capacities();
+        compress(true);
+    }
+
+    // Approximate q-quantile by the nearest rank method, NaN if no values were added
+    DecimalT quantile(double probability) const {
+        if (mCount == 0) {
+            return DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}};
+        }
+        std::vector<std::pair<underlying_type, uint64_t>> weighted;
+        weighted.reserve(retained());
+        for (std::size_t level = 0; level < mLevels.size(); ++level) {
+            for (const underlying_type nominator : mLevels[level]) {
+                weighted.emplace_back(nominator, uint64_t{1} << level);
+            }
+        }
+        std::sort(weighted.begin(), weighted.end());
+        const uint64_t rank = detail::quantile_rank(probability, mCount);
+        uint64_t weight = 0;
+        for (const auto& item : weighted) {
+            weight += item.second;
+            if (weight > rank) {
+                return DecimalT{typename DecimalT::nominator_t{item.first}};
+            }
+        }
+        return DecimalT{typename DecimalT::nominator_t{weighted.back().first}};
+    }
+
+    // Number of added values and number of values retained in the sketch
+    uint64_t count() const noexcept { return mCount; }
+    std::size_t retained() const noexcept {
+        std::size_t res = 0;
+        for (const auto& level : mLevels) {
+            res += level.size();
+        }
+        return res;
+    }
+
+private:
+    // Lower levels have geometrically smaller capacities (but at least MIN_CAPACITY), so most of memory holds the
+    // most representative values
+    void update_capacities() {
+        mCapacities.resize(mLevels.size());
+        double capacity = static_cast<double>(mAccuracy);
+        for (std::size_t level = mLevels.size(); level-- > 0; capacity *= 2.0 / 3.0) {
+            mCapacities[level] = std::max(MIN_CAPACITY, static_cast<std::size_t>(capacity));
+        }
+    }
+
+    // Compacts full levels; after add() only a chain of levels starting from the first one can be full
+    void compress(bool allLevels) {
+        for (std::size_t level = 0; level < mLevels.size(); ++level) {
+            if (mLevels[level].size() < mCapacities[level]) {
+                if (!allLevels) {
+                    return;
+                }
+                continue;
+            }
+            if (level + 1 == mLevels.size()) {
+                mLevels.emplace_back();
+                update_capacities();
+            }
+            std::vector<underlying_type>& items = mLevels[level];
+            std::sort(items.begin(), items.end());
+            // with odd number of values the smallest one stays, the rest is halved
+            const std::size_t kept = items.size() % 2;
+            for (std::size_t idx = kept + random_bit(); idx < items.size(); idx += 2) {
+                mLevels[level + 1].push_back(items[idx]);
+            }
+            items.resize(kept);
+        }
+    }
+
+    std::size_t random_bit() noexcept {
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 7;
+        mRandom ^= mRandom << 17;
+        return static_cast<std::size_t>(mRandom >> 63);
+    }
+
+    static constexpr std::size_t MIN_CAPACITY = 8;
+
+    std::size_t mAccuracy;
+    std::vector<std::vector<underlying_type>> mLevels;
+    std::vector<std::size_t> mCapacities;
+    uint64_t mCount = 0;
+    uint64_t mRandom = 0x9E3779B97F4A7C15ull;
+};
+
+}  // namespace strict
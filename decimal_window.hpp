@@ -0,0 +1,373 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decimal.hpp"
+#include "decimal_span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Sums below are exact: they are accumulated in the wide operating type and rounded (saturated to +inf/-inf) only
+// when returned. As in decimal_aggregate, NaN values are skipped and infinite values make sums infinite (NaN if both
+// signs occurred).
+
+namespace strict
+{
+
+namespace detail
+{
+
+// Exact sum of a multiset of decimals, values can be added and removed in O(1)
+template<typename DecimalT>
+class window_sum
+{
+public:
+    using underlying_type = typename DecimalT::underlying_type;
+    using wide_type = select_operating_type_t<underlying_type, underlying_type>;
+
+    void add(underlying_type nominator) noexcept { update<true>(nominator); }
+    void remove(underlying_type nominator) noexcept { update<false>(nominator); }
+
+    std::size_t count() const noexcept { return mCount; }
+    wide_type wide_sum() const noexcept { return mSum; }
+    bool finite() const noexcept { return mPlusInfinities == 0 && mMinusInfinities == 0; }
+
+    DecimalT sum() const noexcept {
+        if (!finite()) {
+            return DecimalT{typename DecimalT::nominator_t{mPlusInfinities != 0 && mMinusInfinities != 0 ? DecimalT::NAN_VALUE
+                                                           : mPlusInfinities != 0 ? DecimalT::INFINITY_PLUS : DecimalT::INFINITY_MINUS}};
+        }
+        return saturate_wide<DecimalT>(mSum);
+    }
+
+    // Mean rounded half away from zero, NaN if there are no values
+    DecimalT mean() const noexcept {
+        if (mCount == 0 || !finite()) {
+            return mCount == 0 ? DecimalT{typename DecimalT::nominator_t{DecimalT::NAN_VALUE}} : sum();
+        }
+        return saturate_wide<DecimalT>(divide_rounded(mSum, static_cast<wide_type>(mCount)));
+    }
+
+    // Sets the sum of finite values, used after adding values without the object
+    void assign(wide_type sum, std::size_t count) noexcept {
+        mSum = sum;
+        mCount = count;
+    }
+
+private:
+    template<bool Add>
+    void update(underlying_type nominator) noexcept {
+        switch (special_rank<DecimalT>(nominator)) {
+        case 2: return;
+        case 1: Add ? ++mPlusInfinities : --mPlusInfinities; break;
+        case -1: Add ? ++mMinusInfinities : --mMinusInfinities; break;
+        default: Add ? mSum += nominator : mSum -= nominator; break;
+        }
+        Add ? ++mCount : --mCount;
+    }
+
+    wide_type mSum{};
+    std::size_t mCount = 0;
+    std::size_t mPlusInfinities = 0;
+    std::size_t mMinusInfinities = 0;
+};
+
+// Prefix sums are computed in blocks; block of nominators below PREFIX_SUM_BOUND added to a running sum below
+// PREFIX_SUM_LIMIT stays far from special values, so it can be summed in 64 bits
+constexpr std::size_t PREFIX_SUM_BLOCK = 64;
+constexpr int64_t PREFIX_SUM_BOUND = int64_t{1} << 55;
+constexpr int64_t PREFIX_SUM_LIMIT = int64_t{1} << 62;
+
+inline bool bounded_block(const int64_t* values) noexcept {
+#if defined(__AVX2__)
+    const __m256i upper = _mm256_set1_epi64x(PREFIX_SUM_BOUND);
+    const __m256i lower = _mm256_set1_epi64x(-PREFIX_SUM_BOUND);
+    __m256i outside = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < PREFIX_SUM_BLOCK; i += 4) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        outside = _mm256_or_si256(outside, _mm256_or_si256(_mm256_cmpgt_epi64(value, upper), _mm256_cmpgt_epi64(lower, value)));
+    }
+    return _mm256_testz_si256(outside, outside) != 0;
+#else
+    // value is bounded if value + bound is in [0, 2 * bound), this vectorizes even without 64 bit comparisons
+    uint64_t shifted = 0;
+    for (std::size_t i = 0; i < PREFIX_SUM_BLOCK; ++i) {
+        shifted |= static_cast<uint64_t>(values[i]) + static_cast<uint64_t>(PREFIX_SUM_BOUND);
+    }
+    return shifted < static_cast<uint64_t>(2 * PREFIX_SUM_BOUND);
+#endif
+}
+
+// Writes prefix sums of a bounded block starting from `carry` and returns the last one
+inline int64_t prefix_sum_block(const int64_t* values, int64_t* sums, int64_t carry) noexcept {
+#if defined(__AVX2__)
+    // Sums within vectors of 4 take two shifted additions, the running total is only added to them, so the carried
+    // dependency is a single addition per vector
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i running = _mm256_set1_epi64x(carry);
+    for (std::size_t i = 0; i < PREFIX_SUM_BLOCK; i += 4) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        value = _mm256_add_epi64(value, _mm256_blend_epi32(_mm256_permute4x64_epi64(value, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x03));
+        value = _mm256_add_epi64(value, _mm256_blend_epi32(_mm256_permute4x64_epi64(value, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x0F));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums + i), _mm256_add_epi64(value, running));
+        running = _mm256_add_epi64(running, _mm256_permute4x64_epi64(value, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    return _mm256_extract_epi64(running, 0);
+#else
+    for (std::size_t i = 0; i < PREFIX_SUM_BLOCK; ++i) {
+        carry += values[i];
+        sums[i] = carry;
+    }
+    return carry;
+#endif
+}
+
+}  // namespace detail
+
+// sums[i] = values[0] + ... + values[i]; spans must have equal size and may be the same. Blocks of 64 bit
+// nominators small enough not to overflow are summed in 64 bits (with AVX2 instructions when available), others
+// exactly in the wide type.
+template<typename DecimalT>
+void prefix_sum(span<const DecimalT> values, span<DecimalT> sums) noexcept {
+    using UnderlyingType = typename DecimalT::underlying_type;
+    static_assert(has_nominator_layout_v<DecimalT>, "decimal must consist of its nominator only");
+    const UnderlyingType* in = reinterpret_cast<const UnderlyingType*>(values.data());
+    UnderlyingType* out = reinterpret_cast<UnderlyingType*>(sums.data());
+    detail::window_sum<DecimalT> state;
+    std::size_t idx = 0;
+    while (idx < values.size()) {
+        if constexpr (std::is_same<UnderlyingType, int64_t>::value) {
+            const auto sum = state.wide_sum();
+            if (idx + detail::PREFIX_SUM_BLOCK <= values.size() && state.finite() && sum < detail::PREFIX_SUM_LIMIT &&
+                sum > -detail::PREFIX_SUM_LIMIT && detail::bounded_block(in + idx)) {
+                const int64_t last = detail::prefix_sum_block(in + idx, out + idx, static_cast<int64_t>(sum));
+                idx += detail::PREFIX_SUM_BLOCK;
+                state.assign(last, idx);
+                continue;
+            }
+        }
+        const std::size_t blockEnd = std::min(values.size(), idx + detail::PREFIX_SUM_BLOCK);
+        for (; idx < blockEnd; ++idx) {
+            state.add(in[idx]);
+            out[idx] = state.sum().nominator();
+        }
+    }
+}
+
+// sums[i] = sum of last `window` values up to values[i] (fewer at the beginning); spans must have equal size and
+// must not overlap
+template<typename DecimalT>
+void rolling_sum(span<const DecimalT> values, std::size_t window, span<DecimalT> sums) noexcept {
+    detail::window_sum<DecimalT> state;
+    for (std::size_t idx = 0; idx < values.size(); ++idx) {
+        state.add(values[idx].nominator());
+        if (idx >= window) {
+            state.remove(values[idx - window].nominator());
+        }
+        sums[idx] = state.sum();
+    }
+}
+
+// means[i] = mean of last `window` values up to values[i] (fewer at the beginning) rounded half away from zero,
+// NaN values are not counted; spans must have equal size and must not overlap
+template<typename DecimalT>
+void rolling_mean(span<const DecimalT> values, std::size_t window, span<DecimalT> means) noexcept {
+    detail::window_sum<DecimalT> state;
+    for (std::size_t idx = 0; idx < values.size(); ++idx) {
+        state.add(values[idx].nominator());
+        if (idx >= window) {
+            state.remove(values[idx - window].nominator());
+        }
+        means[idx] = state.mean();
+    }
+}
+
+// Cumulative sum of a stream of decimals
+template<typename DecimalT>
+class running_sum
+{
+public:
+    // Adds value and returns the sum of all values so far
+    DecimalT add(const DecimalT& value) noexcept {
+        mState.add(value.nominator());
+        return mState.sum();
+    }
+
+    DecimalT sum() const noexcept { return mState.sum(); }
+    // Number of summed (not NaN) values
+    std::size_t count() const noexcept { return mState.count(); }
+
+private:
+    detail::window_sum<DecimalT> mState;
+};
+
+// Sum and mean of the last `window` decimals of a stream, updated in O(1) per value
+template<typename DecimalT>
+class rolling_window
+{
+public:
+    explicit rolling_window(std::size_t window) : mValues(std::max<std::size_t>(window, 1)) {
+    }
+
+    void push(const DecimalT& value) noexcept {
+        if (mSize == mValues.size()) {
+            mState.remove(mValues[mNext].nominator());
+        } else {
+            ++mSize;
+        }
+        mValues[mNext] = value;
+        mState.add(value.nominator());
+        mNext = mNext + 1 == mValues.size() ? 0 : mNext + 1;
+    }
+
+    DecimalT sum() const noexcept { return mState.sum(); }
+    // Mean rounded half away from zero, NaN if the window has no values other than NaN
+    DecimalT mean() const noexcept { return mState.mean(); }
+    // Number of values in the window, and number of them which are not NaN
+    std::size_t size() const noexcept { return mSize; }
+    std::size_t count() const noexcept { return mState.count(); }
+    std::size_t window() const noexcept { return mValues.size(); }
+
+private:
+    std::vector<DecimalT> mValues;
+    std::size_t mNext = 0;
+    std::size_t mSize = 0;
+    detail::window_sum<DecimalT> mState;
+};
+
+// Volume weighted average price sum(price * quantity) / sum(quantity). Products are accumulated exactly in the wide
+// operating type and the quotient is rounded (half away from zero) once, to precision of prices. Trades with NaN
+// price or quantity are skipped; the result is NaN if there are trades with infinite price or quantity or if the sum
+// of quantities is zero.
+template<typename PriceT, typename QuantityT>
+class vwap_accumulator
+{
+public:
+    using wide_type = select_operating_type_t<typename PriceT::underlying_type, typename QuantityT::underlying_type>;
+
+    void add(const PriceT& price, const QuantityT& quantity) noexcept { update<true>(price, quantity); }
+    // Removes a previously added trade, e.g. one leaving a time window
+    void remove(const PriceT& price, const QuantityT& quantity) noexcept { update<false>(price, quantity); }
+
+    PriceT value() const noexcept {
+        if (mInfinite != 0 || mQuantity == 0) {
+            return PriceT{typename PriceT::nominator_t{PriceT::NAN_VALUE}};
+        }
+        // nominators of notional have precision of prices plus precision of quantities
+        return mQuantity > 0 ? detail::saturate_wide<PriceT>(detail::divide_rounded(mNotional, mQuantity))
+                             : detail::saturate_wide<PriceT>(detail::divide_rounded(-mNotional, -mQuantity));
+    }
+
+    // Number of accumulated trades
+    std::size_t count() const noexcept { return mCount; }
+
+private:
+    template<bool Add>
+    void update(const PriceT& price, const QuantityT& quantity) noexcept {
+        const int priceRank = detail::special_rank<PriceT>(price.nominator());
+        const int quantityRank = detail::special_rank<QuantityT>(quantity.nominator());
+        if (priceRank == 2 || quantityRank == 2) {
+            return;
+        }
+        if (priceRank != 0 || quantityRank != 0) {
+            Add ? ++mInfinite : --mInfinite;
+        } else {
+            const wide_type notional = static_cast<wide_type>(price.nominator()) * static_cast<wide_type>(quantity.nominator());
+            Add ? mNotional += notional : mNotional -= notional;
+            Add ? mQuantity += quantity.nominator() : mQuantity -= quantity.nominator();
+        }
+        Add ? ++mCount : --mCount;
+    }
+
+    wide_type mNotional{};
+    wide_type mQuantity{};
+    std::size_t mCount = 0;
+    std::size_t mInfinite = 0;
+};
+
+// VWAP of trades (prices[i], quantities[i]) as computed by vwap_accumulator; spans must have equal size
+template<typename PriceT, typename QuantityT>
+PriceT vwap(span<const PriceT> prices, span<const QuantityT> quantities) noexcept {
+    vwap_accumulator<PriceT, QuantityT> accumulator;
+    for (std::size_t idx = 0; idx < prices.size(); ++idx) {
+        accumulator.add(prices[idx], quantities[idx]);
+    }
+    return accumulator.value();
+}
+
+// VWAP of the last `window` trades of a stream, updated in O(1) per trade
+template<typename PriceT, typename QuantityT>
+class rolling_vwap
+{
+public:
+    explicit rolling_vwap(std::size_t window) : mTrades(std::max<std::size_t>(window, 1)) {
+    }
+
+    void push(const PriceT& price, const QuantityT& quantity) noexcept {
+        if (mSize == mTrades.size()) {
+            mAccumulator.remove(mTrades[mNext].first, mTrades[mNext].second);
+        } else {
+            ++mSize;
+        }
+        mTrades[mNext] = {price, quantity};
+        mAccumulator.add(price, quantity);
+        mNext = mNext + 1 == mTrades.size() ? 0 : mNext + 1;
+    }
+
+    PriceT value() const noexcept { return mAccumulator.value(); }
+    std::size_t size() const noexcept { return mSize; }
+    std::size_t window() const noexcept { return mTrades.size(); }
+
+private:
+    std::vector<std::pair<PriceT, QuantityT>> mTrades;
+    std::size_t mNext = 0;
+    std::size_t mSize = 0;
+    vwap_accumulator<PriceT, QuantityT> mAccumulator;
+};
+
+}  // namespace strict
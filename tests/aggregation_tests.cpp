@@ -0,0 +1,182 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_aggregation.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+
+namespace
+{
+
+template<typename DecimalT>
+strict::decimal_aggregate<DecimalT> aggregate_of(std::initializer_list<const char*> texts)
+{
+    strict::decimal_aggregate<DecimalT> res;
+    for (const auto& value : decimals_of<DecimalT>(texts)) {
+        res.add(value);
+    }
+    return res;
+}
+
+}  // namespace
+
+bool test_aggregating_decimals()
+{
+    const auto aggregate = aggregate_of<decimal2d_t>({"10.25", "-3.5", "7", "100.01"});
+    ASSERT_EQ(aggregate.count(), 4u);
+    ASSERT_EQ(aggregate.sum().to_string(), "113.76");
+    ASSERT_EQ(aggregate.min().to_string(), "-3.50");
+    ASSERT_EQ(aggregate.max().to_string(), "100.01");
+    ASSERT_EQ(aggregate.avg().to_string(), "28.44");
+
+    strict::decimal_aggregate<decimal2d_t> empty;
+    ASSERT_EQ(empty.count(), 0u);
+    ASSERT_EQ(empty.sum().to_string(), "0.00");
+    ASSERT_EQ(empty.avg().to_string(), "nan");
+    ASSERT_EQ(empty.min().to_string(), "nan");
+
+    auto merged = aggregate_of<decimal2d_t>({"1", "2"});
+    merged.merge(aggregate_of<decimal2d_t>({"-5", "4"}));
+    ASSERT_EQ(merged.count(), 4u);
+    ASSERT_EQ(merged.sum().to_string(), "2.00");
+    ASSERT_EQ(merged.min().to_string(), "-5.00");
+    ASSERT_EQ(merged.max().to_string(), "4.00");
+
+    // sum exceeding 32 bit nominators is exact in the wide accumulator and saturates to infinity
+    auto wide = aggregate_of<decimal2d32_t>({"20000000", "20000000", "-19999999.99"});
+    ASSERT_EQ(wide.sum().to_string(), "20000000.01");
+    wide.add(decimal2d32_t("20000000"));
+    ASSERT_EQ(wide.sum().to_string(), "inf");
+    ASSERT_TRUE(wide.wide_sum() == 4000000001);
+    return true;
+}
+
+bool test_aggregating_special_values()
+{
+    auto aggregate = aggregate_of<decimal2d_t>({"1", "2"});
+    aggregate.add(decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}));
+    ASSERT_EQ(aggregate.count(), 2u);
+    ASSERT_EQ(aggregate.sum().to_string(), "3.00");
+    aggregate.add(decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::INFINITY_PLUS}));
+    ASSERT_EQ(aggregate.sum().to_string(), "inf");
+    ASSERT_EQ(aggregate.avg().to_string(), "inf");
+    ASSERT_EQ(aggregate.max().to_string(), "inf");
+    aggregate.add(decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS}));
+    ASSERT_EQ(aggregate.sum().to_string(), "nan");
+    ASSERT_EQ(aggregate.min().to_string(), "-inf");
+    return true;
+}
+
+bool test_average_rounding()
+{
+    ASSERT_EQ(aggregate_of<decimal2d_t>({"0.01", "0.02"}).avg().to_string(), "0.02");     // 0.015
+    ASSERT_EQ(aggregate_of<decimal2d_t>({"0.01", "0.01", "0.02"}).avg().to_string(), "0.01");  // 0.0133
+    ASSERT_EQ(aggregate_of<decimal2d_t>({"-1.01", "-1.02"}).avg().to_string(), "-1.02");  // -1.015
+    ASSERT_EQ(aggregate_of<decimal2d_t>({"-1.01", "-1.01", "-1.02"}).avg().to_string(), "-1.01");
+    ASSERT_EQ(aggregate_of<decimal2d_t>({"1", "2", "4"}).avg().to_string(), "2.33");
+    return true;
+}
+
+bool test_grouping_by_key()
+{
+    strict::hash_aggregator<string, decimal2d_t> aggregator;
+    const vector<string> instruments{"AAPL", "MSFT", "AAPL", "VOD", "MSFT", "AAPL"};
+    vector<decimal2d_t> notionals;
+    for (const char* text : {"100.5", "20", "0.5", "7.25", "30", "-1"}) {
+        notionals.emplace_back(text);
+    }
+    aggregator.add(instruments, notionals);
+    ASSERT_EQ(aggregator.group_count(), 3u);
+    const auto* aapl = aggregator.find("AAPL");
+    ASSERT_TRUE(aapl != nullptr);
+    ASSERT_EQ(aapl->count(), 3u);
+    ASSERT_EQ(aapl->sum().to_string(), "100.00");
+    ASSERT_EQ(aapl->min().to_string(), "-1.00");
+    ASSERT_EQ(aggregator.find("MSFT")->avg().to_string(), "25.00");
+    ASSERT_TRUE(aggregator.find("IBM") == nullptr);
+
+    aggregator.add("VOD", decimal2d_t("2.75"));
+    map<string, string> sums;
+    for (const auto& group : aggregator.results()) {
+        sums[group.first] = group.second.sum().to_string();
+    }
+    ASSERT_TRUE((sums == map<string, string>{{"AAPL", "100.00"}, {"MSFT", "50.00"}, {"VOD", "10.00"}}));
+    return true;
+}
+
+bool test_grouping_in_parallel()
+{
+    std::mt19937_64 generator(4);
+    std::uniform_int_distribution<int> keyDistribution(0, 5000);
+    std::uniform_int_distribution<int64_t> valueDistribution(-100000, 100000);
+    vector<int> keys;
+    vector<decimal2d_t> values;
+    map<int, int64_t> expectedSums;
+    map<int, size_t> expectedCounts;
+    for (int i = 0; i < 100000; ++i) {
+        keys.push_back(keyDistribution(generator));
+        values.emplace_back(decimal2d_t::nominator_t{valueDistribution(generator)});
+        expectedSums[keys.back()] += values.back().nominator();
+        ++expectedCounts[keys.back()];
+    }
+    strict::aggregation_options options;
+    options.threads = 4;
+    options.partitions = 16;
+    options.bufferedRows = 30000;  // several flushes
+    strict::hash_aggregator<int, decimal2d_t> aggregator(options);
+    aggregator.add(keys, values);
+    ASSERT_EQ(aggregator.group_count(), expectedSums.size());
+    size_t groups = 0;
+    bool matching = true;
+    aggregator.for_each([&](int key, const strict::decimal_aggregate<decimal2d_t>& aggregate) {
+        ++groups;
+        matching = matching && aggregate.sum().nominator() == expectedSums[key] && aggregate.count() == expectedCounts[key];
+    });
+    ASSERT_EQ(groups, expectedSums.size());
+    ASSERT_TRUE(matching);
+    return true;
+}
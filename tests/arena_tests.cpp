@@ -0,0 +1,183 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "arena_tests.hpp"
+#include "../decimal_arena.hpp"
+#include "test_macros.hpp"
+
+#include <cstddef>
+#include <iomanip>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using ranged2d_t = strict::ranged_decimal_t<int64_t, 2, -100, 100>;
+
+namespace
+{
+
+// Upstream resource counting allocations which reach it
+class counting_resource : public pmr::memory_resource
+{
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+}  // namespace
+
+bool test_formatting_to_arena()
+{
+    // arena which fails instead of falling back to the heap
+    char storage[1024];
+    pmr::monotonic_buffer_resource arena(storage, sizeof(storage), pmr::null_memory_resource());
+
+    const string_view first = strict::format_to_arena(decimal2d_t("-12.345"), arena);
+    const string_view second = strict::format_to_arena(decimal2d_t("1000000.5"), arena);
+    ASSERT_EQ(first, "-12.35");
+    ASSERT_EQ(second, "1000000.50");
+    ASSERT_EQ(strict::format_to_arena(decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}), arena), "nan");
+    ASSERT_EQ(strict::format_to_arena(ranged2d_t("-99.99"), arena), "-99.99");
+    // previously formatted text is not overwritten
+    ASSERT_EQ(first, "-12.35");
+    ASSERT_TRUE(first.data() >= storage && first.data() + first.size() <= storage + sizeof(storage));
+
+    const vector<decimal2d_t> column{decimal2d_t("1.5"), decimal2d_t("-2"), decimal2d_t("3.25")};
+    ASSERT_EQ(strict::format_column_to_arena(strict::span<const decimal2d_t>(column), ';', arena), "1.50;-2.00;3.25");
+    ASSERT_EQ(strict::format_column_to_arena(strict::span<const decimal2d_t>(), ';', arena), "");
+
+    const pmr::string text = strict::to_pmr_string(decimal2d_t("0.07"), &arena);
+    ASSERT_EQ(text, "0.07");
+    ASSERT_TRUE(text.get_allocator().resource() == &arena);
+    ASSERT_EQ(strict::to_pmr_string(decimal2d_t("123456789012.34")), "123456789012.34");
+    return true;
+}
+
+bool test_streaming_decimals_without_allocation()
+{
+    ostringstream out;
+    out << decimal2d_t("1.25") << ' ' << ranged2d_t("-3.5") << ' ' << decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS});
+    ASSERT_EQ(out.str(), "1.25 -3.50 -inf");
+
+    // width and fill apply to the whole text as for strings
+    ostringstream padded;
+    padded << setw(8) << decimal2d_t("1.25") << '|' << left << setfill('*') << setw(7) << ranged2d_t("-3.5") << '|';
+    ASSERT_EQ(padded.str(), "    1.25|-3.50**|");
+    return true;
+}
+
+bool test_parsing_views_of_arena_buffer()
+{
+    char storage[2048];
+    pmr::monotonic_buffer_resource arena(storage, sizeof(storage), pmr::null_memory_resource());
+
+    string message = "101.25|-0.5|abc|7||12.345";
+    const string_view text = strict::copy_to_arena(message, arena);
+    // the source buffer may be reused after the copy
+    message.assign(message.size(), 'x');
+    ASSERT_EQ(text, "101.25|-0.5|abc|7||12.345");
+
+    decimal2d_t value;
+    const auto res = strict::from_chars(text.substr(0, 6), value);
+    ASSERT_TRUE(res.ec == errc{});
+    ASSERT_TRUE(res.ptr == text.data() + 6);
+    ASSERT_EQ(value, decimal2d_t("101.25"));
+
+    pmr::vector<decimal2d_t> values(&arena);
+    ASSERT_EQ(strict::parse_delimited(text, '|', values), 2);
+    ASSERT_EQ(values.size(), 6);
+    ASSERT_EQ(values[0], decimal2d_t("101.25"));
+    ASSERT_EQ(values[1].nominator(), -50);
+    ASSERT_EQ(values[2].nominator(), decimal2d_t::NAN_VALUE);
+    ASSERT_EQ(values[3], decimal2d_t(7));
+    ASSERT_EQ(values[4].nominator(), decimal2d_t::NAN_VALUE);
+    ASSERT_EQ(values[5], decimal2d_t("12.35"));
+
+    // fields with trailing characters are invalid, empty text has no fields
+    values.clear();
+    ASSERT_EQ(strict::parse_delimited(string_view("1.5x,2"), ',', values), 1);
+    ASSERT_EQ(values[0].nominator(), decimal2d_t::NAN_VALUE);
+    ASSERT_EQ(values[1], decimal2d_t(2));
+    ASSERT_EQ(strict::parse_delimited(string_view(), ',', values), 0);
+    ASSERT_EQ(values.size(), 2);
+    return true;
+}
+
+bool test_reusing_arena_per_message()
+{
+    counting_resource upstream;
+    pmr::monotonic_buffer_resource arena(4096, &upstream);
+    const string message = "1.01,2.02,3.03,4.04,5.05,6.06,7.07,8.08";
+
+    size_t allocationsAfterFirstMessage = 0;
+    for (int i = 0; i < 100; ++i) {
+        const string_view text = strict::copy_to_arena(message, arena);
+        pmr::vector<decimal2d_t> values(&arena);
+        values.reserve(8);
+        ASSERT_EQ(strict::parse_delimited(text, ',', values), 0);
+        decimal2d_t sum;
+        for (const auto& value : values) {
+            sum += value;
+        }
+        ASSERT_EQ(strict::format_to_arena(sum, arena), "36.36");
+        ASSERT_EQ(strict::format_column_to_arena(strict::span<const decimal2d_t>(values.data(), values.size()), ',', arena), message);
+        arena.release();
+        if (i == 0) {
+            allocationsAfterFirstMessage = upstream.allocations;
+        }
+    }
+    // release() returns memory upstream and the next message allocates one block again
+    ASSERT_EQ(upstream.allocations, allocationsAfterFirstMessage * 100);
+    ASSERT_EQ(allocationsAfterFirstMessage, 1);
+    return true;
+}
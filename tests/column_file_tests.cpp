@@ -0,0 +1,241 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "column_file_tests.hpp"
+#include "../decimal_column_file.hpp"
+#include "test_macros.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+
+namespace
+{
+
+string temp_path(const char* name)
+{
+    return (filesystem::temp_directory_path() / name).string();
+}
+
+vector<decimal2d_t> ascending_values(size_t count)
+{
+    vector<decimal2d_t> values;
+    for (size_t i = 0; i < count; ++i) {
+        values.emplace_back(decimal2d_t::nominator_t{static_cast<int64_t>(i) * 5 - 1000});
+    }
+    return values;
+}
+
+}  // namespace
+
+bool test_column_file_round_trip()
+{
+    const string path = temp_path("strict_decimal_round_trip.sdcf");
+    vector<decimal2d_t> values = ascending_values(1000);
+    values[3] = decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE});
+    values[4] = decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS});
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 256) ==
+                strict::column_file_error::none);
+
+    strict::mapped_column<decimal2d_t> column;
+    ASSERT_TRUE(!column.is_open());
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::none);
+    ASSERT_TRUE(column.is_open());
+    ASSERT_EQ(column.size(), values.size());
+    ASSERT_EQ(column.block_size(), 256);
+    ASSERT_EQ(column.block_count(), 4);
+    ASSERT_TRUE(column.has_statistics());
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(column.values().data()) % alignof(decimal2d_t), 0);
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(column.values()[i].nominator(), values[i].nominator());
+    }
+
+    strict::mapped_column<decimal2d_t> moved = std::move(column);
+    ASSERT_TRUE(!column.is_open());
+    ASSERT_EQ(moved.size(), values.size());
+    ASSERT_EQ(moved.values()[999], values[999]);
+    moved.close();
+    ASSERT_TRUE(!moved.is_open());
+    ASSERT_EQ(moved.size(), 0);
+
+    // empty column
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>()) == strict::column_file_error::none);
+    ASSERT_TRUE(moved.open(path.c_str()) == strict::column_file_error::none);
+    ASSERT_EQ(moved.size(), 0);
+    ASSERT_EQ(moved.block_count(), 0);
+    moved.close();
+    std::remove(path.c_str());
+    return true;
+}
+
+bool test_column_file_block_statistics()
+{
+    const string path = temp_path("strict_decimal_statistics.sdcf");
+    vector<decimal2d_t> values = ascending_values(200);
+    values[70] = decimal2d_t("-99999.99");
+    values[150] = decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::INFINITY_PLUS});
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 64) ==
+                strict::column_file_error::none);
+
+    strict::mapped_column<decimal2d_t> column;
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::none);
+    ASSERT_EQ(column.block_count(), 4);
+    ASSERT_EQ(column.block_min(0), decimal2d_t("-10.00"));
+    ASSERT_EQ(column.block_max(0), decimal2d_t("-6.85"));
+    ASSERT_EQ(column.block_min(1), decimal2d_t("-99999.99"));
+    ASSERT_EQ(column.block_max(1), decimal2d_t("-3.65"));
+    // special values are plain nominators
+    ASSERT_EQ(column.block_max(2).nominator(), decimal2d_t::INFINITY_PLUS);
+    // incomplete last block
+    ASSERT_EQ(column.block_min(3).nominator(), -40);
+    ASSERT_EQ(column.block_max(3).nominator(), -5);
+    column.close();
+
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 64, false) ==
+                strict::column_file_error::none);
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::none);
+    ASSERT_TRUE(!column.has_statistics());
+    ASSERT_TRUE(column.block_may_contain(0, decimal2d_t(1000), decimal2d_t(2000)));
+    column.close();
+    std::remove(path.c_str());
+    return true;
+}
+
+bool test_selecting_range_of_column_file_skips_blocks()
+{
+    const string path = temp_path("strict_decimal_range.sdcf");
+    const vector<decimal2d_t> values = ascending_values(1000);
+    for (const bool statistics : {true, false}) {
+        ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 128, statistics) ==
+                    strict::column_file_error::none);
+        strict::mapped_column<decimal2d_t> column;
+        ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::none);
+
+        const decimal2d_t low("1.00");
+        const decimal2d_t high("7.50");
+        if (statistics) {
+            ASSERT_TRUE(!column.block_may_contain(0, low, high));
+            ASSERT_TRUE(column.block_may_contain(1, low, high));
+            ASSERT_TRUE(column.block_may_contain(2, low, high));
+            ASSERT_TRUE(!column.block_may_contain(3, low, high));
+        }
+
+        vector<uint64_t> bitmask(strict::bitmask_words(values.size()), ~uint64_t{0});
+        const size_t count = column.select_range(low, high, strict::span<uint64_t>(bitmask));
+        size_t expected = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const bool inside = low <= values[i] && values[i] <= high;
+            expected += inside ? 1 : 0;
+            ASSERT_EQ((((bitmask[i / 64] >> (i % 64)) & 1) != 0), inside);
+        }
+        ASSERT_EQ(count, expected);
+        ASSERT_EQ(count, 131);
+
+        // range of values at the ends and an empty range
+        ASSERT_EQ(column.select_range(decimal2d_t("-10.00"), decimal2d_t("-10.00"), strict::span<uint64_t>(bitmask)), 1);
+        ASSERT_EQ(column.select_range(values.back(), decimal2d_t(1000), strict::span<uint64_t>(bitmask)), 1);
+        ASSERT_EQ(column.select_range(high, low, strict::span<uint64_t>(bitmask)), 0);
+        ASSERT_EQ(strict::bitmask_count(strict::span<const uint64_t>(bitmask)), 0);
+    }
+
+    // bitmask larger than needed, words beyond the last value are left untouched
+    const vector<decimal2d_t> few = ascending_values(100);
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(few), 128, true) ==
+                strict::column_file_error::none);
+    strict::mapped_column<decimal2d_t> small;
+    ASSERT_TRUE(small.open(path.c_str()) == strict::column_file_error::none);
+    vector<uint64_t> wide(strict::bitmask_words(few.size()) + 2, ~uint64_t{0});
+    ASSERT_EQ(small.select_range(few.front(), few.back(), strict::span<uint64_t>(wide)), 100);
+    ASSERT_EQ(wide[1], (uint64_t{1} << 36) - 1);
+    ASSERT_EQ(wide[2], ~uint64_t{0});
+    ASSERT_EQ(wide[3], ~uint64_t{0});
+    std::remove(path.c_str());
+    return true;
+}
+
+bool test_rejecting_invalid_column_files()
+{
+    const string path = temp_path("strict_decimal_invalid.sdcf");
+    const vector<decimal2d_t> values = ascending_values(100);
+    strict::mapped_column<decimal2d_t> column;
+    ASSERT_TRUE(column.open(temp_path("strict_decimal_missing.sdcf").c_str()) == strict::column_file_error::io_error);
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 100) ==
+                strict::column_file_error::invalid_block_size);
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values), 0) ==
+                strict::column_file_error::invalid_block_size);
+
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values)) == strict::column_file_error::none);
+    strict::mapped_column<decimal4d_t> otherPrecision;
+    ASSERT_TRUE(otherPrecision.open(path.c_str()) == strict::column_file_error::precision_mismatch);
+    ASSERT_TRUE(!otherPrecision.is_open());
+    strict::mapped_column<decimal2d32_t> otherType;
+    ASSERT_TRUE(otherType.open(path.c_str()) == strict::column_file_error::type_mismatch);
+    strict::mapped_column<strict::decimal_t<uint64_t, 2>> otherSign;
+    ASSERT_TRUE(otherSign.open(path.c_str()) == strict::column_file_error::type_mismatch);
+
+    // truncated values
+    filesystem::resize_file(path, filesystem::file_size(path) - 1);
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::truncated);
+    filesystem::resize_file(path, 10);
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::truncated);
+
+    // corrupted header
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values)) == strict::column_file_error::none);
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    std::fputc('X', file);
+    std::fclose(file);
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::invalid_header);
+    ASSERT_TRUE(!column.is_open());
+
+    ASSERT_TRUE(strict::write_column_file(path.c_str(), strict::span<const decimal2d_t>(values)) == strict::column_file_error::none);
+    file = std::fopen(path.c_str(), "r+b");
+    std::fseek(file, 4, SEEK_SET);
+    std::fputc(2, file);
+    std::fclose(file);
+    ASSERT_TRUE(column.open(path.c_str()) == strict::column_file_error::unsupported_version);
+    std::remove(path.c_str());
+    return true;
+}
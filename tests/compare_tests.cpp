@@ -0,0 +1,194 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_compare.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal6d_t = strict::decimal_t<int64_t, 6>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+using decimal0d_t = strict::decimal_t<int64_t, 0>;
+using decimal30d_t = strict::decimal_t<int64_t, 30>;
+using strict::compare_op;
+
+namespace
+{
+
+template<typename DecimalT, typename ScalarT>
+bool expected_match(const DecimalT& value, compare_op op, const ScalarT& scalar)
+{
+    const int result = strict::compare(value, scalar);
+    switch (op) {
+    case compare_op::equal: return result == 0;
+    case compare_op::not_equal: return result != 0;
+    case compare_op::less: return result < 0;
+    case compare_op::less_equal: return result <= 0;
+    case compare_op::greater: return result > 0;
+    default: return result >= 0;
+    }
+}
+
+const compare_op OPS[] = {compare_op::equal, compare_op::not_equal, compare_op::less,
+                          compare_op::less_equal, compare_op::greater, compare_op::greater_equal};
+
+template<typename DecimalT, typename ScalarT>
+bool column_matches_compare(const vector<DecimalT>& values, const ScalarT& scalar)
+{
+    vector<uint64_t> bitmask(strict::bitmask_words(values.size()), 0xDEADBEEF);
+    for (auto op : OPS) {
+        strict::compare_column<DecimalT>(values, op, scalar, bitmask);
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (((bitmask[i / 64] >> (i % 64)) & 1) != static_cast<uint64_t>(expected_match(values[i], op, scalar))) {
+                return false;
+            }
+        }
+        if (values.size() % 64 != 0 && (bitmask.back() >> (values.size() % 64)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+bool test_comparing_decimals_of_different_precisions()
+{
+    ASSERT_EQ(strict::compare(decimal2d_t("1.25"), decimal6d_t("1.25")), 0);
+    ASSERT_TRUE(strict::compare(decimal2d_t("1.25"), decimal6d_t("1.250001")) < 0);
+    ASSERT_TRUE(strict::compare(decimal2d_t("1.25"), decimal6d_t("1.249999")) > 0);
+    ASSERT_TRUE(strict::compare(decimal6d_t("1.249999"), decimal2d_t("1.25")) < 0);
+    ASSERT_TRUE(strict::compare(decimal2d_t("-1.25"), decimal6d_t("-1.249999")) < 0);
+    ASSERT_TRUE(strict::compare(decimal6d_t("-1.250001"), decimal2d_t("-1.25")) < 0);
+    ASSERT_EQ(strict::compare(decimal2d32_t("-7.5"), decimal6d_t("-7.5")), 0);
+    ASSERT_TRUE(strict::compare(decimal0d_t(3), decimal2d_t("2.99")) > 0);
+
+    // nominators whose rescaling overflows 128 bits are still compared exactly
+    const decimal30d_t tiny{decimal30d_t::nominator_t{1}};
+    ASSERT_TRUE(strict::compare(decimal0d_t(0), tiny) < 0);
+    ASSERT_TRUE(strict::compare(tiny, decimal0d_t(0)) > 0);
+    ASSERT_TRUE(strict::compare(decimal0d_t(-1), tiny) < 0);
+    ASSERT_TRUE(strict::compare(decimal0d_t(std::numeric_limits<int64_t>::max() - 2), decimal2d_t(1)) > 0);
+    return true;
+}
+
+bool test_comparing_special_values_of_different_precisions()
+{
+    const auto nan2 = special<decimal2d_t>(decimal2d_t::NAN_VALUE);
+    const auto nan6 = special<decimal6d_t>(decimal6d_t::NAN_VALUE);
+    const auto inf6 = special<decimal6d_t>(decimal6d_t::INFINITY_PLUS);
+    const auto minusInf32 = special<decimal2d32_t>(decimal2d32_t::INFINITY_MINUS);
+    ASSERT_EQ(strict::compare(nan2, nan6), 0);
+    ASSERT_TRUE(strict::compare(inf6, nan2) < 0);
+    ASSERT_TRUE(strict::compare(decimal2d_t("1000000"), inf6) < 0);
+    ASSERT_TRUE(strict::compare(minusInf32, decimal6d_t("-1000000")) < 0);
+    ASSERT_EQ(strict::compare(minusInf32, special<decimal6d_t>(decimal6d_t::INFINITY_MINUS)), 0);
+    // largest finite int32 nominator is less than infinity of other type
+    ASSERT_TRUE(strict::compare(special<decimal2d32_t>(decimal2d32_t::INFINITY_PLUS - 1), inf6) < 0);
+    return true;
+}
+
+bool test_three_way_comparison()
+{
+#if defined(__cpp_impl_three_way_comparison) && __has_include(<compare>)
+    ASSERT_TRUE((decimal2d_t("1.25") <=> decimal6d_t("1.250001")) < 0);
+    ASSERT_TRUE(decimal2d_t("1.25") == decimal6d_t("1.25"));
+    ASSERT_TRUE(decimal6d_t("1.25") != decimal2d_t("1.26"));
+    ASSERT_TRUE(decimal6d_t("1.000001") > decimal2d_t("1"));
+    ASSERT_TRUE(decimal2d_t("1") <= decimal6d_t("1"));
+    ASSERT_TRUE((decimal2d_t("2") <=> decimal2d_t("1")) > 0);
+#endif
+    return true;
+}
+
+bool test_comparing_columns_with_scalar()
+{
+    std::mt19937_64 generator(9);
+    std::uniform_int_distribution<int64_t> distribution(-20, 20);
+    vector<decimal2d_t> values;
+    vector<decimal2d32_t> values32;
+    for (size_t i = 0; i < 203; ++i) {
+        values.emplace_back(decimal2d_t::nominator_t{distribution(generator)});
+        values32.emplace_back(decimal2d32_t::nominator_t{static_cast<int32_t>(distribution(generator))});
+    }
+    values[7] = special<decimal2d_t>(decimal2d_t::NAN_VALUE);
+    values[100] = special<decimal2d_t>(decimal2d_t::INFINITY_PLUS);
+    values[150] = special<decimal2d_t>(decimal2d_t::INFINITY_MINUS);
+    for (int64_t nominator = -21; nominator <= 21; ++nominator) {
+        ASSERT_TRUE(column_matches_compare(values, decimal2d_t(decimal2d_t::nominator_t{nominator})));
+        ASSERT_TRUE(column_matches_compare(values32, decimal2d32_t(decimal2d32_t::nominator_t{static_cast<int32_t>(nominator)})));
+    }
+    ASSERT_TRUE(column_matches_compare(values, special<decimal2d_t>(decimal2d_t::NAN_VALUE)));
+    ASSERT_TRUE(column_matches_compare(values, special<decimal2d_t>(decimal2d_t::INFINITY_PLUS)));
+    ASSERT_TRUE(column_matches_compare(values, special<decimal2d_t>(decimal2d_t::INFINITY_MINUS)));
+
+    vector<uint64_t> bitmask(strict::bitmask_words(values.size()));
+    strict::compare_column<decimal2d_t>(values, compare_op::greater, decimal2d_t("0.1"), bitmask);
+    size_t matches = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        matches += (bitmask[i / 64] >> (i % 64)) & 1;
+    }
+    ASSERT_EQ(matches, static_cast<size_t>(std::count_if(values.begin(), values.end(), [](const decimal2d_t& v) { return v > decimal2d_t("0.1"); })));
+    return true;
+}
+
+bool test_comparing_columns_with_scalar_of_other_precision()
+{
+    vector<decimal2d_t> values;
+    for (int64_t nominator = -300; nominator <= 300; ++nominator) {
+        values.emplace_back(decimal2d_t::nominator_t{nominator});
+    }
+    values.push_back(special<decimal2d_t>(decimal2d_t::INFINITY_PLUS - 1));
+    values.push_back(special<decimal2d_t>(decimal2d_t::INFINITY_MINUS + 1));
+    values.push_back(special<decimal2d_t>(decimal2d_t::NAN_VALUE));
+    for (const char* text : {"1.25", "1.255", "-1.255", "0.000001", "-0.000001", "2.999999"}) {
+        ASSERT_TRUE(column_matches_compare(values, decimal6d_t(text)));
+    }
+    ASSERT_TRUE(column_matches_compare(values, decimal0d_t(2)));
+    ASSERT_TRUE(column_matches_compare(values, decimal0d_t(-3)));
+    // scalars outside of the range of column type
+    ASSERT_TRUE(column_matches_compare(values, decimal0d_t(std::numeric_limits<int64_t>::max() - 2)));
+    ASSERT_TRUE(column_matches_compare(values, decimal0d_t(std::numeric_limits<int64_t>::min() + 2)));
+    ASSERT_TRUE(column_matches_compare(values, decimal30d_t(decimal30d_t::nominator_t{1})));
+    ASSERT_TRUE(column_matches_compare(values, special<decimal6d_t>(decimal6d_t::INFINITY_MINUS)));
+    return true;
+}
@@ -0,0 +1,170 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "compounding_tests.hpp"
+#include "../decimal_compounding.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal3d_t = strict::decimal_t<int64_t, 3>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+
+bool test_compound()
+{
+    ASSERT_EQ(strict::compound(decimal8d_t("0.05"), 2).to_string(), "1.10250000");
+    // 1.1025 is a midpoint, rounded once away from zero
+    ASSERT_EQ(strict::compound(decimal3d_t("0.05"), 2).to_string(), "1.103");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.05"), 360).to_string(), "42476396.40868002");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.05"), -30).to_string(), "0.23137745");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.1"), -7).to_string(), "0.51315812");
+    ASSERT_EQ(strict::compound(decimal8d_t("0"), 1000000).to_string(), "1.00000000");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.05"), 0).to_string(), "1.00000000");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.5"), 200).to_string(), "inf");
+    ASSERT_EQ(strict::compound(decimal8d_t("0.5"), -200).to_string(), "0.00000000");
+    ASSERT_EQ(strict::compound(decimal8d_t("-1"), 5).to_string(), "0.00000000");
+    ASSERT_EQ(strict::compound(decimal8d_t("-1"), -5).to_string(), "inf");
+    ASSERT_EQ(strict::compound(decimal8d_t("-2"), 5).to_string(), "nan");
+    ASSERT_EQ(strict::compound(special<decimal8d_t>(decimal8d_t::NAN_VALUE), 5).to_string(), "nan");
+    ASSERT_EQ(strict::compound(special<decimal8d_t>(decimal8d_t::INFINITY_PLUS), -5).to_string(), "0.00000000");
+    return true;
+}
+
+bool test_discount_factors()
+{
+    vector<decimal8d_t> factors(400);
+    strict::discount_factors(decimal8d_t("0.05"), strict::span<decimal8d_t>(factors.data(), factors.size()));
+    for (size_t idx = 0; idx < factors.size(); ++idx) {
+        ASSERT_EQ(factors[idx], strict::compound(decimal8d_t("0.05"), -static_cast<int64_t>(idx)));
+    }
+
+    vector<decimal3d_t> exact(4);
+    strict::discount_factors(decimal3d_t("0.25"), strict::span<decimal3d_t>(exact.data(), exact.size()));
+    ASSERT_EQ(exact[0].to_string(), "1.000");
+    ASSERT_EQ(exact[1].to_string(), "0.800");
+    ASSERT_EQ(exact[2].to_string(), "0.640");
+    ASSERT_EQ(exact[3].to_string(), "0.512");
+
+    strict::discount_factors(decimal3d_t("-1.5"), strict::span<decimal3d_t>(exact.data(), exact.size()));
+    ASSERT_EQ(exact[0].to_string(), "1.000");
+    ASSERT_EQ(exact[1].to_string(), "nan");
+    return true;
+}
+
+bool test_present_value()
+{
+    const auto cashflows = decimals_of<decimal2d_t>({"100", "200", "-50"});
+    const auto factors = decimals_of<decimal8d_t>({"1", "0.95238095", "0.90702948"});
+    // 100 + 190.47619 - 45.351474 = 245.124716
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>(cashflows, factors).to_string()), "245.12");
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>({}, {}).to_string()), "0.00");
+
+    auto special_cashflows = cashflows;
+    special_cashflows[1] = special<decimal2d_t>(decimal2d_t::INFINITY_PLUS);
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>(special_cashflows, factors).to_string()), "inf");
+    auto special_factors = factors;
+    special_factors[2] = special<decimal8d_t>(decimal8d_t::INFINITY_PLUS);
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>(special_cashflows, special_factors).to_string()), "nan");
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>(cashflows, special_factors).to_string()), "-inf");
+    special_cashflows[2] = decimal2d_t("0");
+    ASSERT_EQ((strict::present_value<decimal2d_t, decimal8d_t>(special_cashflows, special_factors).to_string()), "nan");
+
+    // sums beyond the wide operating type saturate, sums returning into it stay exact
+    using decimal4d_t = strict::decimal_t<int64_t, 4>;
+    using decimal18d_t = strict::decimal_t<int64_t, 18>;
+    const int64_t half = numeric_limits<int64_t>::max() / 2;
+    vector<decimal4d_t> large(64, special<decimal4d_t>(half));
+    const vector<decimal18d_t> largeFactors(128, special<decimal18d_t>(half));
+    ASSERT_EQ((strict::present_value<decimal4d_t, decimal18d_t>(large, {largeFactors.data(), 64}).to_string()), "inf");
+    large.resize(128, special<decimal4d_t>(-half));
+    ASSERT_EQ((strict::present_value<decimal4d_t, decimal18d_t>({large.data() + 64, 64}, {largeFactors.data(), 64}).to_string()), "-inf");
+    large.push_back(decimal4d_t("1"));
+    vector<decimal18d_t> cancelling = largeFactors;
+    cancelling.push_back(decimal18d_t("0.5"));
+    ASSERT_EQ((strict::present_value<decimal4d_t, decimal18d_t>(large, cancelling).to_string()), "0.5000");
+    return true;
+}
+
+bool test_npv()
+{
+    const auto project = decimals_of<decimal2d_t>({"-1000", "300", "400", "500"});
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.1"), project).to_string(), "-21.04");
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0"), project).to_string(), "200.00");
+
+    vector<decimal2d_t> annuity(13, decimal2d_t("8000"));
+    annuity[0] = decimal2d_t("-100000");
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.075"), annuity).to_string(), "-38117.77");
+
+    // 0.03 / 1.2 = 0.025 is a midpoint, rounded away from zero although 1 / 1.2 is not exact in binary
+    const auto midpoint = decimals_of<decimal2d_t>({"0", "0.03"});
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.2"), midpoint).to_string(), "0.03");
+
+    // 120 monthly cash flows
+    vector<decimal2d_t> cashflows;
+    for (int idx = 0; idx < 120; ++idx) {
+        cashflows.emplace_back(decimal2d_t::nominator_t{(idx * 7919) % 20011 - 10000});
+    }
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.004"), cashflows).to_string(), "85.74");
+    return true;
+}
+
+bool test_npv_special_values()
+{
+    const auto cashflows = decimals_of<decimal2d_t>({"-1000", "300", "400", "500"});
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.1"), {}).to_string(), "0.00");
+    ASSERT_EQ(strict::npv<decimal2d_t>(special<decimal8d_t>(decimal8d_t::NAN_VALUE), cashflows).to_string(), "nan");
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("-1"), cashflows).to_string(), "nan");
+
+    auto special_cashflows = cashflows;
+    special_cashflows[1] = special<decimal2d_t>(decimal2d_t::INFINITY_MINUS);
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.1"), special_cashflows).to_string(), "-inf");
+    special_cashflows[2] = special<decimal2d_t>(decimal2d_t::INFINITY_PLUS);
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.1"), special_cashflows).to_string(), "nan");
+    special_cashflows[2] = special<decimal2d_t>(decimal2d_t::NAN_VALUE);
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t("0.1"), special_cashflows).to_string(), "nan");
+
+    // discount factors of negative rates grow, cash flows beyond the range saturate
+    vector<decimal2d_t> longCashflows(2000, decimal2d_t("1"));
+    ASSERT_EQ(strict::npv<decimal2d_t>(decimal8d_t(decimal8d_t::nominator_t{-50000000}), longCashflows).to_string(), "inf");
+    return true;
+}
@@ -0,0 +1,204 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_compression.hpp"
+#include "test_macros.hpp"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using strict::compression_codec;
+
+namespace
+{
+
+const compression_codec CODECS[] = {compression_codec::frame_of_reference, compression_codec::delta, compression_codec::xor_delta};
+
+// random walk of prices around 100.0000 with ticks of 0.0005
+vector<decimal4d_t> price_series(size_t count)
+{
+    std::mt19937_64 generator(7);
+    std::uniform_int_distribution<int> ticks(-3, 3);
+    vector<decimal4d_t> res;
+    int64_t nominator = 1000000;
+    for (size_t i = 0; i < count; ++i) {
+        nominator += ticks(generator) * 5;
+        res.emplace_back(decimal4d_t::nominator_t{nominator});
+    }
+    return res;
+}
+
+}  // namespace
+
+bool test_round_trip_of_compressed_columns()
+{
+    for (size_t count : {size_t{1}, size_t{5}, size_t{128}, size_t{129}, size_t{1000}}) {
+        const auto values = price_series(count);
+        for (auto codec : CODECS) {
+            const auto column = strict::compressed_column<decimal4d_t>::compress(values, codec);
+            ASSERT_EQ(column.size(), count);
+            ASSERT_EQ(column.block_count(), (count + 127) / 128);
+            vector<decimal4d_t> decoded(count);
+            column.decompress(decoded);
+            ASSERT_TRUE(decoded == values);
+        }
+    }
+    return true;
+}
+
+bool test_compressing_extreme_values()
+{
+    vector<decimal4d_t> values;
+    std::mt19937_64 generator(11);
+    for (int i = 0; i < 300; ++i) {
+        values.emplace_back(decimal4d_t::nominator_t{static_cast<int64_t>(generator())});
+    }
+    values[3] = decimal4d_t{decimal4d_t::nominator_t{std::numeric_limits<int64_t>::min()}};
+    values[4] = decimal4d_t{decimal4d_t::nominator_t{std::numeric_limits<int64_t>::max()}};
+    values[200] = decimal4d_t{decimal4d_t::nominator_t{decimal4d_t::INFINITY_MINUS}};
+    for (auto codec : CODECS) {
+        const auto column = strict::compressed_column<decimal4d_t>::compress(values, codec);
+        vector<decimal4d_t> decoded(values.size());
+        column.decompress(decoded);
+        ASSERT_TRUE(decoded == values);
+        ASSERT_EQ(column.header(0).bitWidth, 64u);
+    }
+
+    const vector<decimal4d_t> constant(200, decimal4d_t{42});
+    for (auto codec : CODECS) {
+        const auto column = strict::compressed_column<decimal4d_t>::compress(constant, codec);
+        ASSERT_EQ(column.header(0).bitWidth, 0u);
+        ASSERT_EQ(column.at(150).to_string(), "42.0000");
+    }
+    return true;
+}
+
+bool test_random_access_to_compressed_column()
+{
+    const auto values = price_series(1000);
+    for (auto codec : CODECS) {
+        const auto column = strict::compressed_column<decimal4d_t>::compress(values, codec);
+        for (size_t idx = 0; idx < values.size(); idx += 37) {
+            ASSERT_EQ(column.at(idx), values[idx]);
+        }
+        vector<decimal4d_t> block(column.block_size(7), decimal4d_t{});
+        column.decode_block(7, block);
+        ASSERT_EQ(block.size(), 1000u - 7 * 128);
+        ASSERT_EQ(block.back(), values.back());
+    }
+    return true;
+}
+
+bool test_aggregating_compressed_blocks()
+{
+    const auto values = price_series(1000);
+    decimal4d_t expectedSum{};
+    for (const auto& value : values) {
+        expectedSum += value;
+    }
+    for (auto codec : CODECS) {
+        const auto column = strict::compressed_column<decimal4d_t>::compress(values, codec);
+        ASSERT_EQ(column.sum(), expectedSum);
+        ASSERT_EQ(column.min(), *std::min_element(values.begin(), values.end()));
+        ASSERT_EQ(column.max(), *std::max_element(values.begin(), values.end()));
+        ASSERT_EQ(column.block_min(1), *std::min_element(values.begin() + 128, values.begin() + 256));
+        ASSERT_EQ(column.block_max(1), *std::max_element(values.begin() + 128, values.begin() + 256));
+    }
+
+    // sum which does not fit in the nominator saturates instead of wrapping
+    const int64_t large = decimal4d_t::INFINITY_PLUS / 2 + 1;
+    const vector<decimal4d_t> overflowing(3, decimal4d_t{decimal4d_t::nominator_t{large}});
+    const vector<decimal4d_t> underflowing(3, decimal4d_t{decimal4d_t::nominator_t{-large}});
+    for (auto codec : CODECS) {
+        ASSERT_EQ(strict::compressed_column<decimal4d_t>::compress(overflowing, codec).sum().nominator(), decimal4d_t::INFINITY_PLUS);
+        ASSERT_EQ(strict::compressed_column<decimal4d_t>::compress(underflowing, codec).sum().nominator(), decimal4d_t::INFINITY_MINUS);
+    }
+
+    // NaN is skipped and infinities propagate, like in decimal_aggregate
+    const decimal4d_t nan{decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE}};
+    const decimal4d_t plusInf{decimal4d_t::nominator_t{decimal4d_t::INFINITY_PLUS}};
+    const decimal4d_t minusInf{decimal4d_t::nominator_t{decimal4d_t::INFINITY_MINUS}};
+    vector<decimal4d_t> withNan(9, decimal4d_t(-1));
+    withNan.push_back(nan);
+    vector<decimal4d_t> withInfinities = price_series(300);
+    withInfinities[5] = plusInf;
+    for (auto codec : CODECS) {
+        const auto column = strict::compressed_column<decimal4d_t>::compress(withNan, codec);
+        ASSERT_EQ(column.sum().to_string(), "-9.0000");
+        ASSERT_EQ(column.header(0).nans, 1u);
+
+        strict::compressed_column<decimal4d_t> infinite(codec);
+        infinite.append(strict::span<const decimal4d_t>(withInfinities.data(), 200));
+        infinite.append(strict::span<const decimal4d_t>(withInfinities.data() + 200, 100));
+        ASSERT_EQ(infinite.sum(), plusInf);
+        infinite.append(strict::span<const decimal4d_t>(&minusInf, 1));
+        ASSERT_EQ(infinite.sum().nominator(), decimal4d_t::NAN_VALUE);
+        ASSERT_EQ(infinite.header(2).minusInfinities, 1u);
+        ASSERT_EQ(infinite.header(0).plusInfinities, 1u);
+    }
+    return true;
+}
+
+bool test_appending_to_compressed_column()
+{
+    const auto values = price_series(700);
+    strict::compressed_column<decimal4d_t> column(compression_codec::delta);
+    for (size_t offset = 0; offset < values.size(); offset += 50) {
+        column.append(strict::span<const decimal4d_t>(values.data() + offset, 50));
+    }
+    ASSERT_EQ(column.size(), values.size());
+    vector<decimal4d_t> decoded(values.size());
+    column.decompress(decoded);
+    ASSERT_TRUE(decoded == values);
+    ASSERT_EQ(column.compressed_bytes(),
+              strict::compressed_column<decimal4d_t>::compress(values, compression_codec::delta).compressed_bytes());
+    return true;
+}
+
+bool test_compression_ratio_of_price_series()
+{
+    const auto values = price_series(128 * 100);
+    const auto delta = strict::compressed_column<decimal4d_t>::compress(values, compression_codec::delta);
+    const auto reference = strict::compressed_column<decimal4d_t>::compress(values, compression_codec::frame_of_reference);
+    ASSERT_TRUE(delta.compressed_bytes() * 4 < values.size() * sizeof(decimal4d_t));
+    ASSERT_TRUE(delta.compressed_bytes() < reference.compressed_bytes());
+    return true;
+}
@@ -0,0 +1,154 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "constexpr_tests.hpp"
+#include "../decimal.hpp"
+#include "test_macros.hpp"
+
+#include <cstdint>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+using percent_t = strict::ranged_decimal_t<int64_t, 2, 0, 100>;
+
+namespace
+{
+
+constexpr decimal2d_t value(int64_t nominator)
+{
+    return decimal2d_t(decimal2d_t::nominator_t{nominator});
+}
+
+// Fee schedule computed at compile time: 0.25% of a 1234.56 notional, rounded to cents
+constexpr decimal4d_t FEE_RATE(0, 25);
+constexpr decimal2d_t NOTIONAL(1234, 56);
+constexpr decimal2d_t FEE = NOTIONAL * FEE_RATE;
+static_assert(FEE.nominator() == 309, "0.25% of 1234.56 is 3.0864");
+
+// Tick table
+constexpr decimal4d_t TICK(0.0005);
+constexpr decimal4d_t tick_price(int ticks)
+{
+    decimal4d_t price(100);
+    for (int i = 0; i < ticks; ++i) {
+        price += TICK;
+    }
+    return price;
+}
+static_assert(tick_price(7).nominator() == 1000035, "100 + 7 ticks of 0.0005");
+
+static_assert(value(150) + value(275) == value(425), "addition");
+static_assert(value(150) - value(275) == value(-125), "subtraction");
+static_assert(-value(150) == value(-150), "negation");
+static_assert((value(105) * value(105)).nominator() == 110, "1.05 * 1.05 = 1.1025");
+static_assert((value(100) / value(300)).nominator() == 33, "1 / 3");
+static_assert((value(100) / decimal4d_t(3)).nominator() == 33, "1 / 3 with other precision");
+static_assert((value(100) / value(0)).nominator() == decimal2d_t::INFINITY_PLUS, "division by zero");
+static_assert(strict::decimal_cast<decimal2d_t>(decimal4d_t(decimal4d_t::nominator_t{-12345})).nominator() == -123,
+              "narrowing cast rounds half away from zero");
+static_assert(decimal2d_t(-12.345).integer_part() == -12, "integer part");
+static_assert(decimal2d_t(-12.345).fraction_part() == 35, "fraction part");
+static_assert(percent_t(150).nominator() == 10000, "ranged decimal is clamped");
+static_assert(strict::max(value(1), value(2)) == value(2), "max");
+
+}  // namespace
+
+bool test_constexpr_construction()
+{
+    constexpr decimal2d_t fromDouble(2.675);
+    constexpr decimal2d_t fromNegativeDouble(-0.005);
+    constexpr decimal2d_t fromInteger(42);
+    constexpr decimal2d_t fromParts(3, 14159);
+    constexpr decimal8d_t fromSmallDouble(0.000000015);
+    ASSERT_EQ(fromDouble, decimal2d_t(2.675));
+    ASSERT_EQ(fromNegativeDouble, decimal2d_t(-0.005));
+    ASSERT_EQ(fromInteger, decimal2d_t(42));
+    ASSERT_EQ(fromParts, decimal2d_t(3, 14159));
+    ASSERT_EQ(fromSmallDouble, decimal8d_t(0.000000015));
+    ASSERT_EQ(fromParts.to_string(), "3.14");
+    ASSERT_EQ(fromNegativeDouble.to_string(), "-0.01");
+    constexpr double asDouble = fromParts.to_double();
+    ASSERT_EQ(asDouble, 3.14);
+    return true;
+}
+
+bool test_constexpr_arithmetic()
+{
+    constexpr decimal2d_t a = value(12345);
+    constexpr decimal2d_t b = value(-678);
+    constexpr decimal8d_t rate(decimal8d_t::nominator_t{108765432});
+    constexpr decimal2d_t sum = a + b;
+    constexpr decimal2d_t product = a * b;
+    constexpr decimal2d_t mixedProduct = a * rate;
+    constexpr decimal2d_t quotient = a / b;
+    constexpr decimal2d_t mixedQuotient = a / rate;
+    ASSERT_EQ(sum, a + b);
+    ASSERT_EQ(product, a * b);
+    ASSERT_EQ(mixedProduct, a * rate);
+    ASSERT_EQ(quotient, a / b);
+    ASSERT_EQ(mixedQuotient, a / rate);
+    ASSERT_EQ(mixedProduct.to_string(), "134.27");
+    ASSERT_EQ(quotient.to_string(), "-18.21");
+    return true;
+}
+
+bool test_constexpr_cast()
+{
+    constexpr decimal8d_t widened = strict::decimal_cast<decimal8d_t>(value(-12345));
+    constexpr decimal2d_t narrowed = strict::decimal_cast<decimal2d_t>(decimal8d_t(decimal8d_t::nominator_t{123456789}));
+    constexpr decimal2d_t same = strict::decimal_cast<int64_t, 2>(strict::decimal_t<int32_t, 2>(7));
+    ASSERT_EQ(widened.to_string(), "-123.45000000");
+    ASSERT_EQ(narrowed.to_string(), "1.23");
+    ASSERT_EQ(same.to_string(), "7.00");
+    return true;
+}
+
+bool test_constexpr_ranged_decimal()
+{
+    constexpr percent_t a(60);
+    constexpr percent_t b(70);
+    constexpr percent_t sum = a + b;
+    constexpr percent_t difference = a - b;
+    constexpr percent_t half = a * decimal2d_t(0.5);
+    ASSERT_EQ(sum.to_string(), "100.00");
+    ASSERT_EQ(difference.to_string(), "0.00");
+    ASSERT_EQ(half.to_string(), "30.00");
+    return true;
+}
@@ -0,0 +1,135 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_csv.hpp"
+#include "test_macros.hpp"
+
+#include <cstdio>
+#include <string>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+bool test_parsing_selected_csv_columns()
+{
+    const string csv = "id,price,qty,desk\n"
+                       "1,10.5,100,A\n"
+                       "2,-0.25,7.12345,B\r\n"
+                       "3,\"42\",0,C\n";
+    strict::csv_column_parser<decimal4d_t> parser({2, 1});
+    parser.parse(csv.data(), csv.data() + csv.size());
+    parser.finish();
+
+    ASSERT_EQ(parser.rows(), 3u);
+    ASSERT_EQ(parser.invalid_fields(), 0u);
+    const auto& qty = parser.columns()[0];
+    const auto& price = parser.columns()[1];
+    ASSERT_EQ(price[0].to_string(), "10.5000");
+    ASSERT_EQ(price[1].to_string(), "-0.2500");
+    ASSERT_EQ(price[2].to_string(), "42.0000");
+    ASSERT_EQ(qty[0].to_string(), "100.0000");
+    ASSERT_EQ(qty[1].to_string(), "7.1235");
+    ASSERT_EQ(qty[2].to_string(), "0.0000");
+    return true;
+}
+
+bool test_parsing_csv_split_into_chunks()
+{
+    const string csv = "1.5;2.5\n3.5;4.5\n5.5;6.5";
+    strict::csv_options options;
+    options.delimiter = ';';
+    options.skipHeader = false;
+
+    for (size_t chunk = 1; chunk <= csv.size(); ++chunk) {
+        strict::csv_column_parser<decimal4d_t> parser({1}, options);
+        for (size_t offset = 0; offset < csv.size(); offset += chunk) {
+            parser.parse(csv.data() + offset, csv.data() + std::min(csv.size(), offset + chunk));
+        }
+        parser.finish();
+        const auto columns = parser.release_columns();
+        ASSERT_EQ(columns[0].size(), 3u);
+        ASSERT_EQ(columns[0][0].to_string(), "2.5000");
+        ASSERT_EQ(columns[0][1].to_string(), "4.5000");
+        ASSERT_EQ(columns[0][2].to_string(), "6.5000");
+    }
+    return true;
+}
+
+bool test_parsing_invalid_and_missing_csv_fields()
+{
+    const string csv = "a,b\n1,x\n2\n\n3,4\n";
+    strict::csv_column_parser<decimal4d_t> parser({0, 1});
+    parser.parse(csv.data(), csv.data() + csv.size());
+    parser.finish();
+
+    ASSERT_EQ(parser.rows(), 3u);
+    ASSERT_EQ(parser.invalid_fields(), 2u);
+    ASSERT_EQ(parser.columns()[1][0].nominator(), decimal4d_t::NAN_VALUE);
+    ASSERT_EQ(parser.columns()[1][1].nominator(), decimal4d_t::NAN_VALUE);
+    ASSERT_EQ(parser.columns()[1][2].to_string(), "4.0000");
+    ASSERT_EQ(parser.columns()[0][1].to_string(), "2.0000");
+    return true;
+}
+
+bool test_reading_csv_file()
+{
+    const string path = "strict_decimal_csv_test.csv";
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(file != nullptr);
+    std::fputs("instrument,position\n", file);
+    for (int i = 0; i < 10000; ++i) {
+        std::fprintf(file, "X%d,%d.%04d\n", i, i, i % 10000);
+    }
+    std::fclose(file);
+
+    strict::csv_options options;
+    options.blockSize = 4096;
+    strict::csv_column_parser<decimal4d_t> parser({1}, options);
+    const bool read = strict::read_csv_file(path, parser);
+    std::remove(path.c_str());
+    ASSERT_TRUE(read);
+    ASSERT_EQ(parser.rows(), 10000u);
+    ASSERT_EQ(parser.invalid_fields(), 0u);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(parser.columns()[0][i].nominator(), int64_t{i} * 10000 + i % 10000);
+    }
+
+    strict::csv_column_parser<decimal4d_t> missing({0});
+    ASSERT_TRUE(!strict::read_csv_file("strict_decimal_missing_file.csv", missing));
+    return true;
+}
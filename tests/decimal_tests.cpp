@@ -225,6 +225,23 @@ bool test_constructing_decimal_from_direct_constructor_and_parsing()
     return true;
 }
 
+bool test_constructing_decimal_from_parts_near_powers_of_ten()
+{
+    using decimal2d64_t = strict::decimal_t<int64_t, 2>;
+    ASSERT_EQ(decimal2d_t(10, 0).to_string(), "10.00");
+    ASSERT_EQ(decimal2d_t(-10, 0).to_string(), "-10.00");
+    ASSERT_EQ(decimal2d_t(10, 99).to_string(), "10.99");
+    ASSERT_EQ(decimal2d_t(10, 100).to_string(), "10.10");
+    ASSERT_EQ(decimal2d_t(10, 999).to_string(), "11.00");
+    ASSERT_EQ(decimal2d_t(10, 1000).to_string(), "10.10");
+    // 18 nines are 1e18 as double, their logarithm would count 19 digits
+    ASSERT_EQ(decimal2d64_t(1, 999999999999999999).to_string(), "2.00");
+    ASSERT_EQ(decimal2d64_t(1, 994999999999999999).to_string(), "1.99");
+    ASSERT_EQ(decimal2d64_t(-1, 1000000000000000000).to_string(), "-1.10");
+    ASSERT_EQ(decimal2d64_t(0, numeric_limits<int64_t>::max()).to_string(), "0.92");
+    return true;
+}
+
 bool test_constructing_decimal_from_string_and_parsing()
 {
     ASSERT_EQ(decimal2d_t("10.05").to_double(), 10.05);
@@ -1181,3 +1198,51 @@ bool test_double_to_decimal()
     std::cout << "-10.116=" << decimal2d_t{-10.116}.nominator() << std::endl;
     return true;
 }
+
+bool test_parsing_decimal_from_chars()
+{
+    const auto parse = [](const std::string& text, decimal2d_t& value) {
+        const auto res = strict::from_chars(text.data(), text.data() + text.size(), value);
+        return res.ec == std::errc{} && res.ptr == text.data() + text.size();
+    };
+    decimal2d_t value;
+    ASSERT_TRUE(parse("10.05", value));
+    ASSERT_EQ(value.to_string(), "10.05");
+    ASSERT_TRUE(parse("10.494", value));
+    ASSERT_EQ(value.to_string(), "10.49");
+    ASSERT_TRUE(parse("10.495", value));
+    ASSERT_EQ(value.to_string(), "10.50");
+    ASSERT_TRUE(parse("-0.5", value));
+    ASSERT_EQ(value.to_string(), "-0.50");
+    ASSERT_TRUE(parse("+7", value));
+    ASSERT_EQ(value.to_string(), "7.00");
+    ASSERT_TRUE(parse(".25", value));
+    ASSERT_EQ(value.to_string(), "0.25");
+    ASSERT_TRUE(parse("-9.999", value));
+    ASSERT_EQ(value.to_string(), "-10.00");
+    ASSERT_TRUE(parse("-inf", value));
+    ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_MINUS);
+    ASSERT_TRUE(parse("nan", value));
+    ASSERT_EQ(value.nominator(), decimal2d_t::NAN_VALUE);
+
+    value = decimal2d_t{1};
+    ASSERT_TRUE(!parse("", value));
+    ASSERT_TRUE(!parse("-", value));
+    ASSERT_TRUE(!parse("abc", value));
+    ASSERT_TRUE(!parse("21474837", value));
+    ASSERT_TRUE(!parse("21474836.47", value));
+    ASSERT_TRUE(!parse("21474836.46", value));
+    ASSERT_TRUE(!parse("-21474836.47", value));
+    ASSERT_TRUE(!parse("-21474836.48", value));
+    ASSERT_EQ(value.to_string(), "1.00");
+    ASSERT_TRUE(parse("21474836.45", value));
+    ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_PLUS - 1);
+    ASSERT_TRUE(parse("-21474836.46", value));
+    ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_MINUS + 1);
+
+    const std::string text = "12.5;13";
+    const auto res = strict::from_chars(text.data(), text.data() + text.size(), value);
+    ASSERT_TRUE(res.ptr == text.data() + 4);
+    ASSERT_EQ(value.to_string(), "12.50");
+    return true;
+}
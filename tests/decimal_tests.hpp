@@ -46,6 +46,7 @@ bool test_constructing_decimal_from_float_and_parsing_to_float();
 bool test_constructing_decimal_from_double_and_parsing_to_double();
 bool test_constructing_decimal_from_integer_and_parsing();
 bool test_constructing_decimal_from_direct_constructor_and_parsing();
+bool test_constructing_decimal_from_parts_near_powers_of_ten();
 bool test_constructing_decimal_from_string_and_parsing();
 
 bool test_adding_two_decimals();
@@ -102,3 +103,5 @@ bool test_direct_divide_integer_by_float();
 bool test_comparison_operators();
 
 bool test_double_to_decimal();
+
+bool test_parsing_decimal_from_chars();
@@ -0,0 +1,144 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_filter.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using quantity_t = strict::decimal_t<int32_t, 0>;
+using strict::compare_op;
+
+bool test_bitmask_operations()
+{
+    vector<uint64_t> first{0xF0F0, 0x1};
+    const vector<uint64_t> second{0xFF00, 0x3};
+    strict::bitmask_and(first, second);
+    ASSERT_EQ(first[0], 0xF000u);
+    strict::bitmask_or(first, second);
+    ASSERT_EQ(first[0], 0xFF00u);
+    ASSERT_EQ(first[1], 0x3u);
+    ASSERT_EQ(strict::bitmask_count(first), 10u);
+
+    strict::bitmask_not(first, 66);
+    ASSERT_EQ(first[0], ~uint64_t{0xFF00});
+    ASSERT_EQ(first[1], 0u);
+
+    const vector<uint64_t> bits{0x8000000000000005, 0x2};
+    vector<uint32_t> selection(strict::bitmask_count(bits));
+    ASSERT_EQ(strict::bitmask_to_selection(bits, selection.data()), 4u);
+    ASSERT_TRUE((selection == vector<uint32_t>{0, 2, 63, 65}));
+    return true;
+}
+
+bool test_filtering_with_conjunction()
+{
+    const auto prices = decimals_of<decimal4d_t>({"100.5", "99.25", "101", "100.0001", "100", "250"});
+    const auto quantities = decimals_of<quantity_t>({"10", "5", "20", "15", "1", "30"});
+    strict::column_filter filter(prices.size());
+    ASSERT_EQ(filter.count(), prices.size());  // no terms
+
+    filter.where<decimal4d_t>(prices, compare_op::greater, decimal2d_t("100"))
+          .where<quantity_t>(quantities, compare_op::less_equal, quantity_t(20));
+    ASSERT_TRUE((filter.selection() == vector<uint32_t>{0, 2, 3}));
+    ASSERT_EQ(filter.count(), 3u);
+    const auto bitmask = filter.bitmask();
+    ASSERT_EQ(bitmask.size(), 1u);
+    ASSERT_EQ(bitmask[0], 0xDu);
+    return true;
+}
+
+bool test_filtering_with_disjunction()
+{
+    const auto prices = decimals_of<decimal4d_t>({"1", "2", "3", "4", "5"});
+    strict::column_filter filter(prices.size());
+    // (price < 2 AND price > 100) OR price == 4 OR price >= 5
+    filter.where<decimal4d_t>(prices, compare_op::less, decimal4d_t("2"))
+          .where<decimal4d_t>(prices, compare_op::greater, decimal4d_t("100"))
+          .or_where<decimal4d_t>(prices, compare_op::equal, decimal4d_t("4"))
+          .or_where<decimal4d_t>(prices, compare_op::greater_equal, decimal2d_t("5"));
+    ASSERT_TRUE((filter.selection() == vector<uint32_t>{3, 4}));
+    return true;
+}
+
+bool test_filtering_by_ranged_decimal_bounds()
+{
+    using ratio_t = strict::ranged_decimal_t<int64_t, 4, 0, 1>;
+    auto ratios = decimals_of<decimal4d_t>({"0.5", "0", "1", "1.0001", "0"});
+    ratios[1] = decimal4d_t(decimal4d_t::nominator_t{-1});
+    strict::column_filter filter(ratios.size());
+    filter.where_in_range<ratio_t, decimal4d_t>(ratios);
+    ASSERT_TRUE((filter.selection() == vector<uint32_t>{0, 2, 4}));
+
+    strict::column_filter between(ratios.size());
+    between.where_between<decimal4d_t>(ratios, decimal2d_t("0.5"), strict::decimal_t<int64_t, 6>("1.000099"));
+    ASSERT_TRUE((between.selection() == vector<uint32_t>{0, 2}));
+    return true;
+}
+
+bool test_filtering_large_columns()
+{
+    std::mt19937_64 generator(1);
+    std::uniform_int_distribution<int64_t> priceDistribution(900000, 1100000);
+    std::uniform_int_distribution<int32_t> quantityDistribution(1, 100);
+    vector<decimal4d_t> prices;
+    vector<quantity_t> quantities;
+    const size_t rows = 3 * strict::column_filter::CHUNK_ROWS + 77;
+    for (size_t i = 0; i < rows; ++i) {
+        prices.emplace_back(decimal4d_t::nominator_t{priceDistribution(generator)});
+        quantities.emplace_back(quantity_t::nominator_t{quantityDistribution(generator)});
+    }
+    const decimal4d_t limit("100.5");
+    strict::column_filter filter(rows);
+    filter.where<decimal4d_t>(prices, compare_op::greater, limit)
+          .where<quantity_t>(quantities, compare_op::less_equal, quantity_t(50))
+          .or_where<decimal4d_t>(prices, compare_op::less, decimal4d_t("90.01"));
+    vector<uint32_t> expected;
+    for (size_t i = 0; i < rows; ++i) {
+        if ((prices[i] > limit && quantities[i] <= quantity_t(50)) || prices[i] < decimal4d_t("90.01")) {
+            expected.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    ASSERT_TRUE(filter.selection() == expected);
+    return true;
+}
@@ -0,0 +1,264 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#if defined(STRICT_DECIMAL_TEST_FMT)
+#include <fmt/format.h>
+#endif
+#include "../decimal_format.hpp"
+#include "test_macros.hpp"
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal0d_t = strict::decimal_t<int64_t, 0>;
+using decimal2d_t = strict::decimal_t<int32_t, 2>;
+using decimal6d_t = strict::decimal_t<int64_t, 6>;
+
+namespace
+{
+
+template<typename DecimalT>
+string format(const DecimalT& decimal)
+{
+    char buffer[DecimalT::MAX_STRING_LENGTH];
+    return string(buffer, decimal.to_chars(buffer));
+}
+
+template<typename DecimalT>
+string format(const DecimalT& decimal, const string& specText)
+{
+    strict::decimal_format_spec spec;
+    auto it = specText.begin();
+    if (!strict::parse_format_spec(it, specText.end(), spec)) {
+        return "invalid";
+    }
+    string res;
+    strict::format_to(back_inserter(res), decimal, spec);
+    return res;
+}
+
+}  // namespace
+
+bool test_to_chars_matches_to_string()
+{
+    ASSERT_EQ(format(decimal2d_t{10.11}), "10.11");
+    ASSERT_EQ(format(decimal2d_t{-10.11}), "-10.11");
+    ASSERT_EQ(format(decimal2d_t{0}), "0.00");
+    ASSERT_EQ(format(decimal2d_t{10, 5}), "10.05");
+    ASSERT_EQ(format(decimal6d_t{"123456789.000001"}), "123456789.000001");
+    ASSERT_EQ(format(decimal0d_t{1234567}), "1234567");
+    ASSERT_EQ(format(decimal0d_t{-1234567}), "-1234567");
+    ASSERT_EQ(format(decimal0d_t{0}), "0");
+
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{std::numeric_limits<int64_t>::max() - 2}}),
+              "9223372036854.775805");
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{std::numeric_limits<int64_t>::min()}}),
+              "-9223372036854.775808");
+    ASSERT_EQ(format(decimal0d_t{decimal0d_t::nominator_t{std::numeric_limits<int64_t>::min()}}),
+              "-9223372036854775808");
+
+    for (int32_t nominator = -100000; nominator <= 100000; nominator += 7) {
+        const decimal2d_t value{decimal2d_t::nominator_t{nominator}};
+        ASSERT_EQ(format(value), value.to_string());
+    }
+    return true;
+}
+
+bool test_to_chars_writes_special_values()
+{
+    ASSERT_EQ(format(decimal2d_t{decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}}), "nan");
+    ASSERT_EQ(format(decimal2d_t{decimal2d_t::nominator_t{decimal2d_t::INFINITY_PLUS}}), "inf");
+    ASSERT_EQ(format(decimal2d_t{decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS}}), "-inf");
+    ASSERT_EQ((decimal2d_t{1} / decimal2d_t{0}).to_string(), "inf");
+    return true;
+}
+
+bool test_to_chars_keeps_sign_of_negative_fractions()
+{
+    ASSERT_EQ(format(decimal2d_t{-0.05}), "-0.05");
+    ASSERT_EQ(decimal2d_t{-0.05}.to_string(), "-0.05");
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{-1}}), "-0.000001");
+    return true;
+}
+
+bool test_formatting_column_with_separator()
+{
+    const vector<decimal2d_t> column{decimal2d_t{1.5}, decimal2d_t{-2.25}, decimal2d_t{1000}, decimal2d_t{0, 1}};
+    vector<char> buffer(strict::max_formatted_column_size<decimal2d_t>(column.size()));
+
+    char* end = strict::format_column<decimal2d_t>(column, buffer.data(), ',');
+    ASSERT_EQ(string(buffer.data(), end), "1.50,-2.25,1000.00,0.01");
+
+    end = strict::format_column(strict::span<const decimal2d_t>(column.data(), 1), buffer.data(), ',');
+    ASSERT_EQ(string(buffer.data(), end), "1.50");
+    return true;
+}
+
+bool test_formatting_column_of_ranged_decimals()
+{
+    using ranged_t = strict::ranged_decimal_t<int64_t, 3, -10, 10>;
+    const vector<ranged_t> column{ranged_t{1.5}, ranged_t{-20}, ranged_t{20}};
+    vector<char> buffer(strict::max_formatted_column_size<ranged_t>(column.size()));
+
+    char* end = strict::format_column<ranged_t>(column, buffer.data(), '\n');
+    ASSERT_EQ(string(buffer.data(), end), "1.500\n-10.000\n10.000");
+    return true;
+}
+
+bool test_formatting_empty_column()
+{
+    char buffer[1];
+    const vector<decimal2d_t> column;
+    ASSERT_TRUE(strict::format_column<decimal2d_t>(column, buffer, ',') == buffer);
+    return true;
+}
+
+bool test_parsing_format_spec()
+{
+    strict::decimal_format_spec spec;
+    const string text = "*^+012,.3f}";
+    auto it = text.begin();
+    ASSERT_TRUE(strict::parse_format_spec(it, text.end(), spec));
+    ASSERT_TRUE(it == text.end() - 1);
+    ASSERT_EQ(spec.fill, '*');
+    ASSERT_EQ(spec.align, '^');
+    ASSERT_EQ(spec.sign, '+');
+    ASSERT_TRUE(spec.zeroPad);
+    ASSERT_EQ(spec.width, 12);
+    ASSERT_EQ(spec.grouping, ',');
+    ASSERT_EQ(spec.precision, 3);
+
+    strict::decimal_format_spec defaults;
+    const string empty;
+    auto emptyIt = empty.begin();
+    ASSERT_TRUE(strict::parse_format_spec(emptyIt, empty.end(), defaults));
+    ASSERT_EQ(defaults.width, 0);
+    ASSERT_EQ(defaults.precision, -1);
+
+    for (const char* invalid : {"x", "10.", ".f", "<<<", "{}", "123456789", "5d"}) {
+        ASSERT_EQ(format(decimal2d_t{1}, invalid), "invalid");
+    }
+    return true;
+}
+
+bool test_formatting_with_width_fill_and_sign()
+{
+    ASSERT_EQ(format(decimal2d_t{12.5}, ""), "12.50");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "8"), "   12.50");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "<8"), "12.50   ");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "*^9"), "**12.50**");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "*^8"), "*12.50**");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "+"), "+12.50");
+    ASSERT_EQ(format(decimal2d_t{12.5}, " "), " 12.50");
+    ASSERT_EQ(format(decimal2d_t{-12.5}, "+"), "-12.50");
+    ASSERT_EQ(format(decimal2d_t{-12.5}, "08"), "-0012.50");
+    ASSERT_EQ(format(decimal2d_t{12.5}, "+08"), "+0012.50");
+    // explicit alignment disables zero padding
+    ASSERT_EQ(format(decimal2d_t{-12.5}, ">08"), "  -12.50");
+    ASSERT_EQ(format(decimal2d_t{-12.5}, "3"), "-12.50");
+    return true;
+}
+
+bool test_formatting_with_displayed_precision()
+{
+    ASSERT_EQ(format(decimal6d_t{"1.234567"}, ".2"), "1.23");
+    ASSERT_EQ(format(decimal6d_t{"1.235"}, ".2f"), "1.24");
+    ASSERT_EQ(format(decimal6d_t{"-1.235"}, ".2"), "-1.24");
+    ASSERT_EQ(format(decimal6d_t{"9.9999"}, ".3"), "10.000");
+    ASSERT_EQ(format(decimal6d_t{"9.5"}, ".0"), "10");
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{-4000}}, ".2"), "-0.00");
+    ASSERT_EQ(format(decimal2d_t{1.5}, ".5"), "1.50000");
+    ASSERT_EQ(format(decimal0d_t{42}, ".2"), "42.00");
+    ASSERT_EQ(format(decimal0d_t{-42}, ""), "-42");
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{std::numeric_limits<int64_t>::min()}}, ".1"), "-9223372036854.8");
+    ASSERT_EQ(format(decimal6d_t{decimal6d_t::nominator_t{std::numeric_limits<int64_t>::max() - 2}}, ".0"), "9223372036855");
+
+    for (int32_t nominator = -100000; nominator <= 100000; nominator += 7) {
+        const decimal2d_t value{decimal2d_t::nominator_t{nominator}};
+        ASSERT_EQ(format(value, ""), value.to_string());
+        ASSERT_EQ(format(value, ".1"), format(strict::decimal_cast<int32_t, 1>(value)));
+    }
+    return true;
+}
+
+bool test_formatting_with_grouping()
+{
+    ASSERT_EQ(format(decimal6d_t{"1234567.891"}, ",.2"), "1,234,567.89");
+    ASSERT_EQ(format(decimal6d_t{"-1234567.891"}, "_.0"), "-1_234_568");
+    ASSERT_EQ(format(decimal6d_t{"123.4"}, ",.1"), "123.4");
+    ASSERT_EQ(format(decimal6d_t{"1000"}, ",.1"), "1,000.0");
+    ASSERT_EQ(format(decimal6d_t{"999999.99"}, ",.1"), "1,000,000.0");
+    ASSERT_EQ(format(decimal0d_t{decimal0d_t::nominator_t{std::numeric_limits<int64_t>::min()}}, ","),
+              "-9,223,372,036,854,775,808");
+    ASSERT_EQ(format(decimal2d_t{1234.5}, ">12,"), "    1,234.50");
+    ASSERT_EQ(format(strict::ranged_decimal_t<int64_t, 3, -100000, 100000>{50000}, "+,.1"), "+50,000.0");
+    return true;
+}
+
+bool test_formatting_special_values_with_spec()
+{
+    const decimal2d_t nan{decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}};
+    const decimal2d_t inf{decimal2d_t::nominator_t{decimal2d_t::INFINITY_PLUS}};
+    const decimal2d_t minusInf{decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS}};
+    ASSERT_EQ(format(nan, ",.4"), "nan");
+    ASSERT_EQ(format(inf, "+"), "+inf");
+    ASSERT_EQ(format(minusInf, "06"), "  -inf");
+    ASSERT_EQ(format(minusInf, "<6"), "-inf  ");
+    return true;
+}
+
+bool test_formatting_with_format_libraries()
+{
+#if defined(__cpp_lib_format)
+    ASSERT_EQ(std::format("{:>10,.1}|{}", decimal6d_t{"1234.56"}, decimal2d_t{-1}), "   1,234.6|-1.00");
+#endif
+#if defined(STRICT_DECIMAL_TEST_FMT)
+    ASSERT_EQ(fmt::format("{:>10,.1}|{}", decimal6d_t{"1234.56"}, decimal2d_t{-1}), "   1,234.6|-1.00");
+    ASSERT_EQ(fmt::format("{:*<+9}", strict::ranged_decimal_t<int32_t, 2, -10, 10>{3.5}), "+3.50****");
+    bool thrown = false;
+    try {
+        (void)fmt::format(fmt::runtime("{:x}"), decimal2d_t{1});
+    } catch (const fmt::format_error&) {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+#endif
+    return true;
+}
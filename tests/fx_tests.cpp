@@ -0,0 +1,196 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "fx_tests.hpp"
+#include "../decimal_fx.hpp"
+#include "test_macros.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+using fx_table_t = strict::fx_table<decimal2d_t, decimal8d_t>;
+
+namespace
+{
+
+constexpr uint32_t EUR = strict::currency_code("EUR");
+constexpr uint32_t USD = strict::currency_code("USD");
+constexpr uint32_t GBP = strict::currency_code("GBP");
+constexpr uint32_t JPY = strict::currency_code("JPY");
+
+decimal2d_t amount(int64_t nominator)
+{
+    return decimal2d_t(decimal2d_t::nominator_t{nominator});
+}
+
+}  // namespace
+
+bool test_fx_convert()
+{
+    fx_table_t table;
+    ASSERT_TRUE(table.set(EUR, USD, decimal8d_t("1.08765432")));
+    ASSERT_TRUE(table.set(GBP, USD, decimal8d_t("1.5")));
+    ASSERT_EQ(table.size(), 4u);
+    ASSERT_EQ(table.convert(decimal2d_t("100"), EUR, USD).to_string(), "108.77");
+    ASSERT_EQ(table.convert(amount(5), GBP, USD).to_string(), "0.08");
+    ASSERT_EQ(table.convert(amount(-5), GBP, USD).to_string(), "-0.08");
+    ASSERT_EQ(table.convert(decimal2d_t("100"), USD, USD).to_string(), "100.00");
+    ASSERT_EQ(table.convert(decimal2d_t("100"), EUR, JPY).to_string(), "nan");
+    ASSERT_TRUE(!table.contains(EUR, GBP));
+
+    // result with other precision than amounts
+    strict::fx_table<decimal2d_t, decimal8d_t, decimal4d_t> precise;
+    ASSERT_TRUE(precise.set(EUR, USD, decimal8d_t("1.08765432")));
+    ASSERT_EQ(precise.convert(amount(1), EUR, USD).to_string(), "0.0109");
+    ASSERT_EQ(precise.convert(decimal2d_t("123.45"), USD, EUR).to_string(), "113.5011");
+    ASSERT_EQ(precise.convert(amount(1), EUR, EUR).to_string(), "0.0100");
+
+    ASSERT_TRUE(!table.set(EUR, JPY, decimal8d_t("0")));
+    ASSERT_TRUE(!table.set(EUR, JPY, decimal8d_t("-150")));
+    ASSERT_TRUE(!table.set(EUR, EUR, decimal8d_t("1")));
+    return true;
+}
+
+bool test_fx_inverse_rates()
+{
+    fx_table_t table;
+    ASSERT_TRUE(table.set(EUR, USD, decimal8d_t("1.08765432")));
+    // 100 / 1.08765432 = 91.9408..., -12345.67 / 1.08765432 = -11350.7304...
+    ASSERT_EQ(table.convert(decimal2d_t("100"), USD, EUR).to_string(), "91.94");
+    ASSERT_EQ(table.convert(amount(-1234567), USD, EUR).to_string(), "-11350.73");
+
+    // a rate set explicitly replaces the reciprocal, but a reciprocal does not replace a set rate
+    ASSERT_TRUE(table.set(USD, EUR, decimal8d_t("0.9")));
+    ASSERT_EQ(table.convert(decimal2d_t("100"), USD, EUR).to_string(), "90.00");
+    ASSERT_TRUE(table.set(EUR, USD, decimal8d_t("1.2")));
+    ASSERT_EQ(table.convert(decimal2d_t("100"), USD, EUR).to_string(), "90.00");
+    ASSERT_EQ(table.convert(decimal2d_t("100"), EUR, USD).to_string(), "120.00");
+    ASSERT_EQ(table.size(), 2u);
+    return true;
+}
+
+bool test_fx_convert_column()
+{
+    fx_table_t table;
+    ASSERT_TRUE(table.set(EUR, USD, decimal8d_t("1.00000001")));
+    const vector<decimal2d_t> amounts{decimal2d_t("100"), amount(1234567890123456), amount(-1234567890123456), amount(0)};
+    vector<decimal2d_t> results(amounts.size());
+    ASSERT_TRUE(table.convert(amounts, EUR, USD, results));
+    ASSERT_EQ(results[0].to_string(), "100.00");
+    // products of large amounts do not fit in 64 bits
+    ASSERT_EQ(results[1].nominator(), 1234567902469135);
+    ASSERT_EQ(results[2].nominator(), -1234567902469135);
+    ASSERT_EQ(results[3].to_string(), "0.00");
+    ASSERT_TRUE(table.convert(amounts, USD, EUR, results));
+    ASSERT_EQ(results[1].nominator(), 1234567877777777);
+
+    // the same as conversions one by one
+    vector<decimal2d_t> many;
+    for (int64_t idx = 0; idx < 1000; ++idx) {
+        many.push_back(amount(idx * idx * 7919 - 3000000));
+    }
+    vector<decimal2d_t> converted(many.size());
+    ASSERT_TRUE(table.convert(many, USD, EUR, converted));
+    for (size_t idx = 0; idx < many.size(); ++idx) {
+        ASSERT_EQ(converted[idx], table.convert(many[idx], USD, EUR));
+        ASSERT_EQ(table.convert(many[idx], EUR, USD), many[idx] * decimal8d_t("1.00000001"));
+    }
+    ASSERT_TRUE(!table.convert(many, EUR, JPY, converted));
+    return true;
+}
+
+bool test_fx_special_values()
+{
+    fx_table_t table;
+    ASSERT_TRUE(table.set(EUR, USD, decimal8d_t("1.5")));
+    ASSERT_EQ(table.convert(amount(decimal2d_t::NAN_VALUE), EUR, USD).to_string(), "nan");
+    ASSERT_EQ(table.convert(amount(decimal2d_t::INFINITY_PLUS), EUR, USD).to_string(), "inf");
+    ASSERT_EQ(table.convert(amount(decimal2d_t::INFINITY_MINUS), USD, EUR).to_string(), "-inf");
+    // results out of range saturate
+    ASSERT_EQ(table.convert(amount(decimal2d_t::INFINITY_PLUS - 1), EUR, USD).to_string(), "inf");
+    ASSERT_EQ(table.convert(amount(decimal2d_t::INFINITY_MINUS + 1), EUR, USD).to_string(), "-inf");
+    ASSERT_TRUE(!table.set(EUR, JPY, decimal8d_t(decimal8d_t::nominator_t{decimal8d_t::NAN_VALUE})));
+    ASSERT_TRUE(!table.set(EUR, JPY, decimal8d_t(decimal8d_t::nominator_t{decimal8d_t::INFINITY_PLUS})));
+    return true;
+}
+
+bool test_fx_converter_update()
+{
+    fx_table_t initial;
+    initial.set(EUR, USD, decimal8d_t("1.1"));
+    strict::fx_converter<decimal2d_t, decimal8d_t> converter(initial);
+    ASSERT_EQ(converter.convert(decimal2d_t("100"), EUR, USD).to_string(), "110.00");
+
+    // readers see either table, never a deleted one
+    atomic<bool> done{false};
+    atomic<bool> valid{true};
+    vector<thread> readers;
+    for (int idx = 0; idx < 3; ++idx) {
+        readers.emplace_back([&] {
+            const vector<decimal2d_t> amounts(64, decimal2d_t("100"));
+            vector<decimal2d_t> results(amounts.size());
+            while (!done.load()) {
+                converter.convert(amounts, EUR, USD, results);
+                for (const auto& result : results) {
+                    if (result != results[0] || (result.to_string() != "110.00" && result.to_string() != "120.00")) {
+                        valid = false;
+                    }
+                }
+            }
+        });
+    }
+    for (int update = 0; update < 200; ++update) {
+        fx_table_t table;
+        table.set(EUR, USD, decimal8d_t(update % 2 == 0 ? "1.2" : "1.1"));
+        converter.update(table);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_TRUE(valid.load());
+    ASSERT_EQ(converter.convert(decimal2d_t("100"), EUR, USD).to_string(), "110.00");
+    ASSERT_TRUE(converter.read([](const fx_table_t& table) { return table.contains(USD, EUR); }));
+    return true;
+}
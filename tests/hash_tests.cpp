@@ -0,0 +1,171 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_hash.hpp"
+#include "test_macros.hpp"
+
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using ranged_t = strict::ranged_decimal_t<int64_t, 2, -1000, 1000>;
+
+bool test_hashing_decimals()
+{
+    const std::hash<decimal4d_t> hasher;
+    ASSERT_EQ(hasher(decimal4d_t("1.5")), hasher(decimal4d_t("1.5000")));
+    ASSERT_NEQ(hasher(decimal4d_t("1.5")), hasher(decimal4d_t("1.5001")));
+    using decimal2d_t = strict::decimal_t<int64_t, 2>;
+    ASSERT_EQ(std::hash<ranged_t>()(ranged_t("12.34")), std::hash<decimal2d_t>()(decimal2d_t("12.34")));
+
+    // prices on a tick grid are spread over all buckets
+    const size_t buckets = 64;
+    vector<size_t> counts(buckets, 0);
+    for (int64_t nominator = 1000000; nominator < 1000000 + 6400 * 5; nominator += 5) {
+        ++counts[hasher(decimal4d_t(decimal4d_t::nominator_t{nominator})) % buckets];
+    }
+    for (size_t count : counts) {
+        ASSERT_TRUE(count > 50 && count < 150);
+    }
+
+    unordered_set<decimal4d_t> prices{decimal4d_t("1"), decimal4d_t("2"), decimal4d_t("1.0")};
+    ASSERT_EQ(prices.size(), 2u);
+    return true;
+}
+
+bool test_hashing_decimal_columns()
+{
+    vector<decimal4d_t> values;
+    for (const char* text : {"0", "-1.25", "99.9999", "1000000"}) {
+        values.emplace_back(text);
+    }
+    vector<uint64_t> hashes(values.size());
+    strict::hash_column<decimal4d_t>(values, hashes);
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(hashes[i], static_cast<uint64_t>(std::hash<decimal4d_t>()(values[i])));
+    }
+    return true;
+}
+
+bool test_flat_hash_map_operations()
+{
+    strict::flat_hash_map<decimal4d_t, string> map;
+    ASSERT_TRUE(map.empty());
+    map[decimal4d_t("100.25")] = "a";
+    map[decimal4d_t("100.5")] += "b";
+    map[decimal4d_t("100.25")] += "c";
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(*map.find(decimal4d_t("100.25")), "ac");
+    ASSERT_TRUE(map.contains(decimal4d_t("100.5")));
+    ASSERT_TRUE(map.find(decimal4d_t("100.75")) == nullptr);
+
+    ASSERT_TRUE(map.erase(decimal4d_t("100.25")));
+    ASSERT_TRUE(!map.erase(decimal4d_t("100.25")));
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map[decimal4d_t("100.25")], "");
+
+    for (int i = 0; i < 1000; ++i) {
+        map[decimal4d_t(decimal4d_t::nominator_t{i * 5})] = to_string(i);
+    }
+    ASSERT_EQ(map.size(), 1002u);
+    ASSERT_TRUE(map.capacity() * 3 >= map.size() * 4);
+    ASSERT_EQ(*map.find(decimal4d_t("0.0995")), "199");
+
+    size_t visited = 0;
+    const auto& constMap = map;
+    constMap.for_each([&visited](const decimal4d_t&, const string&) { ++visited; });
+    ASSERT_EQ(visited, map.size());
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.find(decimal4d_t("0.0995")) == nullptr);
+    return true;
+}
+
+bool test_flat_hash_map_special_keys()
+{
+    strict::flat_hash_map<decimal4d_t, int> map(4);
+    const decimal4d_t smallest{decimal4d_t::nominator_t{std::numeric_limits<int64_t>::min()}};
+    const decimal4d_t nan{decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE}};
+    ASSERT_TRUE(map.find(smallest) == nullptr);
+    map[smallest] = 1;
+    map[nan] = 2;
+    map[decimal4d_t("0")] = 3;
+    ASSERT_EQ(map.size(), 3u);
+    ASSERT_EQ(*map.find(smallest), 1);
+    ASSERT_EQ(*map.find(nan), 2);
+
+    int sum = 0;
+    map.for_each([&sum](const decimal4d_t&, int& value) { sum += value; });
+    ASSERT_EQ(sum, 6);
+
+    ASSERT_TRUE(map.erase(smallest));
+    ASSERT_TRUE(!map.erase(smallest));
+    ASSERT_EQ(map.size(), 2u);
+    return true;
+}
+
+bool test_flat_hash_map_against_unordered_map()
+{
+    std::mt19937_64 generator(5);
+    std::uniform_int_distribution<int64_t> keys(0, 3000);
+    strict::flat_hash_map<decimal4d_t, int64_t> map;
+    unordered_map<int64_t, int64_t> expected;
+    for (int64_t i = 0; i < 100000; ++i) {
+        const int64_t nominator = keys(generator) * 5;
+        const decimal4d_t key{decimal4d_t::nominator_t{nominator}};
+        if (i % 3 == 0) {
+            ASSERT_EQ(map.erase(key), (expected.erase(nominator) == 1));
+        } else {
+            map[key] += i;
+            expected[nominator] += i;
+        }
+    }
+    ASSERT_EQ(map.size(), expected.size());
+    for (const auto& entry : expected) {
+        const int64_t* value = map.find(decimal4d_t(decimal4d_t::nominator_t{entry.first}));
+        ASSERT_TRUE(value != nullptr);
+        ASSERT_EQ(*value, entry.second);
+    }
+    return true;
+}
@@ -0,0 +1,252 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_ieee754.hpp"
+#include "test_macros.hpp"
+
+#include <limits>
+#include <vector>
+
+using namespace std;
+using decimal0d_t = strict::decimal_t<int64_t, 0>;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal6d_t = strict::decimal_t<int64_t, 6>;
+using strict::ieee754_encoding;
+using strict::ieee754_status;
+
+namespace
+{
+
+vector<int64_t> sample_nominators()
+{
+    vector<int64_t> res{0, 1, -1, 7, 8, 9, 99, 123, -123, 999, 1000, 123456789, -8999999999999999, 9999999999999999,
+                        -9999999999999999};
+    for (int64_t value = 1; value < 1000000000000000000; value = value * 7 + 3) {
+        res.push_back(value);
+        res.push_back(-value);
+    }
+    return res;
+}
+
+}  // namespace
+
+bool test_dpd_declet_tables()
+{
+    ASSERT_EQ(strict::detail::DPD_ENCODE_TABLE[0], 0);
+    ASSERT_EQ(strict::detail::DPD_ENCODE_TABLE[123], 0xA3);
+    ASSERT_EQ(strict::detail::DPD_ENCODE_TABLE[999], 0xFF);
+    ASSERT_EQ(strict::detail::DPD_ENCODE_TABLE[888], 0x6E);
+    for (unsigned value = 0; value < 1000; ++value) {
+        ASSERT_EQ(strict::detail::DPD_DECODE_TABLE[strict::detail::DPD_ENCODE_TABLE[value]], value);
+    }
+    // non-canonical declets of 888 and 999
+    ASSERT_EQ(strict::detail::DPD_DECODE_TABLE[0x36E], 888);
+    ASSERT_EQ(strict::detail::DPD_DECODE_TABLE[0x3FF], 999);
+    return true;
+}
+
+bool test_encoding_decimal64_bit_patterns()
+{
+    uint64_t bits = 0;
+    ASSERT_TRUE(strict::to_ieee754_decimal64(decimal0d_t{1}, ieee754_encoding::bid, bits) == ieee754_status::exact);
+    ASSERT_EQ(bits, 0x31C0000000000001ull);
+    ASSERT_TRUE(strict::to_ieee754_decimal64(decimal0d_t{1}, ieee754_encoding::dpd, bits) == ieee754_status::exact);
+    ASSERT_EQ(bits, 0x2238000000000001ull);
+
+    const decimal2d_t value{decimal2d_t::nominator_t{-123}};
+    strict::to_ieee754_decimal64(value, ieee754_encoding::bid, bits);
+    ASSERT_EQ(bits, 0xB18000000000007Bull);
+    strict::to_ieee754_decimal64(value, ieee754_encoding::dpd, bits);
+    ASSERT_EQ(bits, 0xA2300000000000A3ull);
+
+    // 16 nines need the second form of BID and the large leading digit form of DPD
+    const decimal0d_t nines{decimal0d_t::nominator_t{9999999999999999}};
+    strict::to_ieee754_decimal64(nines, ieee754_encoding::bid, bits);
+    ASSERT_EQ(bits, 0x6C7386F26FC0FFFFull);
+    strict::to_ieee754_decimal64(nines, ieee754_encoding::dpd, bits);
+    ASSERT_EQ(bits, 0x6E38FF3FCFF3FCFFull);
+    return true;
+}
+
+bool test_encoding_decimal128_bit_patterns()
+{
+    strict::ieee754_decimal128 bits;
+    ASSERT_TRUE(strict::to_ieee754_decimal128(decimal0d_t{1}, ieee754_encoding::bid, bits) == ieee754_status::exact);
+    ASSERT_EQ(bits.high, 0x3040000000000000ull);
+    ASSERT_EQ(bits.low, 1ull);
+    ASSERT_TRUE(strict::to_ieee754_decimal128(decimal0d_t{1}, ieee754_encoding::dpd, bits) == ieee754_status::exact);
+    ASSERT_EQ(bits.high, 0x2208000000000000ull);
+    ASSERT_EQ(bits.low, 1ull);
+    return true;
+}
+
+bool test_round_trip_of_decimal64()
+{
+    for (auto encoding : {ieee754_encoding::bid, ieee754_encoding::dpd}) {
+        for (int64_t nominator : sample_nominators()) {
+            const decimal6d_t value{decimal6d_t::nominator_t{nominator}};
+            uint64_t bits = 0;
+            const auto encoded = strict::to_ieee754_decimal64(value, encoding, bits);
+            decimal6d_t decoded;
+            const auto decoded_status = strict::from_ieee754_decimal64(bits, encoding, decoded);
+            ASSERT_TRUE(decoded_status == ieee754_status::exact);
+            if (encoded == ieee754_status::exact) {
+                ASSERT_EQ(decoded, value);
+            } else {
+                // values with more than 16 significant digits are rounded to 16 digits
+                ASSERT_TRUE(nominator >= 10000000000000000 || nominator <= -10000000000000000);
+                const int64_t difference = decoded.nominator() - value.nominator();
+                ASSERT_TRUE(difference >= -500 && difference <= 500);
+            }
+        }
+    }
+    return true;
+}
+
+bool test_round_trip_of_decimal128()
+{
+    for (auto encoding : {ieee754_encoding::bid, ieee754_encoding::dpd}) {
+        for (int64_t nominator : sample_nominators()) {
+            const decimal6d_t value{decimal6d_t::nominator_t{nominator}};
+            strict::ieee754_decimal128 bits;
+            ASSERT_TRUE(strict::to_ieee754_decimal128(value, encoding, bits) == ieee754_status::exact);
+            decimal6d_t decoded;
+            ASSERT_TRUE(strict::from_ieee754_decimal128(bits, encoding, decoded) == ieee754_status::exact);
+            ASSERT_EQ(decoded, value);
+
+            // decoding to different precision rescales the coefficient
+            decimal2d_t rescaled;
+            strict::from_ieee754_decimal128(bits, encoding, rescaled);
+            ASSERT_EQ(rescaled, strict::decimal_cast<decimal2d_t>(value));
+        }
+    }
+    return true;
+}
+
+bool test_decoding_decimal64_with_rounding_and_overflow()
+{
+    // 15 * 10^-3 = 0.015 rounded half up to two digits
+    decimal2d_t value;
+    const uint64_t bits = static_cast<uint64_t>(398 - 3) << 53 | 15;
+    ASSERT_TRUE(strict::from_ieee754_decimal64(bits, ieee754_encoding::bid, value) == ieee754_status::inexact);
+    ASSERT_EQ(value.to_string(), "0.02");
+    ASSERT_TRUE(strict::from_ieee754_decimal64(bits | 1ull << 63, ieee754_encoding::bid, value) == ieee754_status::inexact);
+    ASSERT_EQ(value.to_string(), "-0.02");
+
+    // 5 * 10^20 does not fit in int64_t nominator
+    const uint64_t huge = static_cast<uint64_t>(398 + 20) << 53 | 5;
+    ASSERT_TRUE(strict::from_ieee754_decimal64(huge, ieee754_encoding::bid, value) == ieee754_status::overflow);
+    ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_PLUS);
+
+    // 123 * 10^-400 rounds to zero
+    const uint64_t tiny = 123;
+    ASSERT_TRUE(strict::from_ieee754_decimal64(tiny, ieee754_encoding::bid, value) == ieee754_status::inexact);
+    ASSERT_EQ(value.nominator(), 0);
+    return true;
+}
+
+bool test_decoding_decimal128_with_large_coefficients()
+{
+    // 34 nines with exponent -30 = 9999.99999...; rounded to 2 digits gives 10000.00
+    strict::ieee754_decimal128 bits;
+    bits.high = static_cast<uint64_t>(6176 - 30) << 49 | 0x1ED09BEAD87C0ull;
+    bits.low = 0x378D8E63FFFFFFFFull;
+    decimal2d_t value;
+    ASSERT_TRUE(strict::from_ieee754_decimal128(bits, ieee754_encoding::bid, value) == ieee754_status::inexact);
+    ASSERT_EQ(value.to_string(), "10000.00");
+
+    // 10^20 * 10^-8 = 10^12, exact
+    bits.high = static_cast<uint64_t>(6176 - 8) << 49 | 0x5ull;
+    bits.low = 0x6BC75E2D63100000ull;
+    decimal6d_t exact;
+    ASSERT_TRUE(strict::from_ieee754_decimal128(bits, ieee754_encoding::bid, exact) == ieee754_status::exact);
+    ASSERT_EQ(exact.to_string(), "1000000000000.000000");
+
+    // 10^20 * 10^-21 = 0.1 drops 19 digits, all of them zeros
+    bits.high = static_cast<uint64_t>(6176 - 21) << 49 | 0x5ull;
+    ASSERT_TRUE(strict::from_ieee754_decimal128(bits, ieee754_encoding::bid, value) == ieee754_status::exact);
+    ASSERT_EQ(value.to_string(), "0.10");
+
+    // the same coefficient with exponent 0 overflows
+    bits.high = static_cast<uint64_t>(6176) << 49 | 0x5ull;
+    ASSERT_TRUE(strict::from_ieee754_decimal128(bits, ieee754_encoding::bid, exact) == ieee754_status::overflow);
+    ASSERT_EQ(exact.nominator(), decimal6d_t::INFINITY_PLUS);
+    return true;
+}
+
+bool test_converting_special_values_to_ieee754()
+{
+    const decimal2d_t nan{decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}};
+    const decimal2d_t minusInf{decimal2d_t::nominator_t{decimal2d_t::INFINITY_MINUS}};
+    for (auto encoding : {ieee754_encoding::bid, ieee754_encoding::dpd}) {
+        uint64_t bits = 0;
+        decimal2d_t value;
+        strict::to_ieee754_decimal64(nan, encoding, bits);
+        ASSERT_EQ(bits, 0x7C00000000000000ull);
+        strict::from_ieee754_decimal64(bits, encoding, value);
+        ASSERT_EQ(value.nominator(), decimal2d_t::NAN_VALUE);
+        strict::to_ieee754_decimal64(minusInf, encoding, bits);
+        ASSERT_EQ(bits, 0xF800000000000000ull);
+        strict::from_ieee754_decimal64(bits, encoding, value);
+        ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_MINUS);
+
+        strict::ieee754_decimal128 wide;
+        strict::to_ieee754_decimal128(minusInf, encoding, wide);
+        strict::from_ieee754_decimal128(wide, encoding, value);
+        ASSERT_EQ(value.nominator(), decimal2d_t::INFINITY_MINUS);
+    }
+    return true;
+}
+
+bool test_batch_conversion_to_ieee754()
+{
+    vector<decimal6d_t> values;
+    for (int64_t nominator : sample_nominators()) {
+        values.emplace_back(decimal6d_t::nominator_t{nominator});
+    }
+    vector<strict::ieee754_decimal128> wide(values.size());
+    ASSERT_TRUE(strict::to_ieee754_decimal128<decimal6d_t>(values, ieee754_encoding::dpd, wide) == ieee754_status::exact);
+    vector<decimal6d_t> decoded(values.size());
+    ASSERT_TRUE(strict::from_ieee754_decimal128<decimal6d_t>(wide, ieee754_encoding::dpd, decoded) == ieee754_status::exact);
+    ASSERT_TRUE(decoded == values);
+
+    vector<uint64_t> narrow(values.size());
+    ASSERT_TRUE(strict::to_ieee754_decimal64<decimal6d_t>(values, ieee754_encoding::bid, narrow) == ieee754_status::inexact);
+    ASSERT_TRUE(strict::from_ieee754_decimal64<decimal6d_t>(narrow, ieee754_encoding::bid, decoded) == ieee754_status::exact);
+    return true;
+}
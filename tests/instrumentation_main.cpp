@@ -0,0 +1,59 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "test_macros.hpp"
+#include "instrumentation_tests.hpp"
+
+// Instrumentation counters are tested in a separate executable compiled with STRICT_DECIMAL_INSTRUMENTATION,
+// so that StrictDecimalTests exercises the uninstrumented operators which users ship.
+void RunInstrumentationTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_instrumentation_operation_counts);
+    EXECUTE_TEST(testSuite, test_instrumentation_roundings_and_overflows);
+    EXECUTE_TEST(testSuite, test_instrumentation_special_values);
+    EXECUTE_TEST(testSuite, test_instrumentation_allocations);
+    EXECUTE_TEST(testSuite, test_instrumentation_per_thread);
+}
+
+int main()
+{
+    TestSuite instrumentationTests("InstrumentationTests");
+    RunInstrumentationTests(instrumentationTests);
+    instrumentationTests.print_failed();
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "instrumentation_tests.hpp"
+#include "../decimal.hpp"
+#include "test_macros.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+decimal2d_t value(int64_t nominator)
+{
+    return decimal2d_t(decimal2d_t::nominator_t{nominator});
+}
+
+}  // namespace
+
+bool test_instrumentation_operation_counts()
+{
+    ASSERT_TRUE(strict::INSTRUMENTATION_ENABLED);
+    strict::reset_instrumentation();
+    decimal2d_t a = value(1050);
+    const decimal2d_t b = value(200);
+    a = a + b;
+    a -= b;
+    a = -a;
+    a = a * b;
+    a *= b;
+    a /= b;
+    const strict::instrumentation_counters counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.additions, 3u);
+    ASSERT_EQ(counters.multiplications, 2u);
+    ASSERT_EQ(counters.divisions, 1u);
+    ASSERT_EQ(counters.roundings, 0u);
+    ASSERT_EQ(a.to_string(), "-21.00");
+    ASSERT_EQ(strict::instrumentation_snapshot().formats, 1u);
+
+    // snapshots subtract to the counts in between
+    const decimal2d_t c("12.5");
+    const strict::instrumentation_counters delta = strict::instrumentation_snapshot() - counters;
+    ASSERT_EQ(delta.parses, 1u);
+    ASSERT_EQ(delta.formats, 1u);
+    ASSERT_EQ(delta.additions, 0u);
+    ASSERT_EQ(c.nominator(), 1250);
+
+    strict::reset_instrumentation();
+    ASSERT_EQ(strict::instrumentation_snapshot().additions, 0u);
+    ASSERT_EQ(strict::instrumentation_snapshot().formats, 0u);
+    return true;
+}
+
+bool test_instrumentation_roundings_and_overflows()
+{
+    strict::reset_instrumentation();
+    // 1.05 * 1.05 = 1.1025, 1 / 3 = 0.333..., 1.5 * 1.5 = 2.25
+    decimal2d_t a = value(105) * value(105);
+    a = value(100) / value(300);
+    a = value(150) * value(150);
+    // 1.05 * 1.2345 = 1.296225 in the mixed precision product
+    a = value(105) * decimal4d_t(decimal4d_t::nominator_t{12345});
+    const decimal2d_t parsed("1.999");
+    strict::instrumentation_counters counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.roundings, 4u);
+    ASSERT_EQ(counters.overflows, 0u);
+    ASSERT_EQ(a.to_string(), "1.30");
+    ASSERT_EQ(parsed.to_string(), "2.00");
+
+    // with instrumentation enabled overflowing operations yield results wrapped around modulo 2^64 instead of
+    // executing signed overflow
+    strict::reset_instrumentation();
+    const decimal2d_t large = value(numeric_limits<int64_t>::max() / 2 + 1);
+    a = large + large;
+    ASSERT_EQ(a.nominator(), numeric_limits<int64_t>::min());
+    a = value(numeric_limits<int64_t>::min() / 2 - 1) - large;
+    ASSERT_EQ(a.nominator(), numeric_limits<int64_t>::max());
+    a = large * value(300);
+    a = value(10) + value(20);
+    counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.overflows, 3u);
+    ASSERT_EQ(counters.additions, 3u);
+    ASSERT_EQ(counters.multiplications, 1u);
+    return true;
+}
+
+bool test_instrumentation_special_values()
+{
+    strict::reset_instrumentation();
+    decimal2d_t a = value(100) / value(0);
+    ASSERT_EQ(a.nominator(), decimal2d_t::INFINITY_PLUS);
+    a = value(-100) / value(0);
+    ASSERT_EQ(a.nominator(), decimal2d_t::INFINITY_MINUS);
+    a = value(0) / value(0);
+    ASSERT_EQ(a.nominator(), decimal2d_t::NAN_VALUE);
+    a = value(0) / decimal4d_t(decimal4d_t::nominator_t{0});
+    ASSERT_EQ(a.nominator(), decimal2d_t::NAN_VALUE);
+    a = value(100) / value(200);
+    const strict::instrumentation_counters counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.divisions, 5u);
+    ASSERT_EQ(counters.specialValues, 4u);
+    ASSERT_EQ(counters.overflows, 0u);
+    return true;
+}
+
+bool test_instrumentation_allocations()
+{
+    using decimal_long_t = strict::decimal_t<int64_t, 18>;
+    strict::reset_instrumentation();
+    // short strings fit in the small string buffer
+    const string shortText = value(12345).to_string();
+    ASSERT_EQ(shortText, "123.45");
+    ASSERT_EQ(strict::instrumentation_snapshot().allocations, 0u);
+
+    const decimal_long_t precise(decimal_long_t::nominator_t{-1234567890123456789});
+    const string longText = precise.to_string();
+    ASSERT_EQ(longText, "-1.234567890123456789");
+    ASSERT_EQ(strict::instrumentation_snapshot().allocations, 1u);
+
+    const decimal_long_t parsed(longText.substr(1));
+    ASSERT_EQ(parsed.nominator(), 1234567890123456789);
+    const strict::instrumentation_counters counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.allocations, 2u);
+    ASSERT_EQ(counters.formats, 2u);
+    ASSERT_EQ(counters.parses, 1u);
+    return true;
+}
+
+bool test_instrumentation_per_thread()
+{
+    strict::reset_instrumentation();
+    strict::instrumentation_counters workerCounters;
+    thread worker([&workerCounters] {
+        decimal2d_t sum;
+        for (int i = 0; i < 1000; ++i) {
+            sum += value(i);
+        }
+        workerCounters = strict::instrumentation_snapshot();
+    });
+    worker.join();
+    decimal2d_t sum;
+    sum += value(1);
+
+    ASSERT_EQ(workerCounters.additions, 1000u);
+    const strict::instrumentation_counters counters = strict::instrumentation_snapshot();
+    ASSERT_EQ(counters.additions, 1u);
+    ASSERT_EQ((counters + workerCounters).additions, 1001u);
+    return true;
+}
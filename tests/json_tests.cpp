@@ -0,0 +1,228 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "json_tests.hpp"
+#include "../decimal_json.hpp"
+#include "test_macros.hpp"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal0d_t = strict::decimal_t<int64_t, 0>;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+namespace
+{
+
+// Nominator read from the whole text, or a marker if reading fails or stops early
+template<typename DecimalT>
+typename DecimalT::underlying_type read(const string& text)
+{
+    DecimalT value;
+    const auto res = strict::from_json_number(text.data(), text.data() + text.size(), value);
+    if (res.ec != errc{} || res.ptr != text.data() + text.size()) {
+        return numeric_limits<typename DecimalT::underlying_type>::min() + 7;
+    }
+    return value.nominator();
+}
+
+template<typename DecimalT>
+errc read_error(const string& text)
+{
+    DecimalT value{typename DecimalT::nominator_t{42}};
+    const auto res = strict::from_json_number(text.data(), text.data() + text.size(), value);
+    if (res.ec != errc{} && value.nominator() != 42) {
+        return errc::io_error;
+    }
+    return res.ec;
+}
+
+}  // namespace
+
+bool test_reading_json_numbers_with_exponents()
+{
+    ASSERT_EQ(read<decimal4d_t>("0"), 0);
+    ASSERT_EQ(read<decimal4d_t>("-0"), 0);
+    ASSERT_EQ(read<decimal4d_t>("12"), 120000);
+    ASSERT_EQ(read<decimal4d_t>("-12.5"), -125000);
+    ASSERT_EQ(read<decimal4d_t>("1.5e-3"), 15);
+    ASSERT_EQ(read<decimal4d_t>("1.25E+2"), 1250000);
+    ASSERT_EQ(read<decimal4d_t>("125e-2"), 12500);
+    ASSERT_EQ(read<decimal4d_t>("0.000125e4"), 12500);
+    ASSERT_EQ(read<decimal4d_t>("-3E0"), -30000);
+    // rounding half away from zero from the first discarded digit
+    ASSERT_EQ(read<decimal4d_t>("0.00005"), 1);
+    ASSERT_EQ(read<decimal4d_t>("-0.00005"), -1);
+    ASSERT_EQ(read<decimal4d_t>("0.000049999"), 0);
+    ASSERT_EQ(read<decimal4d_t>("5e-5"), 1);
+    ASSERT_EQ(read<decimal4d_t>("4.9e-5"), 0);
+    ASSERT_EQ(read<decimal4d_t>("1.23456789"), 12346);
+    ASSERT_EQ(read<decimal4d_t>("99999.99995"), 1000000000);
+    ASSERT_EQ(read<decimal4d_t>("1e-100000000000"), 0);
+    ASSERT_EQ(read<decimal4d_t>("0e100000000000"), 0);
+    // long mantissas are exact
+    ASSERT_EQ(read<decimal4d_t>("123456789012345678901234567890e-20"), 12345678901235);
+    ASSERT_EQ(read<decimal4d_t>("0.0000000000000000000000000000012345e31"), 123450);
+    ASSERT_EQ(read<decimal0d_t>("-9223372036854775808"), numeric_limits<int64_t>::min());
+    ASSERT_EQ(read<decimal0d_t>("9.223372036854775807e18"), numeric_limits<int64_t>::max());
+    ASSERT_EQ(read<decimal0d_t>("2.5"), 3);
+
+    // reading stops after the number
+    decimal4d_t value;
+    const char text[] = "1.5e2,";
+    const auto res = strict::from_json_number(text, text + 6, value);
+    ASSERT_TRUE(res.ec == errc{});
+    ASSERT_TRUE(res.ptr == text + 5);
+    ASSERT_EQ(value, decimal4d_t(150));
+    return true;
+}
+
+bool test_rejecting_invalid_json_numbers()
+{
+    for (const char* text : {"", "-", "+1", ".5", "1.", "1.e5", "1e", "1e+", "--1", "e5", "nan", "inf", "nul"}) {
+        ASSERT_TRUE(read_error<decimal4d_t>(text) == errc::invalid_argument);
+    }
+    // leading zeros end the number
+    ASSERT_EQ(read<decimal4d_t>("01"), numeric_limits<int64_t>::min() + 7);
+    ASSERT_TRUE(read_error<decimal4d_t>("01") == errc{});
+    ASSERT_TRUE((read_error<strict::decimal_t<uint64_t, 2>>("-1") == errc::invalid_argument));
+
+    ASSERT_TRUE(read_error<decimal4d_t>("1e30") == errc::result_out_of_range);
+    ASSERT_TRUE(read_error<decimal4d_t>("-1e100000000000") == errc::result_out_of_range);
+    ASSERT_TRUE(read_error<decimal0d_t>("9223372036854775808") == errc::result_out_of_range);
+    ASSERT_TRUE(read_error<decimal0d_t>("9223372036854775807.5") == errc::result_out_of_range);
+    ASSERT_TRUE(read_error<decimal0d_t>("-9223372036854775808") == errc{});
+
+    // nominators of nan and infinities are not produced from digits
+    for (const char* text : {"92233720368547758.07", "92233720368547758.06", "92233720368547758.055",
+                             "-92233720368547758.07", "-92233720368547758.08", "9223372036854775806e-2"}) {
+        ASSERT_TRUE(read_error<decimal2d_t>(text) == errc::result_out_of_range);
+    }
+    ASSERT_EQ(read<decimal2d_t>("92233720368547758.05"), decimal2d_t::INFINITY_PLUS - 1);
+    ASSERT_EQ(read<decimal2d_t>("-92233720368547758.06"), decimal2d_t::INFINITY_MINUS + 1);
+    return true;
+}
+
+bool test_json_number_round_trip()
+{
+    mt19937_64 generator(7);
+    char buffer[strict::max_json_number_size<decimal4d_t>()];
+    for (int i = 0; i < 10000; ++i) {
+        const decimal4d_t value{decimal4d_t::nominator_t{static_cast<int64_t>(generator() >> (generator() % 64))
+                                                         * (i % 2 == 0 ? 1 : -1)}};
+        if (value.nominator() == decimal4d_t::NAN_VALUE || value.nominator() == decimal4d_t::INFINITY_PLUS) {
+            continue;
+        }
+        char* end = strict::to_json_number(value, buffer);
+        ASSERT_EQ(read<decimal4d_t>(string(buffer, end)), value.nominator());
+    }
+
+    for (const int64_t special : {decimal4d_t::NAN_VALUE, decimal4d_t::INFINITY_PLUS, decimal4d_t::INFINITY_MINUS}) {
+        char* end = strict::to_json_number(decimal4d_t{decimal4d_t::nominator_t{special}}, buffer);
+        ASSERT_EQ(string(buffer, end), "null");
+    }
+    ASSERT_EQ(read<decimal4d_t>("null"), decimal4d_t::NAN_VALUE);
+
+    char shortBuffer[strict::max_json_number_size<strict::decimal_t<int8_t, 0>>()];
+    char* end = strict::to_json_number(strict::decimal_t<int8_t, 0>{-5}, shortBuffer);
+    ASSERT_EQ(string(shortBuffer, end), "-5");
+    return true;
+}
+
+bool test_reading_json_arrays()
+{
+    vector<decimal4d_t> values(8);
+    const string text = " [ 1.5e-3 ,-2,\n\t3.25E1 , null,0 ]  ";
+    auto res = strict::from_json_array(text.data(), text.data() + text.size(), strict::span<decimal4d_t>(values));
+    ASSERT_TRUE(res.ec == errc{});
+    ASSERT_EQ(res.count, 5);
+    ASSERT_TRUE(res.ptr == text.data() + text.find(']') + 1);
+    ASSERT_EQ(values[0].nominator(), 15);
+    ASSERT_EQ(values[1], decimal4d_t(-2));
+    ASSERT_EQ(values[2], decimal4d_t("32.5"));
+    ASSERT_EQ(values[3].nominator(), decimal4d_t::NAN_VALUE);
+    ASSERT_EQ(values[4], decimal4d_t(0));
+
+    const string empty = "[ ]";
+    res = strict::from_json_array(empty.data(), empty.data() + empty.size(), strict::span<decimal4d_t>(values));
+    ASSERT_TRUE(res.ec == errc{});
+    ASSERT_EQ(res.count, 0);
+
+    // errors keep values read before them
+    const string tooMany = "[1,2,3]";
+    res = strict::from_json_array(tooMany.data(), tooMany.data() + tooMany.size(), strict::span<decimal4d_t>(values.data(), 2));
+    ASSERT_TRUE(res.ec == errc::value_too_large);
+    ASSERT_EQ(res.count, 2);
+    ASSERT_TRUE(res.ptr == tooMany.data() + 5);
+
+    for (const char* invalid : {"", "1", "[", "[1", "[1,]", "[,1]", "[1 2]", "[1,,2]", "{1}"}) {
+        res = strict::from_json_array(invalid, invalid + strlen(invalid), strict::span<decimal4d_t>(values));
+        ASSERT_TRUE(res.ec == errc::invalid_argument);
+    }
+    const string outOfRange = "[1, 1e300]";
+    res = strict::from_json_array(outOfRange.data(), outOfRange.data() + outOfRange.size(), strict::span<decimal4d_t>(values));
+    ASSERT_TRUE(res.ec == errc::result_out_of_range);
+    ASSERT_EQ(res.count, 1);
+    return true;
+}
+
+bool test_writing_json_arrays()
+{
+    const vector<decimal4d_t> values{decimal4d_t("1.25"), decimal4d_t(-3), decimal4d_t{decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE}},
+                                     decimal4d_t{decimal4d_t::nominator_t{-1}}};
+    vector<char> buffer(strict::max_json_array_size<decimal4d_t>(values.size()));
+    char* end = strict::to_json_array(strict::span<const decimal4d_t>(values), buffer.data());
+    const string text(buffer.data(), end);
+    ASSERT_EQ(text, "[1.2500,-3.0000,null,-0.0001]");
+
+    vector<decimal4d_t> decoded(values.size());
+    const auto res = strict::from_json_array(text.data(), text.data() + text.size(), strict::span<decimal4d_t>(decoded));
+    ASSERT_TRUE(res.ec == errc{});
+    ASSERT_EQ(res.count, values.size());
+    ASSERT_EQ(decoded[3].nominator(), -1);
+
+    char emptyBuffer[strict::max_json_array_size<decimal4d_t>(0)];
+    end = strict::to_json_array(strict::span<const decimal4d_t>(), emptyBuffer);
+    ASSERT_EQ(string(emptyBuffer, end), "[]");
+    return true;
+}
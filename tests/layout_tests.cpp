@@ -0,0 +1,169 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "layout_tests.hpp"
+#include "../decimal.hpp"
+#include "test_macros.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal3d32_t = strict::decimal_t<int32_t, 3>;
+using percent_t = strict::ranged_decimal_t<int64_t, 2, 0, 100>;
+using small_ranged_t = strict::ranged_decimal_t<int16_t, 1, -100, 100>;
+
+namespace
+{
+
+static_assert(strict::has_nominator_layout_v<decimal2d_t>, "decimal2d_t layout");
+static_assert(strict::has_nominator_layout_v<decimal3d32_t>, "decimal3d32_t layout");
+static_assert(strict::has_nominator_layout_v<strict::decimal_t<uint32_t, 2>>, "unsigned decimal layout");
+static_assert(strict::has_nominator_layout_v<percent_t>, "percent_t layout");
+static_assert(strict::has_nominator_layout_v<small_ranged_t>, "small_ranged_t layout");
+static_assert(sizeof(small_ranged_t) == sizeof(int16_t), "ranged decimal adds no members");
+static_assert(is_nothrow_default_constructible<decimal2d_t>::value, "default construction does not throw");
+static_assert(is_nothrow_move_constructible<decimal2d_t>::value && is_nothrow_move_constructible<percent_t>::value,
+              "vectors move decimals on reallocation");
+static_assert(is_trivially_destructible<decimal2d_t>::value && is_trivially_destructible<percent_t>::value,
+              "decimals need no destruction");
+
+// Element type counting its copies, used to observe reallocations of vectors
+struct tracked_decimal
+{
+    static int copies;
+    decimal2d_t value;
+
+    tracked_decimal() = default;
+    explicit tracked_decimal(decimal2d_t decimal) noexcept : value(decimal) {}
+    tracked_decimal(const tracked_decimal& other) noexcept : value(other.value) { ++copies; }
+    tracked_decimal(tracked_decimal&& other) noexcept = default;
+    tracked_decimal& operator=(const tracked_decimal&) = default;
+    tracked_decimal& operator=(tracked_decimal&&) noexcept = default;
+};
+
+int tracked_decimal::copies = 0;
+
+}  // namespace
+
+bool test_decimals_are_trivially_copyable()
+{
+    const vector<decimal2d_t> values{decimal2d_t(1.25), decimal2d_t(-3), decimal2d_t(decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE})};
+    vector<decimal2d_t> copies(values.size());
+    memcpy(copies.data(), values.data(), values.size() * sizeof(decimal2d_t));
+    ASSERT_TRUE(copies == values);
+
+    // arrays of decimals are arrays of nominators, e.g. in memory mapped files
+    const int64_t nominators[] = {125, -300, 7};
+    decimal2d_t mapped[3];
+    memcpy(mapped, nominators, sizeof(nominators));
+    ASSERT_EQ(mapped[0].to_string(), "1.25");
+    ASSERT_EQ(mapped[1].to_string(), "-3.00");
+    ASSERT_EQ(mapped[2].to_string(), "0.07");
+
+    // realloc keeps values
+    percent_t* block = static_cast<percent_t*>(malloc(2 * sizeof(percent_t)));
+    ASSERT_TRUE(block != nullptr);
+    block[0] = percent_t(50);
+    block[1] = percent_t(150);
+    percent_t* grown = static_cast<percent_t*>(realloc(block, 1024 * sizeof(percent_t)));
+    ASSERT_TRUE(grown != nullptr);
+    ASSERT_EQ(grown[0].to_string(), "50.00");
+    ASSERT_EQ(grown[1].to_string(), "100.00");
+    free(grown);
+    return true;
+}
+
+bool test_decimals_are_relocated_without_copies()
+{
+    tracked_decimal::copies = 0;
+    vector<tracked_decimal> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.emplace_back(decimal2d_t(i));
+    }
+    ASSERT_EQ(tracked_decimal::copies, 0);
+    ASSERT_EQ(values[999].value, decimal2d_t(999));
+
+    vector<decimal2d_t> decimals(10, decimal2d_t(1));
+    decimals.reserve(1000);
+    ASSERT_EQ(decimals[9], decimal2d_t(1));
+    return true;
+}
+
+bool test_decimals_are_default_constructible_in_aggregates()
+{
+    const array<decimal2d_t, 3> zeros = {};
+    ASSERT_EQ(zeros[2], decimal2d_t(0));
+    struct quote
+    {
+        decimal2d_t bid;
+        decimal2d_t ask;
+    };
+    const quote empty = {};
+    ASSERT_EQ(empty.ask.nominator(), 0);
+    const quote partial = {decimal2d_t(5), {}};
+    ASSERT_EQ(partial.bid.to_string(), "5.00");
+    ASSERT_EQ(partial.ask.nominator(), 0);
+    const percent_t percent = {};
+    ASSERT_EQ(percent.nominator(), 0);
+    return true;
+}
+
+bool test_decimal_operations_are_noexcept()
+{
+    decimal2d_t a(1);
+    const decimal2d_t b(2);
+    const decimal4d_t c(3);
+    ASSERT_TRUE(noexcept(decimal2d_t(1.5)) && noexcept(decimal2d_t(1)) && noexcept(decimal2d_t(1, 5)) &&
+                noexcept(decimal2d_t(decimal2d_t::nominator_t{1})));
+    ASSERT_TRUE(noexcept(a + b) && noexcept(a - b) && noexcept(-a) && noexcept(a * b) && noexcept(a * c) && noexcept(a / b) &&
+                noexcept(a / c));
+    ASSERT_TRUE(noexcept(a += b) && noexcept(a -= b) && noexcept(a *= b) && noexcept(a *= c) && noexcept(a /= b) && noexcept(a /= c));
+    ASSERT_TRUE(noexcept(a < b) && noexcept(a == b) && noexcept(a.integer_part()) && noexcept(a.fraction_part()) &&
+                noexcept(a.to_double()) && noexcept(strict::decimal_cast<decimal4d_t>(a)));
+    const percent_t p(1);
+    ASSERT_TRUE(noexcept(p + p) && noexcept(p * b) && noexcept(p / b) && noexcept(percent_t(1, 5)));
+    return true;
+}
@@ -39,6 +39,28 @@
 #include "test_macros.hpp"
 #include "decimal_tests.hpp"
 #include "ranged_decimal_tests.hpp"
+#include "format_tests.hpp"
+#include "csv_tests.hpp"
+#include "serialization_tests.hpp"
+#include "compression_tests.hpp"
+#include "sort_tests.hpp"
+#include "price_ladder_tests.hpp"
+#include "hash_tests.hpp"
+#include "compare_tests.hpp"
+#include "filter_tests.hpp"
+#include "aggregation_tests.hpp"
+#include "window_tests.hpp"
+#include "statistics_tests.hpp"
+#include "math_tests.hpp"
+#include "compounding_tests.hpp"
+#include "fx_tests.hpp"
+#include "constexpr_tests.hpp"
+#include "parts_tests.hpp"
+#include "layout_tests.hpp"
+#include "column_file_tests.hpp"
+#include "arena_tests.hpp"
+#include "json_tests.hpp"
+#include "ieee754_tests.hpp"
 
 void RunDecimalTests(TestSuite& testSuite)
 {
@@ -49,6 +71,7 @@ void RunDecimalTests(TestSuite& testSuite)
     EXECUTE_TEST(testSuite, test_constructing_decimal_from_double_and_parsing_to_double);
     EXECUTE_TEST(testSuite, test_constructing_decimal_from_integer_and_parsing);
     EXECUTE_TEST(testSuite, test_constructing_decimal_from_direct_constructor_and_parsing);
+    EXECUTE_TEST(testSuite, test_constructing_decimal_from_parts_near_powers_of_ten);
     EXECUTE_TEST(testSuite, test_constructing_decimal_from_string_and_parsing);
 
     EXECUTE_TEST(testSuite, test_adding_two_decimals);
@@ -109,6 +132,8 @@ void RunDecimalTests(TestSuite& testSuite)
     EXECUTE_TEST(testSuite, test_comparison_operators);
 
     EXECUTE_TEST(testSuite, test_double_to_decimal);
+
+    EXECUTE_TEST(testSuite, test_parsing_decimal_from_chars);
 }
 
 void RunRangedDecimalTests(TestSuite& testSuite)
@@ -169,15 +194,286 @@ void RunRangedDecimalTests(TestSuite& testSuite)
     EXECUTE_TEST(testSuite, test_handling_divide_ranged_decimal_to_nan);
 }
 
+void RunFormatTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_to_chars_matches_to_string);
+    EXECUTE_TEST(testSuite, test_to_chars_writes_special_values);
+    EXECUTE_TEST(testSuite, test_to_chars_keeps_sign_of_negative_fractions);
+    EXECUTE_TEST(testSuite, test_formatting_column_with_separator);
+    EXECUTE_TEST(testSuite, test_formatting_column_of_ranged_decimals);
+    EXECUTE_TEST(testSuite, test_formatting_empty_column);
+    EXECUTE_TEST(testSuite, test_parsing_format_spec);
+    EXECUTE_TEST(testSuite, test_formatting_with_width_fill_and_sign);
+    EXECUTE_TEST(testSuite, test_formatting_with_displayed_precision);
+    EXECUTE_TEST(testSuite, test_formatting_with_grouping);
+    EXECUTE_TEST(testSuite, test_formatting_special_values_with_spec);
+    EXECUTE_TEST(testSuite, test_formatting_with_format_libraries);
+}
+
+void RunCsvTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_parsing_selected_csv_columns);
+    EXECUTE_TEST(testSuite, test_parsing_csv_split_into_chunks);
+    EXECUTE_TEST(testSuite, test_parsing_invalid_and_missing_csv_fields);
+    EXECUTE_TEST(testSuite, test_reading_csv_file);
+}
+
+void RunSerializationTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_serializing_fixed_format_byte_layout);
+    EXECUTE_TEST(testSuite, test_round_trip_of_fixed_format);
+    EXECUTE_TEST(testSuite, test_round_trip_of_compact_format);
+    EXECUTE_TEST(testSuite, test_compact_format_is_smaller_for_small_values);
+    EXECUTE_TEST(testSuite, test_deserializing_ranged_decimals_clamps_values);
+    EXECUTE_TEST(testSuite, test_rejecting_invalid_serialized_buffers);
+}
+
+void RunIeee754Tests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_dpd_declet_tables);
+    EXECUTE_TEST(testSuite, test_encoding_decimal64_bit_patterns);
+    EXECUTE_TEST(testSuite, test_encoding_decimal128_bit_patterns);
+    EXECUTE_TEST(testSuite, test_round_trip_of_decimal64);
+    EXECUTE_TEST(testSuite, test_round_trip_of_decimal128);
+    EXECUTE_TEST(testSuite, test_decoding_decimal64_with_rounding_and_overflow);
+    EXECUTE_TEST(testSuite, test_decoding_decimal128_with_large_coefficients);
+    EXECUTE_TEST(testSuite, test_converting_special_values_to_ieee754);
+    EXECUTE_TEST(testSuite, test_batch_conversion_to_ieee754);
+}
+
+void RunCompressionTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_round_trip_of_compressed_columns);
+    EXECUTE_TEST(testSuite, test_compressing_extreme_values);
+    EXECUTE_TEST(testSuite, test_random_access_to_compressed_column);
+    EXECUTE_TEST(testSuite, test_aggregating_compressed_blocks);
+    EXECUTE_TEST(testSuite, test_appending_to_compressed_column);
+    EXECUTE_TEST(testSuite, test_compression_ratio_of_price_series);
+}
+
+void RunSortTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_radix_sorting_of_decimals);
+    EXECUTE_TEST(testSuite, test_radix_sorting_of_ranged_decimals);
+    EXECUTE_TEST(testSuite, test_argsorting_decimals);
+    EXECUTE_TEST(testSuite, test_radix_sorting_by_key);
+    EXECUTE_TEST(testSuite, test_searching_sorted_decimals);
+}
+
+void RunPriceLadderTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_inserting_and_finding_price_levels);
+    EXECUTE_TEST(testSuite, test_best_prices_of_price_ladder);
+    EXECUTE_TEST(testSuite, test_sliding_price_ladder_window);
+    EXECUTE_TEST(testSuite, test_limiting_price_ladder_window);
+    EXECUTE_TEST(testSuite, test_iterating_over_price_levels);
+    EXECUTE_TEST(testSuite, test_price_ladder_against_map);
+}
+
+void RunHashTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_hashing_decimals);
+    EXECUTE_TEST(testSuite, test_hashing_decimal_columns);
+    EXECUTE_TEST(testSuite, test_flat_hash_map_operations);
+    EXECUTE_TEST(testSuite, test_flat_hash_map_special_keys);
+    EXECUTE_TEST(testSuite, test_flat_hash_map_against_unordered_map);
+}
+
+void RunCompareTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_comparing_decimals_of_different_precisions);
+    EXECUTE_TEST(testSuite, test_comparing_special_values_of_different_precisions);
+    EXECUTE_TEST(testSuite, test_three_way_comparison);
+    EXECUTE_TEST(testSuite, test_comparing_columns_with_scalar);
+    EXECUTE_TEST(testSuite, test_comparing_columns_with_scalar_of_other_precision);
+}
+
+void RunFilterTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_bitmask_operations);
+    EXECUTE_TEST(testSuite, test_filtering_with_conjunction);
+    EXECUTE_TEST(testSuite, test_filtering_with_disjunction);
+    EXECUTE_TEST(testSuite, test_filtering_by_ranged_decimal_bounds);
+    EXECUTE_TEST(testSuite, test_filtering_large_columns);
+}
+
+void RunAggregationTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_aggregating_decimals);
+    EXECUTE_TEST(testSuite, test_aggregating_special_values);
+    EXECUTE_TEST(testSuite, test_average_rounding);
+    EXECUTE_TEST(testSuite, test_grouping_by_key);
+    EXECUTE_TEST(testSuite, test_grouping_in_parallel);
+}
+
+void RunWindowTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_prefix_sum);
+    EXECUTE_TEST(testSuite, test_prefix_sum_of_special_values);
+    EXECUTE_TEST(testSuite, test_rolling_sum_and_mean);
+    EXECUTE_TEST(testSuite, test_vwap);
+    EXECUTE_TEST(testSuite, test_rolling_vwap);
+}
+
+void RunStatisticsTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_nth_smallest);
+    EXECUTE_TEST(testSuite, test_quantiles);
+    EXECUTE_TEST(testSuite, test_histogram);
+    EXECUTE_TEST(testSuite, test_quantile_sketch);
+    EXECUTE_TEST(testSuite, test_merging_quantile_sketches);
+}
+
+void RunMathTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_sqrt);
+    EXECUTE_TEST(testSuite, test_exp);
+    EXECUTE_TEST(testSuite, test_log);
+    EXECUTE_TEST(testSuite, test_integer_pow);
+    EXECUTE_TEST(testSuite, test_decimal_pow);
+}
+
+void RunCompoundingTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_compound);
+    EXECUTE_TEST(testSuite, test_discount_factors);
+    EXECUTE_TEST(testSuite, test_present_value);
+    EXECUTE_TEST(testSuite, test_npv);
+    EXECUTE_TEST(testSuite, test_npv_special_values);
+}
+
+void RunFxTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_fx_convert);
+    EXECUTE_TEST(testSuite, test_fx_inverse_rates);
+    EXECUTE_TEST(testSuite, test_fx_convert_column);
+    EXECUTE_TEST(testSuite, test_fx_special_values);
+    EXECUTE_TEST(testSuite, test_fx_converter_update);
+}
+
+void RunConstexprTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_constexpr_construction);
+    EXECUTE_TEST(testSuite, test_constexpr_arithmetic);
+    EXECUTE_TEST(testSuite, test_constexpr_cast);
+    EXECUTE_TEST(testSuite, test_constexpr_ranged_decimal);
+}
+
+void RunPartsTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_count_digits);
+    EXECUTE_TEST(testSuite, test_from_parts);
+    EXECUTE_TEST(testSuite, test_from_parts_matches_constructor);
+}
+
+void RunLayoutTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_decimals_are_trivially_copyable);
+    EXECUTE_TEST(testSuite, test_decimals_are_relocated_without_copies);
+    EXECUTE_TEST(testSuite, test_decimals_are_default_constructible_in_aggregates);
+    EXECUTE_TEST(testSuite, test_decimal_operations_are_noexcept);
+}
+
+void RunColumnFileTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_column_file_round_trip);
+    EXECUTE_TEST(testSuite, test_column_file_block_statistics);
+    EXECUTE_TEST(testSuite, test_selecting_range_of_column_file_skips_blocks);
+    EXECUTE_TEST(testSuite, test_rejecting_invalid_column_files);
+}
+
+void RunArenaTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_formatting_to_arena);
+    EXECUTE_TEST(testSuite, test_streaming_decimals_without_allocation);
+    EXECUTE_TEST(testSuite, test_parsing_views_of_arena_buffer);
+    EXECUTE_TEST(testSuite, test_reusing_arena_per_message);
+}
+
+void RunJsonTests(TestSuite& testSuite)
+{
+    EXECUTE_TEST(testSuite, test_reading_json_numbers_with_exponents);
+    EXECUTE_TEST(testSuite, test_rejecting_invalid_json_numbers);
+    EXECUTE_TEST(testSuite, test_json_number_round_trip);
+    EXECUTE_TEST(testSuite, test_reading_json_arrays);
+    EXECUTE_TEST(testSuite, test_writing_json_arrays);
+}
+
 int main()
 {
     TestSuite decimalTests("DecimalTests");
     TestSuite rangedDecimalTests("RangedDecimalTests");
+    TestSuite formatTests("FormatTests");
+    TestSuite csvTests("CsvTests");
+    TestSuite serializationTests("SerializationTests");
+    TestSuite ieee754Tests("Ieee754Tests");
+    TestSuite compressionTests("CompressionTests");
+    TestSuite sortTests("SortTests");
+    TestSuite priceLadderTests("PriceLadderTests");
+    TestSuite hashTests("HashTests");
+    TestSuite compareTests("CompareTests");
+    TestSuite filterTests("FilterTests");
+    TestSuite aggregationTests("AggregationTests");
+    TestSuite windowTests("WindowTests");
+    TestSuite statisticsTests("StatisticsTests");
+    TestSuite mathTests("MathTests");
+    TestSuite compoundingTests("CompoundingTests");
+    TestSuite fxTests("FxTests");
+    TestSuite constexprTests("ConstexprTests");
+    TestSuite partsTests("PartsTests");
+    TestSuite layoutTests("LayoutTests");
+    TestSuite columnFileTests("ColumnFileTests");
+    TestSuite arenaTests("ArenaTests");
+    TestSuite jsonTests("JsonTests");
 
     RunDecimalTests(decimalTests);
     RunRangedDecimalTests(rangedDecimalTests);
+    RunFormatTests(formatTests);
+    RunCsvTests(csvTests);
+    RunSerializationTests(serializationTests);
+    RunIeee754Tests(ieee754Tests);
+    RunCompressionTests(compressionTests);
+    RunSortTests(sortTests);
+    RunPriceLadderTests(priceLadderTests);
+    RunHashTests(hashTests);
+    RunCompareTests(compareTests);
+    RunFilterTests(filterTests);
+    RunAggregationTests(aggregationTests);
+    RunWindowTests(windowTests);
+    RunStatisticsTests(statisticsTests);
+    RunMathTests(mathTests);
+    RunCompoundingTests(compoundingTests);
+    RunFxTests(fxTests);
+    RunConstexprTests(constexprTests);
+    RunPartsTests(partsTests);
+    RunLayoutTests(layoutTests);
+    RunColumnFileTests(columnFileTests);
+    RunArenaTests(arenaTests);
+    RunJsonTests(jsonTests);
 
     decimalTests.print_failed();
     rangedDecimalTests.print_failed();
+    formatTests.print_failed();
+    csvTests.print_failed();
+    serializationTests.print_failed();
+    ieee754Tests.print_failed();
+    compressionTests.print_failed();
+    sortTests.print_failed();
+    priceLadderTests.print_failed();
+    hashTests.print_failed();
+    compareTests.print_failed();
+    filterTests.print_failed();
+    aggregationTests.print_failed();
+    windowTests.print_failed();
+    statisticsTests.print_failed();
+    mathTests.print_failed();
+    compoundingTests.print_failed();
+    fxTests.print_failed();
+    constexprTests.print_failed();
+    partsTests.print_failed();
+    layoutTests.print_failed();
+    columnFileTests.print_failed();
+    arenaTests.print_failed();
+    jsonTests.print_failed();
     return 0;
 }
@@ -0,0 +1,123 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "math_tests.hpp"
+#include "../decimal_math.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <string>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal8d_t = strict::decimal_t<int64_t, 8>;
+using decimal18d_t = strict::decimal_t<int64_t, 18>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+
+bool test_sqrt()
+{
+    ASSERT_EQ(strict::sqrt(decimal4d_t("16")).to_string(), "4.0000");
+    ASSERT_EQ(strict::sqrt(decimal4d_t("2")).to_string(), "1.4142");
+    ASSERT_EQ(strict::sqrt(decimal8d_t("2")).to_string(), "1.41421356");
+    ASSERT_EQ(strict::sqrt(decimal18d_t("2")).to_string(), "1.414213562373095049");
+    ASSERT_EQ(strict::sqrt(decimal2d_t("0.01")).to_string(), "0.10");
+    // sqrt(0.0002) = 0.01414..., sqrt(0.0003) = 0.01732...
+    ASSERT_EQ(strict::sqrt(decimal4d_t(decimal4d_t::nominator_t{2})).to_string(), "0.0141");
+    ASSERT_EQ(strict::sqrt(decimal4d_t(decimal4d_t::nominator_t{3})).to_string(), "0.0173");
+    ASSERT_EQ(strict::sqrt(decimal4d_t("922337203685477")).to_string(), "30370004.9998");
+    ASSERT_EQ(strict::sqrt(decimal2d_t(decimal2d_t::nominator_t{-1})).to_string(), "nan");
+    ASSERT_EQ(strict::sqrt(special<decimal2d_t>(decimal2d_t::INFINITY_PLUS)).to_string(), "inf");
+    return true;
+}
+
+bool test_exp()
+{
+    ASSERT_EQ(strict::exp(decimal8d_t("0")).to_string(), "1.00000000");
+    ASSERT_EQ(strict::exp(decimal8d_t("1")).to_string(), "2.71828183");
+    ASSERT_EQ(strict::exp(decimal18d_t("1")).to_string(), "2.718281828459045235");
+    ASSERT_EQ(strict::exp(decimal8d_t("-1")).to_string(), "0.36787944");
+    ASSERT_EQ(strict::exp(decimal4d_t("30")).to_string(), "10686474581524.4621");
+    ASSERT_EQ(strict::exp(decimal4d_t("-10")).to_string(), "0.0000");
+    ASSERT_EQ(strict::exp(decimal4d_t("35")).to_string(), "inf");
+    ASSERT_EQ(strict::exp(decimal2d32_t("3")).to_string(), "20.09");
+    ASSERT_EQ(strict::exp(special<decimal4d_t>(decimal4d_t::INFINITY_MINUS)).to_string(), "0.0000");
+    ASSERT_EQ(strict::exp(special<decimal4d_t>(decimal4d_t::NAN_VALUE)).to_string(), "nan");
+    return true;
+}
+
+bool test_log()
+{
+    ASSERT_EQ(strict::log(decimal8d_t("1")).to_string(), "0.00000000");
+    ASSERT_EQ(strict::log(decimal8d_t("2")).to_string(), "0.69314718");
+    ASSERT_EQ(strict::log(decimal18d_t("9")).to_string(), "2.197224577336219383");
+    ASSERT_EQ(strict::log(decimal8d_t("10")).to_string(), "2.30258509");
+    ASSERT_EQ(strict::log(decimal4d_t("922337203685477")).to_string(), "34.4579");
+    ASSERT_EQ(strict::log(decimal4d_t(decimal4d_t::nominator_t{1})).to_string(), "-9.2103");
+    ASSERT_EQ(strict::log(decimal4d_t("0")).to_string(), "-inf");
+    ASSERT_EQ(strict::log(decimal4d_t("-1")).to_string(), "nan");
+    ASSERT_EQ(strict::log(strict::exp(decimal8d_t("3.25"))).to_string(), "3.25000000");
+    return true;
+}
+
+bool test_integer_pow()
+{
+    ASSERT_EQ(strict::pow(decimal4d_t("1.05"), 10).to_string(), "1.6289");
+    ASSERT_EQ(strict::pow(decimal8d_t("1.05"), 30).to_string(), "4.32194238");
+    ASSERT_EQ(strict::pow(decimal4d_t("2"), -3).to_string(), "0.1250");
+    ASSERT_EQ(strict::pow(decimal4d_t("-1.5"), 3).to_string(), "-3.3750");
+    ASSERT_EQ(strict::pow(decimal4d_t("-1.5"), 0).to_string(), "1.0000");
+    ASSERT_EQ(strict::pow(decimal2d_t("0.05"), 2).to_string(), "0.00");  // 0.0025 rounds down
+    ASSERT_EQ(strict::pow(decimal2d_t("0.15"), 2).to_string(), "0.02");  // 0.0225 rounds up
+    // 1.0001^100000 does not fit in 128 bits and goes through exp and ln
+    ASSERT_EQ(strict::pow(decimal4d_t("1.0001"), 100000).to_string(), "22015.4560");
+    ASSERT_EQ(strict::pow(decimal4d_t("10"), 15).to_string(), "inf");
+    ASSERT_EQ(strict::pow(decimal4d_t("0"), -1).to_string(), "inf");
+    return true;
+}
+
+bool test_decimal_pow()
+{
+    ASSERT_EQ(strict::pow(decimal8d_t("2"), decimal8d_t("0.5")).to_string(), "1.41421356");
+    ASSERT_EQ(strict::pow(decimal8d_t("1.05"), decimal2d_t("2.5")).to_string(), "1.12972632");
+    ASSERT_EQ(strict::pow(decimal4d_t("-2"), decimal2d_t("3")).to_string(), "-8.0000");
+    ASSERT_EQ(strict::pow(decimal4d_t("-2"), decimal2d_t("0.5")).to_string(), "nan");
+    ASSERT_EQ(strict::pow(decimal4d_t("0"), decimal2d_t("0.5")).to_string(), "0.0000");
+    ASSERT_EQ(strict::pow(decimal4d_t("4"), decimal2d_t(decimal2d_t::nominator_t{-50})).to_string(), "0.5000");
+    return true;
+}
@@ -0,0 +1,129 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "parts_tests.hpp"
+#include "../decimal_parts.hpp"
+#include "test_macros.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+
+bool test_count_digits()
+{
+    ASSERT_EQ(strict::detail::count_digits(uint64_t{0}), 1);
+    ASSERT_EQ(strict::detail::count_digits(uint32_t{0}), 1);
+    uint64_t power = 1;
+    for (int digits = 1; digits <= 20; ++digits) {
+        ASSERT_EQ(strict::detail::count_digits(power), digits);
+        ASSERT_EQ(strict::detail::count_digits(power + 1), digits);
+        if (digits > 1) {
+            ASSERT_EQ(strict::detail::count_digits(power - 1), digits - 1);
+        }
+        if (digits < 20) {
+            power *= 10;
+        }
+    }
+    ASSERT_EQ(strict::detail::count_digits(numeric_limits<uint64_t>::max()), 20);
+    ASSERT_EQ(strict::detail::count_digits(numeric_limits<uint32_t>::max()), 10);
+    ASSERT_EQ(strict::detail::count_digits(uint16_t{9999}), 4);
+    ASSERT_EQ(strict::detail::count_digits(uint8_t{255}), 3);
+    static_assert(strict::detail::count_digits(uint64_t{1000}) == 4, "count_digits is constexpr");
+
+    // every bit width around its powers of 10
+    for (int bits = 1; bits < 64; ++bits) {
+        const uint64_t value = uint64_t{1} << bits;
+        int expected = 0;
+        for (uint64_t rest = value; rest != 0; rest /= 10) {
+            ++expected;
+        }
+        ASSERT_EQ(strict::detail::count_digits(value), expected);
+    }
+    return true;
+}
+
+bool test_from_parts()
+{
+    const vector<int64_t> integers{10, -10, 0, 3, -3, 7};
+    const vector<int64_t> fractions{5, 5, 0, 14159, 14159, 995};
+    vector<decimal2d_t> values(integers.size());
+    strict::from_parts<decimal2d_t>(integers, fractions, values);
+    ASSERT_EQ(values[0].to_string(), "10.05");
+    ASSERT_EQ(values[1].to_string(), "-10.05");
+    ASSERT_EQ(values[2].to_string(), "0.00");
+    ASSERT_EQ(values[3].to_string(), "3.14");
+    ASSERT_EQ(values[4].to_string(), "-3.14");
+    ASSERT_EQ(values[5].to_string(), "8.00");
+
+    // integer parts which overflow the nominator are left to the constructor
+    const vector<int64_t> largeIntegers(100, numeric_limits<int64_t>::max() / 100);
+    const vector<int64_t> zeros(100, 0);
+    vector<decimal2d_t> large(100);
+    strict::from_parts<decimal2d_t>(largeIntegers, zeros, large);
+    ASSERT_EQ(large[99], decimal2d_t(numeric_limits<int64_t>::max() / 100, 0));
+
+    vector<decimal2d_t> empty;
+    strict::from_parts<decimal2d_t>(vector<int64_t>{}, vector<int64_t>{}, empty);
+    return true;
+}
+
+bool test_from_parts_matches_constructor()
+{
+    mt19937_64 generator(42);
+    uniform_int_distribution<int64_t> integerDistribution(-1000000000, 1000000000);
+    uniform_int_distribution<int64_t> smallFraction(0, 9999);
+    uniform_int_distribution<int64_t> largeFraction(0, 999999999999);
+    const size_t count = 1000;
+    vector<int64_t> integers(count), fractions(count);
+    for (size_t i = 0; i < count; ++i) {
+        integers[i] = integerDistribution(generator);
+        // blocks of plain values with a few blocks needing rounding
+        fractions[i] = i / 64 % 3 == 1 && i % 7 == 0 ? largeFraction(generator) : smallFraction(generator);
+    }
+    vector<decimal4d_t> values(count);
+    strict::from_parts<decimal4d_t>(integers, fractions, values);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(values[i], decimal4d_t(integers[i], fractions[i]));
+    }
+    return true;
+}
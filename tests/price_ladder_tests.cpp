@@ -0,0 +1,211 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_price_ladder.hpp"
+#include "test_macros.hpp"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using ladder_t = strict::price_ladder<decimal4d_t, int64_t>;
+
+bool test_inserting_and_finding_price_levels()
+{
+    ladder_t ladder(decimal4d_t("0.0005"), 100);
+    ASSERT_TRUE(ladder.empty());
+    ASSERT_EQ(ladder.capacity(), 128u);
+    ASSERT_EQ(ladder.tick().to_string(), "0.0005");
+
+    *ladder.insert(decimal4d_t("100.2500")) += 10;
+    *ladder.insert(decimal4d_t("100.2500")) += 5;
+    *ladder.insert(decimal4d_t("100.2495")) = 7;
+    ASSERT_EQ(ladder.size(), 2u);
+    ASSERT_EQ(*ladder.find(decimal4d_t("100.25")), 15);
+    ASSERT_EQ(*ladder.find(decimal4d_t("100.2495")), 7);
+    ASSERT_TRUE(ladder.find(decimal4d_t("100.2490")) == nullptr);
+    ASSERT_TRUE(!ladder.contains(decimal4d_t("100.3")));
+
+    // prices outside of the tick grid and special values are rejected
+    ASSERT_TRUE(ladder.insert(decimal4d_t("100.2501")) == nullptr);
+    ASSERT_TRUE(ladder.insert(decimal4d_t(decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE})) == nullptr);
+    ASSERT_TRUE(ladder.find(decimal4d_t("100.2501")) == nullptr);
+
+    ASSERT_TRUE(ladder.erase(decimal4d_t("100.25")));
+    ASSERT_TRUE(!ladder.erase(decimal4d_t("100.25")));
+    ASSERT_EQ(ladder.size(), 1u);
+    ASSERT_EQ(*ladder.insert(decimal4d_t("100.25")), 0);  // erased level is reset
+
+    ladder.clear();
+    ASSERT_TRUE(ladder.empty());
+    ASSERT_TRUE(ladder.find(decimal4d_t("100.2495")) == nullptr);
+    return true;
+}
+
+bool test_best_prices_of_price_ladder()
+{
+    ladder_t ladder(decimal4d_t("0.01"));
+    ASSERT_EQ(ladder.lowest().to_string(), "nan");
+    ASSERT_EQ(ladder.highest().to_string(), "nan");
+
+    for (const char* price : {"10.05", "10.00", "10.20", "9.50", "10.30"}) {
+        ladder.insert(decimal4d_t(price));
+    }
+    ASSERT_EQ(ladder.lowest().to_string(), "9.5000");
+    ASSERT_EQ(ladder.highest().to_string(), "10.3000");
+
+    ladder.erase(decimal4d_t("10.30"));
+    ASSERT_EQ(ladder.highest().to_string(), "10.2000");
+    ladder.erase(decimal4d_t("9.50"));
+    ASSERT_EQ(ladder.lowest().to_string(), "10.0000");
+    ladder.erase(decimal4d_t("10.00"));
+    ladder.erase(decimal4d_t("10.20"));
+    ASSERT_EQ(ladder.lowest().to_string(), "10.0500");
+    ASSERT_EQ(ladder.highest().to_string(), "10.0500");
+
+    ladder.insert(decimal4d_t(decimal4d_t::nominator_t{-500}));  // e.g. spread instruments
+    ASSERT_EQ(ladder.lowest().to_string(), "-0.0500");
+    return true;
+}
+
+bool test_sliding_price_ladder_window()
+{
+    ladder_t ladder(decimal4d_t("0.0001"), 64, 1u << 20);
+    // market moves up by 100000 ticks while keeping few levels, no growth is needed
+    for (int64_t tick = 0; tick < 100000; ++tick) {
+        *ladder.insert(decimal4d_t(decimal4d_t::nominator_t{1000000 + tick})) = tick;
+        if (tick >= 10) {
+            ASSERT_TRUE(ladder.erase(decimal4d_t(decimal4d_t::nominator_t{1000000 + tick - 10})));
+        }
+    }
+    ASSERT_EQ(ladder.capacity(), 64u);
+    ASSERT_EQ(ladder.size(), 10u);
+    ASSERT_EQ(ladder.lowest().nominator(), 1000000 + 99990);
+    ASSERT_EQ(*ladder.find(decimal4d_t(decimal4d_t::nominator_t{1000000 + 99995})), 99995);
+
+    // levels spanning more than capacity make the ladder grow and keep all levels
+    *ladder.insert(decimal4d_t(decimal4d_t::nominator_t{1000000})) = -1;
+    ASSERT_EQ(ladder.capacity(), 131072u);
+    ASSERT_EQ(ladder.size(), 11u);
+    ASSERT_EQ(*ladder.find(decimal4d_t(decimal4d_t::nominator_t{1000000})), -1);
+    ASSERT_EQ(*ladder.find(decimal4d_t(decimal4d_t::nominator_t{1000000 + 99999})), 99999);
+
+    // erasing the stray level shrinks the ring back to the span of remaining levels
+    ASSERT_TRUE(ladder.erase(decimal4d_t(decimal4d_t::nominator_t{1000000})));
+    ASSERT_EQ(ladder.capacity(), 64u);
+    ASSERT_EQ(ladder.size(), 10u);
+    ASSERT_EQ(*ladder.find(decimal4d_t(decimal4d_t::nominator_t{1000000 + 99999})), 99999);
+    ASSERT_EQ(ladder.lowest().nominator(), 1000000 + 99990);
+    return true;
+}
+
+bool test_limiting_price_ladder_window()
+{
+    // levels far from the book are rejected instead of growing the ring
+    ladder_t ladder(decimal4d_t("0.01"), 64);
+    ASSERT_EQ(ladder.max_capacity(), ladder_t::DEFAULT_MAX_CAPACITY);
+    *ladder.insert(decimal4d_t("100.00")) = 1;
+    ASSERT_TRUE(ladder.insert(decimal4d_t("10000000.00")) == nullptr);
+    ASSERT_EQ(ladder.capacity(), 64u);
+    ASSERT_EQ(ladder.size(), 1u);
+
+    ladder_t small(decimal4d_t("1"), 64, 100);
+    ASSERT_EQ(small.max_capacity(), 128u);
+    *small.insert(decimal4d_t("0")) = 1;
+    ASSERT_TRUE(small.insert(decimal4d_t("127")) != nullptr);
+    ASSERT_EQ(small.capacity(), 128u);
+    ASSERT_TRUE(small.insert(decimal4d_t("128")) == nullptr);
+    ASSERT_TRUE(small.insert(decimal4d_t("-1")) == nullptr);
+    small.clear();
+    ASSERT_EQ(small.capacity(), 64u);
+    ASSERT_TRUE(small.insert(decimal4d_t("1000")) != nullptr);
+    return true;
+}
+
+bool test_iterating_over_price_levels()
+{
+    ladder_t ladder(decimal4d_t("0.5"), 64);
+    for (const char* price : {"3", "1.5", "40", "-2", "7.5"}) {
+        *ladder.insert(decimal4d_t(price)) = 1;
+    }
+    string ascending;
+    ladder.for_each_ascending([&ascending](const decimal4d_t& price, int64_t& value) {
+        ascending += price.to_string() + " ";
+        ++value;
+    });
+    ASSERT_EQ(ascending, "-2.0000 1.5000 3.0000 7.5000 40.0000 ");
+    string descending;
+    ladder.for_each_descending([&descending](const decimal4d_t& price, int64_t& value) {
+        descending += price.to_string() + "=" + std::to_string(value) + " ";
+    });
+    ASSERT_EQ(descending, "40.0000=2 7.5000=2 3.0000=2 1.5000=2 -2.0000=2 ");
+    return true;
+}
+
+bool test_price_ladder_against_map()
+{
+    std::mt19937_64 generator(3);
+    std::uniform_int_distribution<int> moves(-2, 2);
+    std::uniform_int_distribution<int> offsets(-40, 40);
+    ladder_t ladder(decimal4d_t("0.0005"), 64);
+    map<int64_t, int64_t> expected;
+    int64_t mid = 1000000;
+    for (int i = 0; i < 20000; ++i) {
+        mid += moves(generator) * 5;
+        const int64_t nominator = mid + offsets(generator) * 5;
+        const decimal4d_t price{decimal4d_t::nominator_t{nominator}};
+        if (i % 3 == 0) {
+            ASSERT_EQ(ladder.erase(price), (expected.erase(nominator) == 1));
+        } else {
+            *ladder.insert(price) += i;
+            expected[nominator] += i;
+        }
+        ASSERT_EQ(ladder.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(ladder.lowest().nominator(), expected.begin()->first);
+            ASSERT_EQ(ladder.highest().nominator(), expected.rbegin()->first);
+        }
+    }
+    vector<pair<int64_t, int64_t>> levels;
+    ladder.for_each_ascending([&levels](const decimal4d_t& price, int64_t value) { levels.emplace_back(price.nominator(), value); });
+    ASSERT_TRUE((levels == vector<pair<int64_t, int64_t>>(expected.begin(), expected.end())));
+    return true;
+}
@@ -0,0 +1,184 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_serialization.hpp"
+#include "test_macros.hpp"
+
+#include <limits>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int32_t, 2>;
+using decimal6d_t = strict::decimal_t<int64_t, 6>;
+
+namespace
+{
+
+vector<decimal6d_t> sample_values()
+{
+    vector<decimal6d_t> values;
+    for (int64_t nominator : {int64_t{0}, int64_t{1}, int64_t{-1}, int64_t{63}, int64_t{-64}, int64_t{64}, int64_t{123456789},
+                              int64_t{-987654321012}, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()}) {
+        values.emplace_back(decimal6d_t::nominator_t{nominator});
+    }
+    return values;
+}
+
+}  // namespace
+
+bool test_serializing_fixed_format_byte_layout()
+{
+    const vector<decimal2d_t> values{decimal2d_t{decimal2d_t::nominator_t{0x01020304}}, decimal2d_t{decimal2d_t::nominator_t{-2}}};
+    vector<unsigned char> buffer(strict::max_serialized_size<decimal2d_t>(values.size(), strict::binary_format::fixed));
+    const auto res = strict::serialize<decimal2d_t>(values, buffer, strict::binary_format::fixed);
+    ASSERT_TRUE(res.error == strict::serialization_error::none);
+    ASSERT_EQ(res.bytes, buffer.size());
+
+    const vector<unsigned char> expected{1, 2, 4, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+                                         0x04, 0x03, 0x02, 0x01, 0xfe, 0xff, 0xff, 0xff};
+    ASSERT_TRUE(buffer == expected);
+    return true;
+}
+
+bool test_round_trip_of_fixed_format()
+{
+    const auto values = sample_values();
+    vector<unsigned char> buffer(strict::max_serialized_size<decimal6d_t>(values.size(), strict::binary_format::fixed));
+    const auto written = strict::serialize<decimal6d_t>(values, buffer, strict::binary_format::fixed);
+    ASSERT_TRUE(written.error == strict::serialization_error::none);
+
+    size_t count = 0;
+    ASSERT_TRUE(strict::serialized_count(buffer, count));
+    ASSERT_EQ(count, values.size());
+
+    vector<decimal6d_t> decoded(count);
+    const auto read = strict::deserialize<decimal6d_t>(buffer, decoded);
+    ASSERT_TRUE(read.error == strict::serialization_error::none);
+    ASSERT_EQ(read.bytes, written.bytes);
+    ASSERT_TRUE(decoded == values);
+    return true;
+}
+
+bool test_round_trip_of_compact_format()
+{
+    const auto values = sample_values();
+    vector<unsigned char> buffer(strict::max_serialized_size<decimal6d_t>(values.size(), strict::binary_format::compact));
+    const auto written = strict::serialize<decimal6d_t>(values, buffer, strict::binary_format::compact);
+    ASSERT_TRUE(written.error == strict::serialization_error::none);
+
+    vector<decimal6d_t> decoded(values.size());
+    const auto read = strict::deserialize<decimal6d_t>(strict::span<const unsigned char>(buffer.data(), written.bytes), decoded);
+    ASSERT_TRUE(read.error == strict::serialization_error::none);
+    ASSERT_EQ(read.count, values.size());
+    ASSERT_EQ(read.bytes, written.bytes);
+    ASSERT_TRUE(decoded == values);
+    return true;
+}
+
+bool test_compact_format_is_smaller_for_small_values()
+{
+    const vector<decimal6d_t> values{decimal6d_t{decimal6d_t::nominator_t{63}}, decimal6d_t{decimal6d_t::nominator_t{-64}},
+                                     decimal6d_t{decimal6d_t::nominator_t{64}}};
+    vector<unsigned char> buffer(64);
+    const auto res = strict::serialize<decimal6d_t>(values, buffer, strict::binary_format::compact);
+    ASSERT_TRUE(res.error == strict::serialization_error::none);
+    ASSERT_EQ(res.bytes, strict::BINARY_HEADER_SIZE + 4);
+    ASSERT_EQ(int{buffer[12]}, 126);
+    ASSERT_EQ(int{buffer[13]}, 127);
+    ASSERT_EQ(int{buffer[14]}, 0x80);
+    ASSERT_EQ(int{buffer[15]}, 0x01);
+    return true;
+}
+
+bool test_deserializing_ranged_decimals_clamps_values()
+{
+    using ranged_t = strict::ranged_decimal_t<int32_t, 2, -10, 10>;
+    const vector<decimal2d_t> values{decimal2d_t{5}, decimal2d_t{50}, decimal2d_t{-50}};
+    vector<unsigned char> buffer(strict::max_serialized_size<decimal2d_t>(values.size(), strict::binary_format::fixed));
+    strict::serialize<decimal2d_t>(values, buffer, strict::binary_format::fixed);
+
+    vector<ranged_t> decoded(values.size());
+    const auto res = strict::deserialize<ranged_t>(buffer, decoded);
+    ASSERT_TRUE(res.error == strict::serialization_error::none);
+    ASSERT_EQ(decoded[0].to_string(), "5.00");
+    ASSERT_EQ(decoded[1].to_string(), "10.00");
+    ASSERT_EQ(decoded[2].to_string(), "-10.00");
+    return true;
+}
+
+bool test_rejecting_invalid_serialized_buffers()
+{
+    const auto values = sample_values();
+    vector<unsigned char> buffer(strict::max_serialized_size<decimal6d_t>(values.size(), strict::binary_format::compact));
+    const auto written = strict::serialize<decimal6d_t>(values, buffer, strict::binary_format::compact);
+
+    vector<unsigned char> small(written.bytes - 1);
+    ASSERT_TRUE(strict::serialize<decimal6d_t>(values, small, strict::binary_format::compact).error
+                == strict::serialization_error::buffer_too_small);
+
+    vector<decimal6d_t> decoded(values.size());
+    ASSERT_TRUE(strict::deserialize<decimal6d_t>(strict::span<const unsigned char>(buffer.data(), written.bytes - 1), decoded).error
+                == strict::serialization_error::buffer_too_small);
+
+    vector<decimal2d_t> otherPrecision(values.size());
+    ASSERT_TRUE(strict::deserialize<decimal2d_t>(buffer, otherPrecision).error == strict::serialization_error::precision_mismatch);
+
+    using decimal6d32_t = strict::decimal_t<int32_t, 6>;
+    vector<decimal6d32_t> narrow(values.size());
+    ASSERT_TRUE(strict::deserialize<decimal6d32_t>(buffer, narrow).error == strict::serialization_error::width_mismatch);
+
+    // NaN of a narrower type must not be read as a finite value of a wider one
+    const vector<decimal2d_t> nan(1, decimal2d_t{decimal2d_t::nominator_t{decimal2d_t::NAN_VALUE}});
+    vector<unsigned char> narrowBuffer(strict::max_serialized_size<decimal2d_t>(nan.size(), strict::binary_format::compact));
+    ASSERT_TRUE(strict::serialize<decimal2d_t>(nan, narrowBuffer, strict::binary_format::compact).error == strict::serialization_error::none);
+    using decimal2d64_t = strict::decimal_t<int64_t, 2>;
+    vector<decimal2d64_t> wide(nan.size());
+    ASSERT_TRUE(strict::deserialize<decimal2d64_t>(narrowBuffer, wide).error == strict::serialization_error::width_mismatch);
+
+    // varint longer than the nominator
+    vector<unsigned char> overlong(buffer.begin(), buffer.begin() + strict::BINARY_HEADER_SIZE);
+    overlong[4] = 1;
+    std::fill(overlong.begin() + 5, overlong.end(), 0);
+    overlong.insert(overlong.end(), 10, 0xff);
+    overlong.push_back(0x01);
+    ASSERT_TRUE(strict::deserialize<decimal6d_t>(overlong, decoded).error == strict::serialization_error::out_of_range);
+
+    buffer[0] = 7;
+    ASSERT_TRUE(strict::deserialize<decimal6d_t>(buffer, decoded).error == strict::serialization_error::invalid_header);
+    return true;
+}
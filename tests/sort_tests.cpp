@@ -0,0 +1,195 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "../decimal_sort.hpp"
+#include "test_macros.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal4d_t = strict::decimal_t<int64_t, 4>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+using udecimal2d_t = strict::decimal_t<uint64_t, 2>;
+
+namespace
+{
+
+template<typename DecimalT>
+vector<DecimalT> random_values(size_t count, int64_t range)
+{
+    std::mt19937_64 generator(11);
+    std::uniform_int_distribution<int64_t> distribution(-range, range);
+    vector<DecimalT> res;
+    for (size_t i = 0; i < count; ++i) {
+        res.emplace_back(typename DecimalT::nominator_t{static_cast<typename DecimalT::underlying_type>(distribution(generator))});
+    }
+    return res;
+}
+
+template<typename DecimalT>
+bool is_sorted_like_std(vector<DecimalT> values)
+{
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end());
+    strict::radix_sort<DecimalT>(values);
+    return std::equal(values.begin(), values.end(), expected.begin(), expected.end(),
+                      [](const DecimalT& lhs, const DecimalT& rhs) { return lhs.nominator() == rhs.nominator(); });
+}
+
+}  // namespace
+
+bool test_radix_sorting_of_decimals()
+{
+    auto values = random_values<decimal4d_t>(5000, 1000000000000);
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE});
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::INFINITY_PLUS});
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::INFINITY_MINUS});
+    values.emplace_back(decimal4d_t::nominator_t{std::numeric_limits<int64_t>::min()});
+    values.emplace(values.begin(), decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE});
+    ASSERT_TRUE(is_sorted_like_std(values));
+
+    strict::radix_sort<decimal4d_t>(values);
+    ASSERT_EQ(values.back().to_string(), "nan");
+    ASSERT_EQ(values[values.size() - 2].to_string(), "nan");
+    ASSERT_EQ(values[values.size() - 3].to_string(), "inf");
+    ASSERT_EQ(values[1].to_string(), "-inf");
+
+    ASSERT_TRUE(is_sorted_like_std(random_values<decimal2d32_t>(3000, 100000)));
+    ASSERT_TRUE(is_sorted_like_std(random_values<decimal4d_t>(3000, 100)));  // passes of high bytes are skipped
+
+    vector<udecimal2d_t> unsignedValues;
+    for (uint64_t nominator : {uint64_t{5}, ~uint64_t{0} - 7, uint64_t{0}, uint64_t{1} << 63, uint64_t{42}}) {
+        unsignedValues.emplace_back(udecimal2d_t::nominator_t{nominator});
+    }
+    ASSERT_TRUE(is_sorted_like_std(unsignedValues));
+
+    vector<decimal4d_t> empty;
+    strict::radix_sort<decimal4d_t>(empty);
+    ASSERT_TRUE(empty.empty());
+    return true;
+}
+
+bool test_radix_sorting_of_ranged_decimals()
+{
+    using ranged_t = strict::ranged_decimal_t<int64_t, 2, -1000, 1000>;
+    vector<ranged_t> values;
+    for (const char* text : {"12.5", "-999.99", "0.01", "1000", "-3", "12.49"}) {
+        values.emplace_back(text);
+    }
+    strict::radix_sort<ranged_t>(values);
+    string joined;
+    for (const auto& value : values) {
+        joined += value.to_string() + " ";
+    }
+    ASSERT_EQ(joined, "-999.99 -3.00 0.01 12.49 12.50 1000.00 ");
+    return true;
+}
+
+bool test_argsorting_decimals()
+{
+    vector<decimal4d_t> values;
+    for (const char* text : {"3.5", "-1", "3.5", "0", "-1"}) {
+        values.emplace_back(text);
+    }
+    values.emplace(values.begin() + 4, decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE});
+    const auto order = strict::argsort<decimal4d_t>(values);
+    const vector<size_t> expected{1, 5, 3, 0, 2, 4};  // equal values keep their order
+    ASSERT_TRUE(order == expected);
+
+    const auto randomValues = random_values<decimal4d_t>(2000, 5000);
+    const auto randomOrder = strict::argsort<decimal4d_t>(randomValues);
+    vector<size_t> expectedOrder(randomValues.size());
+    for (size_t i = 0; i < expectedOrder.size(); ++i) {
+        expectedOrder[i] = i;
+    }
+    std::stable_sort(expectedOrder.begin(), expectedOrder.end(),
+                     [&randomValues](size_t lhs, size_t rhs) { return randomValues[lhs] < randomValues[rhs]; });
+    ASSERT_TRUE(randomOrder == expectedOrder);
+    return true;
+}
+
+bool test_radix_sorting_by_key()
+{
+    vector<decimal4d_t> prices;
+    for (const char* text : {"101.25", "100.75", "101", "100.75"}) {
+        prices.emplace_back(text);
+    }
+    vector<string> orders{"a", "b", "c", "d"};
+    strict::radix_sort_by_key<decimal4d_t, string>(prices, orders);
+    ASSERT_EQ(prices[0].to_string(), "100.7500");
+    ASSERT_EQ(prices[1].to_string(), "100.7500");
+    ASSERT_EQ(prices[2].to_string(), "101.0000");
+    ASSERT_EQ(prices[3].to_string(), "101.2500");
+    ASSERT_TRUE((orders == vector<string>{"b", "d", "c", "a"}));
+    return true;
+}
+
+bool test_searching_sorted_decimals()
+{
+    auto values = random_values<decimal4d_t>(1000, 300);
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::INFINITY_PLUS});
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE});
+    values.emplace_back(decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE});
+    strict::radix_sort<decimal4d_t>(values);
+
+    for (size_t size : {size_t{0}, size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{100}, values.size()}) {
+        const vector<decimal4d_t> sorted(values.begin(), values.begin() + static_cast<ptrdiff_t>(size));
+        for (int64_t nominator = -310; nominator <= 310; ++nominator) {
+            const decimal4d_t key{decimal4d_t::nominator_t{nominator}};
+            ASSERT_EQ(strict::lower_bound<decimal4d_t>(sorted, key),
+                      static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin()));
+            ASSERT_EQ(strict::upper_bound<decimal4d_t>(sorted, key),
+                      static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), key) - sorted.begin()));
+        }
+    }
+
+    const decimal4d_t nan{decimal4d_t::nominator_t{decimal4d_t::NAN_VALUE}};
+    ASSERT_EQ(strict::lower_bound<decimal4d_t>(values, nan), values.size() - 2);
+    ASSERT_EQ(strict::upper_bound<decimal4d_t>(values, nan), values.size());
+
+    const vector<decimal4d_t> keys{decimal4d_t("-0.01"), decimal4d_t("0"), decimal4d_t("0.0299")};
+    vector<size_t> indices(keys.size());
+    strict::lower_bound<decimal4d_t>(values, keys, indices);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(indices[i], static_cast<size_t>(std::lower_bound(values.begin(), values.end(), keys[i]) - values.begin()));
+    }
+    return true;
+}
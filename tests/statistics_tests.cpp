@@ -0,0 +1,213 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "statistics_tests.hpp"
+#include "../decimal_statistics.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal4d32_t = strict::decimal_t<int32_t, 4>;
+
+namespace
+{
+
+vector<decimal2d_t> random_pnl(size_t count, uint64_t seed)
+{
+    std::mt19937_64 generator(seed);
+    std::normal_distribution<double> distribution(0, 1000000);
+    vector<decimal2d_t> res;
+    for (size_t i = 0; i < count; ++i) {
+        res.emplace_back(decimal2d_t::nominator_t{static_cast<int64_t>(distribution(generator))});
+    }
+    return res;
+}
+
+// Position of value in sorted values, as a fraction of their count
+double rank_of(const vector<decimal2d_t>& sorted, const decimal2d_t& value)
+{
+    return static_cast<double>(lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin()) / static_cast<double>(sorted.size());
+}
+
+}  // namespace
+
+bool test_nth_smallest()
+{
+    vector<decimal2d_t> values = random_pnl(200000, 1);
+    values[10] = special<decimal2d_t>(decimal2d_t::NAN_VALUE);
+    values[20] = special<decimal2d_t>(decimal2d_t::INFINITY_MINUS);
+    values[30] = special<decimal2d_t>(decimal2d_t::INFINITY_PLUS);
+    vector<decimal2d_t> sorted(values);
+    sort(sorted.begin(), sorted.end());  // NaN sorts last
+    bool matching = true;
+    for (size_t k : {size_t{0}, size_t{1}, size_t{777}, size_t{100000}, size_t{199997}, size_t{199998}}) {
+        matching = matching && strict::nth_smallest<decimal2d_t>(values, k) == sorted[k];
+    }
+    ASSERT_TRUE(matching);
+    ASSERT_EQ(strict::nth_smallest<decimal2d_t>(values, 0).to_string(), "-inf");
+    ASSERT_EQ(strict::nth_smallest<decimal2d_t>(values, 199998).to_string(), "inf");
+    ASSERT_EQ(strict::nth_smallest<decimal2d_t>(values, 199999).to_string(), "nan");
+
+    // values differing in low bits only, and in 32 bit nominators
+    vector<decimal4d32_t> narrow;
+    for (int i = 100; i > 0; --i) {
+        narrow.emplace_back(decimal4d32_t::nominator_t{1000000 + i});
+    }
+    ASSERT_EQ(strict::nth_smallest<decimal4d32_t>(narrow, 4).to_string(), "100.0005");
+    return true;
+}
+
+bool test_quantiles()
+{
+    vector<decimal2d_t> values;
+    for (const char* text : {"5", "1", "4", "2", "3"}) {
+        values.emplace_back(text);
+    }
+    values.push_back(special<decimal2d_t>(decimal2d_t::NAN_VALUE));
+    const vector<double> probabilities{0, 0.2, 0.21, 0.5, 0.99, 1};
+    vector<decimal2d_t> results(probabilities.size());
+    strict::quantiles<decimal2d_t>(values, probabilities, results);
+    vector<string> texts;
+    for (const auto& result : results) {
+        texts.push_back(result.to_string());
+    }
+    ASSERT_TRUE((texts == vector<string>{"1.00", "1.00", "2.00", "3.00", "5.00", "5.00"}));
+    ASSERT_EQ(strict::quantile<decimal2d_t>(vector<decimal2d_t>{}, 0.5).to_string(), "nan");
+
+    const vector<decimal2d_t> pnl = random_pnl(300000, 2);
+    vector<decimal2d_t> sorted(pnl);
+    sort(sorted.begin(), sorted.end());
+    const vector<double> percentiles{0.01, 0.05, 0.5, 0.95, 0.99, 0.999};
+    vector<decimal2d_t> tails(percentiles.size());
+    strict::quantiles<decimal2d_t>(pnl, percentiles, tails);
+    bool matching = true;
+    for (size_t idx = 0; idx < percentiles.size(); ++idx) {
+        matching = matching && tails[idx] == sorted[static_cast<size_t>(percentiles[idx] * sorted.size() + 0.5) - 1];
+    }
+    ASSERT_TRUE(matching);
+    return true;
+}
+
+bool test_histogram()
+{
+    vector<decimal2d_t> values;
+    for (const char* text : {"-1", "0", "0.99", "1", "2.5", "4.99", "5", "100"}) {
+        values.emplace_back(text);
+    }
+    values.push_back(special<decimal2d_t>(decimal2d_t::NAN_VALUE));
+    values.push_back(special<decimal2d_t>(decimal2d_t::INFINITY_MINUS));
+    values.push_back(special<decimal2d_t>(decimal2d_t::INFINITY_PLUS));
+    vector<uint64_t> counts(5, 0);
+    const auto outliers = strict::histogram<decimal2d_t>(values, decimal2d_t("0"), decimal2d_t("1"), counts);
+    ASSERT_TRUE((counts == vector<uint64_t>{2, 1, 1, 0, 1}));
+    ASSERT_EQ(outliers.below, 2u);
+    ASSERT_EQ(outliers.above, 3u);
+    ASSERT_EQ(outliers.nan, 1u);
+
+    // bucket edges are exact for widths without exact reciprocals
+    const vector<decimal2d_t> pnl = random_pnl(100003, 3);
+    const decimal2d_t low("-20000");
+    const decimal2d_t width("0.07");
+    vector<uint64_t> pnlCounts(500000, 0);
+    const auto pnlOutliers = strict::histogram<decimal2d_t>(pnl, low, width, pnlCounts);
+    vector<uint64_t> expected(pnlCounts.size(), 0);
+    size_t outside = 0;
+    for (const auto& value : pnl) {
+        const int64_t bucket = (value.nominator() - low.nominator()) / width.nominator();
+        if (value < low || bucket >= static_cast<int64_t>(expected.size())) {
+            ++outside;
+        } else {
+            ++expected[static_cast<size_t>(bucket)];
+        }
+    }
+    ASSERT_TRUE(pnlCounts == expected);
+    ASSERT_EQ(pnlOutliers.below + pnlOutliers.above, outside);
+    return true;
+}
+
+bool test_quantile_sketch()
+{
+    strict::quantile_sketch<decimal2d_t> sketch;
+    ASSERT_EQ(sketch.quantile(0.5).to_string(), "nan");
+    const vector<decimal2d_t> pnl = random_pnl(200000, 4);
+    for (const auto& value : pnl) {
+        sketch.add(value);
+    }
+    sketch.add(special<decimal2d_t>(decimal2d_t::NAN_VALUE));
+    ASSERT_EQ(sketch.count(), pnl.size());
+    ASSERT_TRUE(sketch.retained() < 1000);
+
+    vector<decimal2d_t> sorted(pnl);
+    sort(sorted.begin(), sorted.end());
+    double maxError = 0;
+    for (double probability : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+        maxError = max(maxError, abs(rank_of(sorted, sketch.quantile(probability)) - probability));
+    }
+    ASSERT_TRUE(maxError < 0.02);
+    return true;
+}
+
+bool test_merging_quantile_sketches()
+{
+    const vector<decimal2d_t> pnl = random_pnl(200000, 5);
+    strict::quantile_sketch<decimal2d_t> merged;
+    for (size_t part = 0; part < 4; ++part) {
+        strict::quantile_sketch<decimal2d_t> sketch;
+        for (size_t idx = part; idx < pnl.size(); idx += 4) {
+            sketch.add(pnl[idx]);
+        }
+        merged.merge(sketch);
+    }
+    ASSERT_EQ(merged.count(), pnl.size());
+    ASSERT_TRUE(merged.retained() < 1000);
+
+    vector<decimal2d_t> sorted(pnl);
+    sort(sorted.begin(), sorted.end());
+    double maxError = 0;
+    for (double probability : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        maxError = max(maxError, abs(rank_of(sorted, merged.quantile(probability)) - probability));
+    }
+    ASSERT_TRUE(maxError < 0.02);
+    return true;
+}
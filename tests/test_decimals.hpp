@@ -0,0 +1,22 @@
+#pragma once
+
+#include <initializer_list>
+#include <vector>
+
+// Decimal with the given nominator, used for NaN and infinities
+template<typename DecimalT>
+DecimalT special(typename DecimalT::underlying_type nominator)
+{
+    return DecimalT(typename DecimalT::nominator_t{nominator});
+}
+
+// Column of decimals parsed from texts
+template<typename DecimalT>
+std::vector<DecimalT> decimals_of(std::initializer_list<const char*> texts)
+{
+    std::vector<DecimalT> res;
+    for (const char* text : texts) {
+        res.emplace_back(text);
+    }
+    return res;
+}
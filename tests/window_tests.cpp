@@ -0,0 +1,196 @@
+/*
+ * Author: Kamil Galant
+ * e-mail: kamil.galant@gmail.com
+ * github: https://github.com/kamxgal
+ *
+ * Copyright (C) 2023 Kamil Galant. All Rights Reserved.
+ *
+ * License
+ * StrictDecimal is released under BSD-3-Clause license.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright
+ *  notice, this list of conditions and the following disclaimer in
+ *  the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *  (3)The name of the author may not be used to
+ *  endorse or promote products derived from this software without
+ *  specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ *  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ *  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ *  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ *  IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "window_tests.hpp"
+#include "../decimal_window.hpp"
+#include "test_decimals.hpp"
+#include "test_macros.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using decimal2d_t = strict::decimal_t<int64_t, 2>;
+using decimal2d32_t = strict::decimal_t<int32_t, 2>;
+using quantity_t = strict::decimal_t<int64_t, 3>;
+
+namespace
+{
+
+template<typename DecimalT>
+vector<string> strings_of(const vector<DecimalT>& values)
+{
+    vector<string> res;
+    for (const auto& value : values) {
+        res.push_back(value.to_string());
+    }
+    return res;
+}
+
+}  // namespace
+
+bool test_prefix_sum()
+{
+    const auto values = decimals_of<decimal2d_t>({"1.25", "-2.5", "100", "0.01"});
+    vector<decimal2d_t> sums(values.size());
+    strict::prefix_sum<decimal2d_t>(values, sums);
+    ASSERT_TRUE((strings_of(sums) == vector<string>{"1.25", "-1.25", "98.75", "98.76"}));
+
+    // long series go through the 64 bit block path, with a few values forcing exact wide blocks
+    std::mt19937_64 generator(7);
+    std::uniform_int_distribution<int64_t> distribution(-1000000000, 1000000000);
+    vector<decimal2d_t> series;
+    for (int i = 0; i < 1000; ++i) {
+        series.emplace_back(decimal2d_t::nominator_t{distribution(generator)});
+    }
+    series[300] = decimal2d_t(decimal2d_t::nominator_t{int64_t{1} << 60});
+    series[301] = decimal2d_t(decimal2d_t::nominator_t{-(int64_t{1} << 60)});
+    vector<decimal2d_t> seriesSums(series.size());
+    strict::prefix_sum<decimal2d_t>(series, seriesSums);
+    int64_t expected = 0;
+    bool matching = true;
+    for (size_t i = 0; i < series.size(); ++i) {
+        expected += series[i].nominator();
+        matching = matching && seriesSums[i].nominator() == expected;
+    }
+    ASSERT_TRUE(matching);
+
+    // in place
+    strict::prefix_sum<decimal2d_t>(series, series);
+    ASSERT_TRUE(series == seriesSums);
+    return true;
+}
+
+bool test_prefix_sum_of_special_values()
+{
+    vector<decimal2d_t> values = decimals_of<decimal2d_t>({"1", "2", "3", "4"});
+    values[1] = special<decimal2d_t>(decimal2d_t::NAN_VALUE);
+    values[2] = special<decimal2d_t>(decimal2d_t::INFINITY_PLUS);
+    vector<decimal2d_t> sums(values.size());
+    strict::prefix_sum<decimal2d_t>(values, sums);
+    ASSERT_TRUE((strings_of(sums) == vector<string>{"1.00", "1.00", "inf", "inf"}));
+
+    // sums exceeding nominators saturate and come back once they fit again
+    const auto wide = decimals_of<decimal2d32_t>({"20000000", "20000000", "-21000000"});
+    vector<decimal2d32_t> wideSums(wide.size());
+    strict::prefix_sum<decimal2d32_t>(wide, wideSums);
+    ASSERT_TRUE((strings_of(wideSums) == vector<string>{"20000000.00", "inf", "19000000.00"}));
+    return true;
+}
+
+bool test_rolling_sum_and_mean()
+{
+    const auto values = decimals_of<decimal2d_t>({"1", "2", "4", "8", "16.01"});
+    vector<decimal2d_t> sums(values.size());
+    strict::rolling_sum<decimal2d_t>(values, 3, sums);
+    ASSERT_TRUE((strings_of(sums) == vector<string>{"1.00", "3.00", "7.00", "14.00", "28.01"}));
+    vector<decimal2d_t> means(values.size());
+    strict::rolling_mean<decimal2d_t>(values, 3, means);
+    ASSERT_TRUE((strings_of(means) == vector<string>{"1.00", "1.50", "2.33", "4.67", "9.34"}));
+
+    // streaming window gives the same results, infinity leaves the window with its value
+    strict::rolling_window<decimal2d_t> window(3);
+    vector<string> streamed;
+    for (const auto& value : values) {
+        window.push(value);
+        streamed.push_back(window.mean().to_string());
+    }
+    ASSERT_TRUE(streamed == strings_of(means));
+    window.push(special<decimal2d_t>(decimal2d_t::INFINITY_MINUS));
+    ASSERT_EQ(window.sum().to_string(), "-inf");
+    window.push(special<decimal2d_t>(decimal2d_t::NAN_VALUE));
+    window.push(decimal2d_t("1"));
+    ASSERT_EQ(window.sum().to_string(), "-inf");
+    window.push(decimal2d_t("2"));
+    ASSERT_EQ(window.size(), 3u);
+    ASSERT_EQ(window.count(), 2u);
+    ASSERT_EQ(window.sum().to_string(), "3.00");
+    ASSERT_EQ(window.mean().to_string(), "1.50");
+
+    strict::running_sum<decimal2d_t> running;
+    running.add(decimal2d_t("0.1"));
+    ASSERT_EQ(running.add(decimal2d_t("0.25")).to_string(), "0.35");
+    ASSERT_EQ(running.count(), 2u);
+    return true;
+}
+
+bool test_vwap()
+{
+    const auto prices = decimals_of<decimal2d_t>({"100.01", "100.02", "99.99"});
+    const auto quantities = decimals_of<quantity_t>({"1.5", "2", "0.25"});
+    // (150.015 + 200.04 + 24.9975) / 3.75 = 100.014
+    ASSERT_EQ((strict::vwap<decimal2d_t, quantity_t>(prices, quantities).to_string()), "100.01");
+
+    // rounding happens once: 0.01 * 1 + 0.02 * 1 = 0.03 / 2 = 0.015
+    const auto cents = decimals_of<decimal2d_t>({"0.01", "0.02"});
+    const auto units = decimals_of<quantity_t>({"1", "1"});
+    ASSERT_EQ((strict::vwap<decimal2d_t, quantity_t>(cents, units).to_string()), "0.02");
+
+    strict::vwap_accumulator<decimal2d_t, quantity_t> accumulator;
+    ASSERT_EQ(accumulator.value().to_string(), "nan");
+    accumulator.add(decimal2d_t("10"), quantity_t("3"));
+    accumulator.add(special<decimal2d_t>(decimal2d_t::NAN_VALUE), quantity_t("5"));
+    ASSERT_EQ(accumulator.count(), 1u);
+    accumulator.add(decimal2d_t("20"), special<quantity_t>(quantity_t::INFINITY_PLUS));
+    ASSERT_EQ(accumulator.value().to_string(), "nan");
+    accumulator.remove(decimal2d_t("20"), special<quantity_t>(quantity_t::INFINITY_PLUS));
+    accumulator.add(decimal2d_t("11"), quantity_t("1"));
+    ASSERT_EQ(accumulator.value().to_string(), "10.25");
+
+    // remainder above half of the 64 bit range, (2^63 - 4) / (2^63 - 3) rounds up to 1
+    const int64_t largest = quantity_t::INFINITY_PLUS - 1;
+    strict::vwap_accumulator<decimal2d_t, quantity_t> large;
+    large.add(decimal2d_t{decimal2d_t::nominator_t{1}}, quantity_t{quantity_t::nominator_t{largest - 1}});
+    large.add(decimal2d_t{}, quantity_t{quantity_t::nominator_t{1}});
+    ASSERT_EQ(large.value().to_string(), "0.01");
+    return true;
+}
+
+bool test_rolling_vwap()
+{
+    strict::rolling_vwap<decimal2d_t, quantity_t> window(2);
+    window.push(decimal2d_t("10"), quantity_t("1"));
+    ASSERT_EQ(window.value().to_string(), "10.00");
+    window.push(decimal2d_t("12"), quantity_t("3"));
+    ASSERT_EQ(window.value().to_string(), "11.50");
+    window.push(decimal2d_t("20"), quantity_t("1"));
+    ASSERT_EQ(window.size(), 2u);
+    ASSERT_EQ(window.value().to_string(), "14.00");
+    return true;
+}